@@ -0,0 +1,2056 @@
+/**
+ * secureStrings library - some basic benchmarks
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <unistd.h>
+#include <sys/types.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <ctype.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <securestr.h>
+#include <securestr_conv.h>
+#include <securestr_array.h>
+#include <securestr_hash.h>
+#include <securestr_map.h>
+#include <securestr_vault.h>
+#include <securestr_utf8.h>
+#include <securestr_case.h>
+#include <securestr_class.h>
+#include <securestr_io.h>
+#include <securestr_pool.h>
+#include <securestr_defer.h>
+#include <securestr_bloom.h>
+#include <securestr_prefix.h>
+
+/* size of the function string */
+#define FUNC_SIZE    32
+
+int    main(int, char*[]);
+void   syntax_exit(void);
+void   bench_sstrArray(size_t, size_t);
+void   bench_sstrHash(void);
+void   bench_sstrVault(size_t);
+void   bench_sstrAppdNum(void);
+void   bench_sstrToNum(void);
+void   bench_sstrCodec(size_t);
+void   bench_sstrUtf8(size_t);
+void   bench_sstrCase(size_t);
+void   bench_sstrClass(size_t);
+void   bench_sstrEscape(size_t);
+void   bench_sstrLineReader(size_t);
+void   bench_sstrMapFile(size_t);
+void   bench_sstrFormat(void);
+void   bench_sstrPool(size_t, size_t);
+void   bench_sstrIndexOfBatch(size_t, size_t, size_t);
+void   bench_sstrDeallocDeferred(size_t);
+void   bench_sstrCmpAny(size_t, size_t);
+void   bench_sstrBloom(size_t);
+void   bench_sstrPrefixIndex(size_t);
+void   bench_sstrSort(size_t, size_t);
+void   bench_sstrReplace(size_t);
+void   bench_sstrSplice(size_t);
+void*  vault_reader(void*);
+void*  mutex_reader(void*);
+int    memcmp_order(const void*, const void*);
+void   fill_chars(char*, size_t, size_t);
+double now_sec(void);
+void   dspTime(const char*, double, size_t);
+void   dspRate(const char*, double, size_t);
+size_t argSize(const char*);
+
+sstr_rc argCmp(sString*, const char*);
+
+/* sink for results, keeps the compiler from removing benchmark loops */
+volatile size_t bench_sink;
+
+/**
+ * secureStrings benchmarks
+ */
+int main(
+    int   argc,
+    char* argv[]
+)
+{
+    sString* func;
+
+    if (argc < 2)
+    {
+        syntax_exit();
+    }
+
+    func = sstr_alloc( (size_t) FUNC_SIZE );
+    if (func == NULL)
+    {
+        fputs("Out of memory\n", stderr);
+        exit(1);
+    }
+    sstrCpyCstr(
+        (const char*) argv[1],
+        func,
+        strlen(argv[1])
+    );
+
+    if ( argCmp(func, "sstrArray") == SSTR_TRUE && argc == 4 )
+    {
+        bench_sstrArray(argSize(argv[2]), argSize(argv[3]));
+    } else
+    if ( argCmp(func, "sstrHash") == SSTR_TRUE && argc == 2 )
+    {
+        bench_sstrHash();
+    } else
+    if ( argCmp(func, "sstrVault") == SSTR_TRUE && argc <= 3 )
+    {
+        bench_sstrVault(argc == 3 ? argSize(argv[2]) :
+            (size_t) sysconf(_SC_NPROCESSORS_ONLN));
+    } else
+    if ( argCmp(func, "sstrAppdNum") == SSTR_TRUE && argc == 2 )
+    {
+        bench_sstrAppdNum();
+    } else
+    if ( argCmp(func, "sstrToNum") == SSTR_TRUE && argc == 2 )
+    {
+        bench_sstrToNum();
+    } else
+    if ( argCmp(func, "sstrCodec") == SSTR_TRUE && argc == 3 )
+    {
+        bench_sstrCodec(argSize(argv[2]));
+    } else
+    if ( argCmp(func, "sstrUtf8") == SSTR_TRUE && argc == 3 )
+    {
+        bench_sstrUtf8(argSize(argv[2]));
+    } else
+    if ( argCmp(func, "sstrCase") == SSTR_TRUE && argc == 3 )
+    {
+        bench_sstrCase(argSize(argv[2]));
+    } else
+    if ( argCmp(func, "sstrClass") == SSTR_TRUE && argc == 3 )
+    {
+        bench_sstrClass(argSize(argv[2]));
+    } else
+    if ( argCmp(func, "sstrEscape") == SSTR_TRUE && argc == 3 )
+    {
+        bench_sstrEscape(argSize(argv[2]));
+    } else
+    if ( argCmp(func, "sstrLineReader") == SSTR_TRUE && argc == 3 )
+    {
+        bench_sstrLineReader(argSize(argv[2]));
+    } else
+    if ( argCmp(func, "sstrMapFile") == SSTR_TRUE && argc == 3 )
+    {
+        bench_sstrMapFile(argSize(argv[2]));
+    } else
+    if ( argCmp(func, "sstrFormat") == SSTR_TRUE && argc == 2 )
+    {
+        bench_sstrFormat();
+    } else
+    if ( argCmp(func, "sstrPool") == SSTR_TRUE && (argc == 3 || argc == 4) )
+    {
+        bench_sstrPool(argSize(argv[2]), argc == 4 ? argSize(argv[3]) :
+            (size_t) sysconf(_SC_NPROCESSORS_ONLN));
+    } else
+    if ( argCmp(func, "sstrIndexOfBatch") == SSTR_TRUE && (argc == 4 || argc == 5) )
+    {
+        bench_sstrIndexOfBatch(argSize(argv[2]), argSize(argv[3]), argc == 5 ?
+            argSize(argv[4]) : (size_t) sysconf(_SC_NPROCESSORS_ONLN));
+    } else
+    if ( argCmp(func, "sstrDeallocDeferred") == SSTR_TRUE && argc == 3 )
+    {
+        bench_sstrDeallocDeferred(argSize(argv[2]));
+    } else
+    if ( argCmp(func, "sstrCmpAny") == SSTR_TRUE && argc == 4 )
+    {
+        bench_sstrCmpAny(argSize(argv[2]), argSize(argv[3]));
+    } else
+    if ( argCmp(func, "sstrBloom") == SSTR_TRUE && argc == 3 )
+    {
+        bench_sstrBloom(argSize(argv[2]));
+    } else
+    if ( argCmp(func, "sstrPrefixIndex") == SSTR_TRUE && argc == 3 )
+    {
+        bench_sstrPrefixIndex(argSize(argv[2]));
+    } else
+    if ( argCmp(func, "sstrSort") == SSTR_TRUE && argc == 4 )
+    {
+        bench_sstrSort(argSize(argv[2]), argSize(argv[3]));
+    } else
+    if ( argCmp(func, "sstrReplace") == SSTR_TRUE && argc == 3 )
+    {
+        bench_sstrReplace(argSize(argv[2]));
+    } else
+    if ( argCmp(func, "sstrSplice") == SSTR_TRUE && argc == 3 )
+    {
+        bench_sstrSplice(argSize(argv[2]));
+    } else {
+        syntax_exit();
+    }
+
+    sstr_dealloc(func);
+
+    return 0;
+}
+
+/**
+ * show syntax help and exit
+ */
+void syntax_exit(void)
+{
+    fputs("Syntax: libbench <benchmark> <arguments...>\n", stderr);
+    fputs("  sstrArray        <count> <length>\n"
+          "  sstrHash\n"
+          "  sstrVault        [max_threads]\n"
+          "  sstrAppdNum\n"
+          "  sstrToNum\n"
+          "  sstrCodec        <length>\n"
+          "  sstrUtf8         <length>\n"
+          "  sstrCase         <length>\n"
+          "  sstrClass        <length>\n"
+          "  sstrEscape       <length>\n"
+          "  sstrLineReader   <length>\n"
+          "  sstrMapFile      <length>\n"
+          "  sstrFormat\n"
+          "  sstrPool         <length> [max_threads]\n"
+          "  sstrIndexOfBatch <count> <length> [max_threads]\n"
+          "  sstrDeallocDeferred <length>\n"
+          "  sstrCmpAny       <count> <length>\n"
+          "  sstrBloom        <count>\n"
+          "  sstrPrefixIndex  <count>\n"
+          "  sstrSort         <count> <length>\n"
+          "  sstrReplace      <length>\n"
+          "  sstrSplice       <length>\n", stderr);
+
+    exit(1);
+}
+
+/**
+ * sstr_array vs. an array of separately allocated secureStrings
+ */
+void bench_sstrArray(
+    size_t count,
+    size_t length
+)
+{
+    sString**   strs;
+    sstr_array* arr;
+    sString*    pat;
+    sString     view;
+    double      start;
+    size_t      sum;
+    size_t      idx;
+
+    strs = malloc(count * sizeof (sString*));
+    arr  = sstr_array_alloc(count * (length + 1), count);
+    pat  = sstr_alloc(length);
+    if (strs == NULL || arr == NULL || pat == NULL)
+    {
+        fputs("Out of memory\n", stderr);
+        exit(1);
+    }
+
+    /* the pattern has the same length as all strings in the array */
+    fill_chars(pat->chars, length, count);
+    pat->len = length;
+
+    start = now_sec();
+    for (idx = 0; idx < count; ++idx)
+    {
+        strs[idx] = sstr_alloc(length);
+        if (strs[idx] == NULL)
+        {
+            fputs("Out of memory\n", stderr);
+            exit(1);
+        }
+        fill_chars(strs[idx]->chars, length, idx);
+        strs[idx]->len = length;
+    }
+    dspTime("sstring* build", now_sec() - start, count);
+
+    start = now_sec();
+    for (idx = 0; idx < count; ++idx)
+    {
+        sstr_array_appd(strs[idx], arr);
+    }
+    dspTime("sstr_array build", now_sec() - start, count);
+
+    start = now_sec();
+    sum = 0;
+    for (idx = 0; idx < count; ++idx)
+    {
+        sum += strs[idx]->len + (unsigned char) strs[idx]->chars[0];
+    }
+    bench_sink = sum;
+    dspTime("sstring* iterate", now_sec() - start, count);
+
+    start = now_sec();
+    sum = 0;
+    for (idx = 0; idx < count; ++idx)
+    {
+        sstr_array_view(arr, &view, idx);
+        sum += view.len + (unsigned char) view.chars[0];
+    }
+    bench_sink = sum;
+    dspTime("sstr_array iterate", now_sec() - start, count);
+
+    start = now_sec();
+    sum = 0;
+    for (idx = 0; idx < count; ++idx)
+    {
+        sum += sstr_cmp(strs[idx], pat);
+    }
+    bench_sink = sum;
+    dspTime("sstring* compare", now_sec() - start, count);
+
+    start = now_sec();
+    sum = 0;
+    for (idx = 0; idx < count; ++idx)
+    {
+        sstr_array_view(arr, &view, idx);
+        sum += sstr_cmp(&view, pat);
+    }
+    bench_sink = sum;
+    dspTime("sstr_array compare", now_sec() - start, count);
+
+    start = now_sec();
+    for (idx = 0; idx < count; ++idx)
+    {
+        sstr_wipe(strs[idx]);
+        sstr_dealloc(strs[idx]);
+    }
+    dspTime("sstring* wipe+free", now_sec() - start, count);
+
+    start = now_sec();
+    sstr_array_wipe(arr);
+    sstr_array_dealloc(arr);
+    dspTime("sstr_array wipe+free", now_sec() - start, count);
+
+    sstr_dealloc(pat);
+    free(strs);
+}
+
+/**
+ * sstr_hash and sstr_hash_fast throughput across input sizes
+ */
+void bench_sstrHash(void)
+{
+    static const size_t sizes[] = { 8, 16, 32, 64, 256, 1024, 4096, 65536, 1048576 };
+
+    sString*     str;
+    sstr_hashval hash;
+    char         label[32];
+    double       start;
+    size_t       rounds;
+    size_t       size_idx;
+    size_t       idx;
+
+    str = sstr_alloc(sizes[sizeof (sizes) / sizeof (sizes[0]) - 1]);
+    if (str == NULL)
+    {
+        fputs("Out of memory\n", stderr);
+        exit(1);
+    }
+
+    for (size_idx = 0; size_idx < sizeof (sizes) / sizeof (sizes[0]); ++size_idx)
+    {
+        fill_chars(str->chars, sizes[size_idx], size_idx);
+        str->len = sizes[size_idx];
+        /* hash about 256 MiB per measurement */
+        rounds = ((size_t) 1 << 28) / sizes[size_idx];
+
+        start = now_sec();
+        for (idx = 0; idx < rounds; ++idx)
+        {
+            str->chars[0] = (char) idx;
+            sstr_hash(str, &hash);
+            bench_sink = hash;
+        }
+        snprintf(label, sizeof (label), "sstr_hash %zu", sizes[size_idx]);
+        dspRate(label, now_sec() - start, rounds * sizes[size_idx]);
+
+        start = now_sec();
+        for (idx = 0; idx < rounds; ++idx)
+        {
+            str->chars[0] = (char) idx;
+            sstr_hash_fast(str, &hash);
+            bench_sink = hash;
+        }
+        snprintf(label, sizeof (label), "sstr_hash_fast %zu", sizes[size_idx]);
+        dspRate(label, now_sec() - start, rounds * sizes[size_idx]);
+    }
+
+    sstr_dealloc(str);
+}
+
+/* shared state of the sstrVault benchmark */
+#define VAULT_KEYS       1024
+#define VAULT_LOOKUPS    1000000
+
+sstr_vault*     vault_bench;
+sstr_map*       mutex_map;
+pthread_mutex_t mutex_map_lock = PTHREAD_MUTEX_INITIALIZER;
+sString*        vault_keys[VAULT_KEYS];
+
+/**
+ * sstr_vault reader scaling vs. a mutex-protected sstr_map
+ */
+void bench_sstrVault(
+    size_t max_threads
+)
+{
+    pthread_t* threads;
+    sString*   value;
+    char       label[48];
+    double     start;
+    size_t     thread_count;
+    size_t     idx;
+
+    threads     = malloc((max_threads > 0 ? max_threads : 1) * sizeof (pthread_t));
+    vault_bench = sstr_vault_alloc();
+    mutex_map   = sstr_map_alloc(VAULT_KEYS);
+    value       = sstr_alloc(32);
+    if (threads == NULL || vault_bench == NULL || mutex_map == NULL || value == NULL)
+    {
+        fputs("Out of memory\n", stderr);
+        exit(1);
+    }
+
+    fill_chars(value->chars, 32, 0);
+    value->len = 32;
+    for (idx = 0; idx < VAULT_KEYS; ++idx)
+    {
+        vault_keys[idx] = sstr_alloc(16);
+        if (vault_keys[idx] == NULL)
+        {
+            fputs("Out of memory\n", stderr);
+            exit(1);
+        }
+        fill_chars(vault_keys[idx]->chars, 16, idx);
+        vault_keys[idx]->len = 16;
+        sstr_vault_put(vault_keys[idx], value, vault_bench);
+        sstr_map_put(vault_keys[idx], value, mutex_map);
+    }
+
+    for (thread_count = 1; thread_count <= max_threads; ++thread_count)
+    {
+        start = now_sec();
+        for (idx = 0; idx < thread_count; ++idx)
+        {
+            pthread_create(&threads[idx], NULL, vault_reader, NULL);
+        }
+        for (idx = 0; idx < thread_count; ++idx)
+        {
+            pthread_join(threads[idx], NULL);
+        }
+        snprintf(label, sizeof (label), "sstr_vault %zu threads", thread_count);
+        dspTime(label, now_sec() - start, thread_count * VAULT_LOOKUPS);
+
+        start = now_sec();
+        for (idx = 0; idx < thread_count; ++idx)
+        {
+            pthread_create(&threads[idx], NULL, mutex_reader, NULL);
+        }
+        for (idx = 0; idx < thread_count; ++idx)
+        {
+            pthread_join(threads[idx], NULL);
+        }
+        snprintf(label, sizeof (label), "mutex+map %zu threads", thread_count);
+        dspTime(label, now_sec() - start, thread_count * VAULT_LOOKUPS);
+    }
+
+    for (idx = 0; idx < VAULT_KEYS; ++idx)
+    {
+        sstr_dealloc(vault_keys[idx]);
+    }
+    sstr_vault_dealloc(vault_bench);
+    sstr_map_dealloc(mutex_map);
+    sstr_dealloc(value);
+    free(threads);
+}
+
+void* vault_reader(
+    void* arg
+)
+{
+    sstr_vault_ticket ticket;
+    const sString*    value;
+    size_t            sum;
+    size_t            idx;
+
+    (void) arg;
+    sum = 0;
+    for (idx = 0; idx < VAULT_LOOKUPS; ++idx)
+    {
+        sstr_vault_enter(vault_bench, &ticket);
+        value = sstr_vault_find(&ticket, vault_keys[idx % VAULT_KEYS]);
+        sum += (unsigned char) value->chars[0];
+        sstr_vault_leave(vault_bench, &ticket);
+    }
+    bench_sink = sum;
+
+    return NULL;
+}
+
+void* mutex_reader(
+    void* arg
+)
+{
+    const sString* value;
+    size_t         sum;
+    size_t         idx;
+
+    (void) arg;
+    sum = 0;
+    for (idx = 0; idx < VAULT_LOOKUPS; ++idx)
+    {
+        pthread_mutex_lock(&mutex_map_lock);
+        value = sstr_map_get(mutex_map, vault_keys[idx % VAULT_KEYS]);
+        sum += (unsigned char) value->chars[0];
+        pthread_mutex_unlock(&mutex_map_lock);
+    }
+    bench_sink = sum;
+
+    return NULL;
+}
+
+/* number of values formatted per measurement */
+#define APPDNUM_VALUES   1000000
+
+/**
+ * sstr_appd_u64 / sstr_appd_double vs. snprintf
+ */
+void bench_sstrAppdNum(void)
+{
+    uint64_t* ints;
+    double*   dbls;
+    sString*  str;
+    char      buf[32];
+    double    start;
+    size_t    idx;
+
+    ints = malloc(APPDNUM_VALUES * sizeof (uint64_t));
+    dbls = malloc(APPDNUM_VALUES * sizeof (double));
+    str  = sstr_alloc(32);
+    if (ints == NULL || dbls == NULL || str == NULL)
+    {
+        fputs("Out of memory\n", stderr);
+        exit(1);
+    }
+
+    /* integers of mixed lengths, doubles of mixed magnitudes */
+    srand(1);
+    for (idx = 0; idx < APPDNUM_VALUES; ++idx)
+    {
+        ints[idx] = (((uint64_t) rand() << 32) ^ (uint64_t) rand()) >> (idx % 64);
+        dbls[idx] = ((double) rand() / RAND_MAX) * ((idx % 2) == 0 ? 1e6 : 1e-3);
+    }
+
+    start = now_sec();
+    for (idx = 0; idx < APPDNUM_VALUES; ++idx)
+    {
+        str->len = 0;
+        sstr_appd_u64(ints[idx], str);
+        bench_sink = str->len;
+    }
+    dspTime("sstr_appd_u64", now_sec() - start, APPDNUM_VALUES);
+
+    start = now_sec();
+    for (idx = 0; idx < APPDNUM_VALUES; ++idx)
+    {
+        bench_sink = (size_t) snprintf(buf, sizeof (buf), "%llu",
+                                       (unsigned long long) ints[idx]);
+    }
+    dspTime("snprintf %llu", now_sec() - start, APPDNUM_VALUES);
+
+    start = now_sec();
+    for (idx = 0; idx < APPDNUM_VALUES; ++idx)
+    {
+        str->len = 0;
+        sstr_appd_double(dbls[idx], str);
+        bench_sink = str->len;
+    }
+    dspTime("sstr_appd_double", now_sec() - start, APPDNUM_VALUES);
+
+    /* %.17g always round-trips, but is not the shortest representation */
+    start = now_sec();
+    for (idx = 0; idx < APPDNUM_VALUES; ++idx)
+    {
+        bench_sink = (size_t) snprintf(buf, sizeof (buf), "%.17g", dbls[idx]);
+    }
+    dspTime("snprintf %.17g", now_sec() - start, APPDNUM_VALUES);
+
+    sstr_dealloc(str);
+    free(dbls);
+    free(ints);
+}
+
+/**
+ * sstr_to_u64 / sstr_to_double vs. strtoull / strtod
+ */
+void bench_sstrToNum(void)
+{
+    sString** ints;
+    sString** dbls;
+    uint64_t  int_value;
+    double    dbl_value;
+    double    start;
+    size_t    idx;
+
+    ints = malloc(APPDNUM_VALUES * sizeof (sString*));
+    dbls = malloc(APPDNUM_VALUES * sizeof (sString*));
+    if (ints == NULL || dbls == NULL)
+    {
+        fputs("Out of memory\n", stderr);
+        exit(1);
+    }
+
+    /* the strings produced by the sstrAppdNum benchmark */
+    srand(1);
+    for (idx = 0; idx < APPDNUM_VALUES; ++idx)
+    {
+        ints[idx] = sstr_alloc(32);
+        dbls[idx] = sstr_alloc(32);
+        if (ints[idx] == NULL || dbls[idx] == NULL)
+        {
+            fputs("Out of memory\n", stderr);
+            exit(1);
+        }
+        sstr_appd_u64((((uint64_t) rand() << 32) ^ (uint64_t) rand()) >> (idx % 64),
+                      ints[idx]);
+        sstr_appd_double(((double) rand() / RAND_MAX) *
+                         ((idx % 2) == 0 ? 1e6 : 1e-3), dbls[idx]);
+    }
+
+    start = now_sec();
+    for (idx = 0; idx < APPDNUM_VALUES; ++idx)
+    {
+        sstr_to_u64(ints[idx], &int_value);
+        bench_sink = (size_t) int_value;
+    }
+    dspTime("sstr_to_u64", now_sec() - start, APPDNUM_VALUES);
+
+    start = now_sec();
+    for (idx = 0; idx < APPDNUM_VALUES; ++idx)
+    {
+        bench_sink = (size_t) strtoull(ints[idx]->chars, NULL, 10);
+    }
+    dspTime("strtoull", now_sec() - start, APPDNUM_VALUES);
+
+    start = now_sec();
+    for (idx = 0; idx < APPDNUM_VALUES; ++idx)
+    {
+        sstr_to_double(dbls[idx], &dbl_value);
+        bench_sink = (size_t) dbl_value;
+    }
+    dspTime("sstr_to_double", now_sec() - start, APPDNUM_VALUES);
+
+    start = now_sec();
+    for (idx = 0; idx < APPDNUM_VALUES; ++idx)
+    {
+        bench_sink = (size_t) strtod(dbls[idx]->chars, NULL);
+    }
+    dspTime("strtod", now_sec() - start, APPDNUM_VALUES);
+
+    for (idx = 0; idx < APPDNUM_VALUES; ++idx)
+    {
+        sstr_dealloc(ints[idx]);
+        sstr_dealloc(dbls[idx]);
+    }
+    free(dbls);
+    free(ints);
+}
+
+/**
+ * hex and Base64 encoding and decoding throughput
+ */
+void bench_sstrCodec(
+    size_t length
+)
+{
+    sString* src;
+    sString* hex;
+    sString* b64;
+    sString* dst;
+    double   start;
+    size_t   rounds;
+    size_t   idx;
+
+    src = sstr_alloc(length);
+    hex = sstr_alloc(length * 2);
+    b64 = sstr_alloc((length + 2) / 3 * 4);
+    dst = sstr_alloc(length);
+    if (src == NULL || hex == NULL || b64 == NULL || dst == NULL)
+    {
+        fputs("Out of memory\n", stderr);
+        exit(1);
+    }
+    fill_chars(src->chars, length, 1);
+    src->len = length;
+    /* process about 256 MiB per measurement */
+    rounds = ((size_t) 1 << 28) / (length + 1) + 1;
+
+    start = now_sec();
+    for (idx = 0; idx < rounds; ++idx)
+    {
+        sstr_hex_encode(src, hex);
+    }
+    dspRate("sstr_hex_encode", now_sec() - start, rounds * length);
+
+    start = now_sec();
+    for (idx = 0; idx < rounds; ++idx)
+    {
+        sstr_hex_decode(hex, dst);
+    }
+    dspRate("sstr_hex_decode", now_sec() - start, rounds * length);
+
+    start = now_sec();
+    for (idx = 0; idx < rounds; ++idx)
+    {
+        sstr_b64_encode(src, b64);
+    }
+    dspRate("sstr_b64_encode", now_sec() - start, rounds * length);
+
+    start = now_sec();
+    for (idx = 0; idx < rounds; ++idx)
+    {
+        sstr_b64_decode(b64, dst);
+    }
+    dspRate("sstr_b64_decode", now_sec() - start, rounds * length);
+
+    bench_sink = dst->len;
+
+    sstr_dealloc(dst);
+    sstr_dealloc(b64);
+    sstr_dealloc(hex);
+    sstr_dealloc(src);
+}
+
+/**
+ * UTF-8 validation and code point counting throughput
+ * on ASCII input and on input with a 2 byte code point every 8 bytes
+ */
+void bench_sstrUtf8(
+    size_t length
+)
+{
+    sString* src;
+    double   start;
+    size_t   rounds;
+    size_t   idx;
+
+    src = sstr_alloc(length);
+    if (src == NULL)
+    {
+        fputs("Out of memory\n", stderr);
+        exit(1);
+    }
+    fill_chars(src->chars, length, 1);
+    src->len = length;
+    /* process about 1 GiB per measurement */
+    rounds = ((size_t) 1 << 30) / (length + 1) + 1;
+
+    start = now_sec();
+    for (idx = 0; idx < rounds; ++idx)
+    {
+        bench_sink += (size_t) sstr_utf8_validate(src);
+    }
+    dspRate("sstr_utf8_validate ASCII", now_sec() - start, rounds * length);
+
+    start = now_sec();
+    for (idx = 0; idx < rounds; ++idx)
+    {
+        bench_sink += sstr_utf8_count(src);
+    }
+    dspRate("sstr_utf8_count ASCII", now_sec() - start, rounds * length);
+
+    /* U+00E9 */
+    for (idx = 0; idx + 8 <= length; idx += 8)
+    {
+        src->chars[idx + 6] = (char) 0xC3;
+        src->chars[idx + 7] = (char) 0xA9;
+    }
+
+    start = now_sec();
+    for (idx = 0; idx < rounds; ++idx)
+    {
+        bench_sink += (size_t) sstr_utf8_validate(src);
+    }
+    dspRate("sstr_utf8_validate mixed", now_sec() - start, rounds * length);
+
+    start = now_sec();
+    for (idx = 0; idx < rounds; ++idx)
+    {
+        bench_sink += sstr_utf8_count(src);
+    }
+    dspRate("sstr_utf8_count mixed", now_sec() - start, rounds * length);
+
+    sstr_dealloc(src);
+}
+
+/**
+ * case conversion and case-insensitive comparison throughput,
+ * compared with lowercasing a copy per byte and sstr_cmp
+ */
+void bench_sstrCase(
+    size_t length
+)
+{
+    sString* src;
+    sString* pat;
+    sString* tmp_src;
+    sString* tmp_pat;
+    double   start;
+    size_t   rounds;
+    size_t   idx;
+    size_t   pos;
+    char     chr;
+
+    src     = sstr_alloc(length);
+    pat     = sstr_alloc(length);
+    tmp_src = sstr_alloc(length);
+    tmp_pat = sstr_alloc(length);
+    if (src == NULL || pat == NULL || tmp_src == NULL || tmp_pat == NULL)
+    {
+        fputs("Out of memory\n", stderr);
+        exit(1);
+    }
+    fill_chars(src->chars, length, 1);
+    src->len = length;
+    sstr_cpy(src, pat);
+    sstr_toupper(pat);
+    /* process about 256 MiB per measurement */
+    rounds = ((size_t) 1 << 28) / (length + 1) + 1;
+
+    start = now_sec();
+    for (idx = 0; idx < rounds; ++idx)
+    {
+        sstr_tolower(src);
+        sstr_toupper(src);
+    }
+    dspRate("sstr_tolower/toupper", now_sec() - start, rounds * length * 2);
+
+    start = now_sec();
+    for (idx = 0; idx < rounds; ++idx)
+    {
+        sstr_cpy(src, tmp_src);
+        sstr_cpy(pat, tmp_pat);
+        for (pos = 0; pos < length; ++pos)
+        {
+            sstr_getchar(tmp_src, &chr, pos);
+            sstr_setchar((char) tolower((unsigned char) chr), tmp_src, pos);
+            sstr_getchar(tmp_pat, &chr, pos);
+            sstr_setchar((char) tolower((unsigned char) chr), tmp_pat, pos);
+        }
+        bench_sink += (size_t) sstr_cmp(tmp_src, tmp_pat);
+    }
+    dspRate("lowercase copy + sstr_cmp", now_sec() - start, rounds * length);
+
+    start = now_sec();
+    for (idx = 0; idx < rounds; ++idx)
+    {
+        bench_sink += (size_t) sstr_casecmp(src, pat);
+    }
+    dspRate("sstr_casecmp", now_sec() - start, rounds * length);
+
+    /* search for the last 16 chars in uppercase */
+    if (length >= 16)
+    {
+        sstr_substr(pat, tmp_pat, length - 16, 16);
+        start = now_sec();
+        for (idx = 0; idx < rounds; ++idx)
+        {
+            bench_sink += sstr_caseindexof(src, tmp_pat);
+        }
+        dspRate("sstr_caseindexof", now_sec() - start, rounds * length);
+    }
+
+    sstr_dealloc(tmp_pat);
+    sstr_dealloc(tmp_src);
+    sstr_dealloc(pat);
+    sstr_dealloc(src);
+}
+
+/**
+ * trimming and stripping throughput, compared with finding the
+ * trimmed range per byte and copying it with sstr_substr
+ */
+void bench_sstrClass(
+    size_t length
+)
+{
+    sString* src;
+    sString* tmp;
+    sString* dst;
+    double   start;
+    size_t   rounds;
+    size_t   idx;
+    size_t   first;
+    size_t   last;
+    size_t   pad;
+    char     chr;
+
+    src = sstr_alloc(length);
+    tmp = sstr_alloc(length);
+    dst = sstr_alloc(length);
+    if (src == NULL || tmp == NULL || dst == NULL)
+    {
+        fputs("Out of memory\n", stderr);
+        exit(1);
+    }
+    /* text padded with whitespace, with a control character every 64 chars */
+    fill_chars(src->chars, length, 1);
+    src->len = length;
+    pad = length / 8;
+    for (idx = 0; idx < pad; ++idx)
+    {
+        src->chars[idx] = ' ';
+        src->chars[length - 1 - idx] = (idx % 2 == 0 ? '\t' : ' ');
+    }
+    for (idx = pad; idx + 64 <= length - pad; idx += 64)
+    {
+        src->chars[idx + 63] = '\r';
+    }
+    /* process about 256 MiB per measurement */
+    rounds = ((size_t) 1 << 28) / (length + 1) + 1;
+
+    start = now_sec();
+    for (idx = 0; idx < rounds; ++idx)
+    {
+        sstr_cpy(src, tmp);
+        first = 0;
+        while (sstr_getchar(tmp, &chr, first) == SSTR_PASS && isspace((unsigned char) chr))
+        {
+            ++first;
+        }
+        last = tmp->len;
+        while (last > first && sstr_getchar(tmp, &chr, last - 1) == SSTR_PASS &&
+               isspace((unsigned char) chr))
+        {
+            --last;
+        }
+        sstr_substr(tmp, dst, first, last - first);
+        bench_sink += dst->len;
+    }
+    dspRate("getchar + sstr_substr", now_sec() - start, rounds * length);
+
+    start = now_sec();
+    for (idx = 0; idx < rounds; ++idx)
+    {
+        sstr_cpy(src, tmp);
+        sstr_trim(tmp);
+        bench_sink += tmp->len;
+    }
+    dspRate("cpy + sstr_trim", now_sec() - start, rounds * length);
+
+    start = now_sec();
+    for (idx = 0; idx < rounds; ++idx)
+    {
+        sstr_cpy(src, tmp);
+        sstr_strip_class(&SSTR_CLASS_CNTRL, tmp);
+        bench_sink += tmp->len;
+    }
+    dspRate("cpy + sstr_strip_class", now_sec() - start, rounds * length);
+
+    sstr_dealloc(dst);
+    sstr_dealloc(tmp);
+    sstr_dealloc(src);
+}
+
+/**
+ * JSON and URL escaping throughput on input without escapes, compared
+ * with memcpy, and on input with an escaped character every 64 chars
+ */
+void bench_sstrEscape(
+    size_t length
+)
+{
+    sString* src;
+    sString* esc;
+    sString* dst;
+    double   start;
+    size_t   rounds;
+    size_t   idx;
+
+    src = sstr_alloc(length);
+    esc = sstr_alloc(length * 6);
+    dst = sstr_alloc(length);
+    if (src == NULL || esc == NULL || dst == NULL)
+    {
+        fputs("Out of memory\n", stderr);
+        exit(1);
+    }
+    fill_chars(src->chars, length, 1);
+    src->len = length;
+    /* process about 256 MiB per measurement */
+    rounds = ((size_t) 1 << 28) / (length + 1) + 1;
+
+    start = now_sec();
+    for (idx = 0; idx < rounds; ++idx)
+    {
+        memcpy(dst->chars, src->chars, length);
+        bench_sink += (size_t) dst->chars[idx % (length + 1)];
+    }
+    dspRate("memcpy", now_sec() - start, rounds * length);
+
+    start = now_sec();
+    for (idx = 0; idx < rounds; ++idx)
+    {
+        sstr_json_escape(src, esc);
+    }
+    dspRate("sstr_json_escape", now_sec() - start, rounds * length);
+
+    start = now_sec();
+    for (idx = 0; idx < rounds; ++idx)
+    {
+        sstr_url_encode(src, esc);
+    }
+    dspRate("sstr_url_encode", now_sec() - start, rounds * length);
+
+    for (idx = 63; idx < length; idx += 64)
+    {
+        src->chars[idx] = '"';
+    }
+
+    start = now_sec();
+    for (idx = 0; idx < rounds; ++idx)
+    {
+        sstr_json_escape(src, esc);
+    }
+    dspRate("sstr_json_escape 1/64", now_sec() - start, rounds * length);
+
+    start = now_sec();
+    for (idx = 0; idx < rounds; ++idx)
+    {
+        sstr_json_unescape(esc, dst);
+    }
+    dspRate("sstr_json_unescape 1/64", now_sec() - start, rounds * length);
+
+    sstr_url_encode(src, esc);
+    start = now_sec();
+    for (idx = 0; idx < rounds; ++idx)
+    {
+        sstr_url_decode(esc, dst);
+    }
+    dspRate("sstr_url_decode 1/64", now_sec() - start, rounds * length);
+
+    sstr_dealloc(dst);
+    sstr_dealloc(esc);
+    sstr_dealloc(src);
+}
+
+/**
+ * line reading throughput on a temporary file of about 256 MiB,
+ * compared with getline
+ */
+void bench_sstrLineReader(
+    size_t length
+)
+{
+    sString*         line;
+    sstr_linereader* reader;
+    const sString*   view;
+    FILE*            file;
+    int              fd;
+    char*            buf;
+    size_t           buf_size;
+    size_t           lines;
+    size_t           idx;
+    size_t           total;
+    double           start;
+
+    line = sstr_alloc(length);
+    file = tmpfile();
+    if (line == NULL || file == NULL)
+    {
+        fputs("Out of memory\n", stderr);
+        exit(1);
+    }
+    fd = fileno(file);
+    fill_chars(line->chars, length, 1);
+    line->len = length;
+    line->chars[length - 1] = '\n';
+    lines = ((size_t) 1 << 28) / (length + 1) + 1;
+    for (idx = 0; idx < lines; ++idx)
+    {
+        sstr_write_fd(line, fd);
+    }
+    total = lines * length;
+
+    lseek(fd, 0, SEEK_SET);
+    start = now_sec();
+    buf = NULL;
+    buf_size = 0;
+    while (getline(&buf, &buf_size, file) > 0)
+    {
+        bench_sink += (size_t) buf[0];
+    }
+    dspRate("getline", now_sec() - start, total);
+    free(buf);
+
+    lseek(fd, 0, SEEK_SET);
+    start = now_sec();
+    reader = sstr_linereader_open(fd, 65536);
+    while (sstr_linereader_view(reader, &view) == SSTR_TRUE)
+    {
+        bench_sink += view->len;
+    }
+    sstr_linereader_close(reader);
+    dspRate("sstr_linereader_view", now_sec() - start, total);
+
+    lseek(fd, 0, SEEK_SET);
+    start = now_sec();
+    reader = sstr_linereader_open(fd, 65536);
+    while (sstr_linereader_copy(reader, line) == SSTR_TRUE)
+    {
+        bench_sink += line->len;
+    }
+    sstr_linereader_close(reader);
+    dspRate("sstr_linereader_copy", now_sec() - start, total);
+
+    fclose(file);
+    sstr_dealloc(line);
+}
+
+/**
+ * sstr_map_file vs. reading a file into a secureString, each followed
+ * by a search for a pattern that does not occur in the file
+ */
+void bench_sstrMapFile(
+    size_t length
+)
+{
+    sString*       data;
+    sString*       pattern;
+    sstr_mapping*  mapping;
+    char           path[] = "/tmp/libbench_XXXXXX";
+    int            fd;
+    size_t         rounds;
+    size_t         idx;
+    double         start;
+
+    data = sstr_alloc(length);
+    pattern = sstr_alloc(8);
+    fd = mkstemp(path);
+    if (data == NULL || pattern == NULL || fd < 0)
+    {
+        fputs("Out of memory\n", stderr);
+        exit(1);
+    }
+    fill_chars(data->chars, length, 1);
+    data->len = length;
+    sstr_write_fd(data, fd);
+    close(fd);
+    sstr_cpycstr("~~~~~~~~", pattern, 8);
+    rounds = ((size_t) 1 << 30) / (length + 1) + 1;
+
+    start = now_sec();
+    for (idx = 0; idx < rounds; ++idx)
+    {
+        fd = open(path, O_RDONLY);
+        sstr_read_fd(fd, data);
+        close(fd);
+        bench_sink += sstr_indexof(data, pattern);
+    }
+    dspRate("sstr_read_fd+indexof", now_sec() - start, rounds * length);
+
+    start = now_sec();
+    for (idx = 0; idx < rounds; ++idx)
+    {
+        mapping = sstr_map_file(path);
+        bench_sink += sstr_indexof(sstr_mapping_str(mapping), pattern);
+        sstr_unmap_file(mapping);
+    }
+    dspRate("sstr_map_file+indexof", now_sec() - start, rounds * length);
+
+    unlink(path);
+    sstr_dealloc(pattern);
+    sstr_dealloc(data);
+}
+
+/**
+ * sstr_cpyf vs. snprintf into a temporary buffer followed by a copy
+ * into a secureString
+ */
+void bench_sstrFormat(void)
+{
+    uint64_t* ints;
+    sString*  str;
+    sString*  user;
+    char      buf[128];
+    double    start;
+    size_t    idx;
+
+    ints = malloc(APPDNUM_VALUES * sizeof (uint64_t));
+    str  = sstr_alloc(128);
+    user = sstr_alloc(16);
+    if (ints == NULL || str == NULL || user == NULL)
+    {
+        fputs("Out of memory\n", stderr);
+        exit(1);
+    }
+    sstr_cpycstr("alice", user, 5);
+
+    srand(1);
+    for (idx = 0; idx < APPDNUM_VALUES; ++idx)
+    {
+        ints[idx] = (((uint64_t) rand() << 32) ^ (uint64_t) rand()) >> (idx % 64);
+    }
+
+    start = now_sec();
+    for (idx = 0; idx < APPDNUM_VALUES; ++idx)
+    {
+        snprintf(buf, sizeof (buf), "user=%s seq=%llu id=%08x rc=%d\n",
+                 user->chars, (unsigned long long) ints[idx],
+                 (unsigned int) idx, (int) (idx % 7) - 3);
+        sstr_cpycstr(buf, str, strlen(buf));
+        bench_sink = str->len;
+    }
+    dspTime("snprintf+sstr_cpycstr", now_sec() - start, APPDNUM_VALUES);
+
+    start = now_sec();
+    for (idx = 0; idx < APPDNUM_VALUES; ++idx)
+    {
+        sstr_cpyf(str, "user=%S seq=%llu id=%08x rc=%d\n",
+                  user, (unsigned long long) ints[idx],
+                  (unsigned int) idx, (int) (idx % 7) - 3);
+        bench_sink = str->len;
+    }
+    dspTime("sstr_cpyf", now_sec() - start, APPDNUM_VALUES);
+
+    sstr_dealloc(user);
+    sstr_dealloc(str);
+    free(ints);
+}
+
+/**
+ * sstr_wipe, sstr_cpy and sstr_indexof vs. their sstr_pool counterparts
+ * with 1 to max_threads threads
+ */
+void bench_sstrPool(
+    size_t length,
+    size_t max_threads
+)
+{
+    sString*   src;
+    sString*   dst;
+    sString*   pattern;
+    sstr_pool* pool;
+    char       label[32];
+    double     start;
+    size_t     rounds;
+    size_t     idx;
+    size_t     thread_count;
+
+    src = sstr_alloc(length);
+    dst = sstr_alloc(length);
+    pattern = sstr_alloc(8);
+    if (src == NULL || dst == NULL || pattern == NULL)
+    {
+        fputs("Out of memory\n", stderr);
+        exit(1);
+    }
+    fill_chars(src->chars, length, 1);
+    src->len = length;
+    sstr_cpycstr("~~~~~~~~", pattern, 8);
+    /* process about 1 GiB per measurement */
+    rounds = ((size_t) 1 << 30) / (length + 1) + 1;
+
+    start = now_sec();
+    for (idx = 0; idx < rounds; ++idx)
+    {
+        sstr_wipe(dst);
+    }
+    dspRate("sstr_wipe", now_sec() - start, rounds * length);
+
+    start = now_sec();
+    for (idx = 0; idx < rounds; ++idx)
+    {
+        sstr_cpy(src, dst);
+    }
+    dspRate("sstr_cpy", now_sec() - start, rounds * length);
+
+    start = now_sec();
+    for (idx = 0; idx < rounds; ++idx)
+    {
+        bench_sink += sstr_indexof(src, pattern);
+    }
+    dspRate("sstr_indexof", now_sec() - start, rounds * length);
+
+    for (thread_count = 1; thread_count <= max_threads; ++thread_count)
+    {
+        pool = sstr_pool_alloc(thread_count, 0);
+        if (pool == NULL)
+        {
+            fputs("Out of memory\n", stderr);
+            exit(1);
+        }
+
+        start = now_sec();
+        for (idx = 0; idx < rounds; ++idx)
+        {
+            sstr_pool_wipe(pool, dst);
+        }
+        snprintf(label, sizeof (label), "wipe %zu threads", thread_count);
+        dspRate(label, now_sec() - start, rounds * length);
+
+        start = now_sec();
+        for (idx = 0; idx < rounds; ++idx)
+        {
+            sstr_pool_cpy(pool, src, dst);
+        }
+        snprintf(label, sizeof (label), "cpy %zu threads", thread_count);
+        dspRate(label, now_sec() - start, rounds * length);
+
+        start = now_sec();
+        for (idx = 0; idx < rounds; ++idx)
+        {
+            bench_sink += sstr_pool_indexof(pool, src, pattern);
+        }
+        snprintf(label, sizeof (label), "indexof %zu threads", thread_count);
+        dspRate(label, now_sec() - start, rounds * length);
+
+        sstr_pool_dealloc(pool);
+    }
+
+    sstr_dealloc(pattern);
+    sstr_dealloc(dst);
+    sstr_dealloc(src);
+}
+
+/**
+ * sstr_indexof in a loop vs. sstr_indexof_batch with 1 to max_threads
+ * threads, searching count strings for a pattern that does not occur
+ */
+void bench_sstrIndexOfBatch(
+    size_t count,
+    size_t length,
+    size_t max_threads
+)
+{
+    sString**  strs;
+    sString*   pattern;
+    sstr_pos*  results;
+    sstr_pool* pool;
+    char       label[32];
+    double     start;
+    size_t     idx;
+    size_t     thread_count;
+
+    strs = malloc((count > 0 ? count : 1) * sizeof (sString*));
+    results = malloc((count > 0 ? count : 1) * sizeof (sstr_pos));
+    pattern = sstr_alloc(16);
+    if (strs == NULL || results == NULL || pattern == NULL)
+    {
+        fputs("Out of memory\n", stderr);
+        exit(1);
+    }
+    for (idx = 0; idx < count; ++idx)
+    {
+        strs[idx] = sstr_alloc(length);
+        if (strs[idx] == NULL)
+        {
+            fputs("Out of memory\n", stderr);
+            exit(1);
+        }
+        fill_chars(strs[idx]->chars, length, idx);
+        strs[idx]->len = length;
+    }
+    sstr_cpycstr("klmnopqrstuvwxy~", pattern, 16);
+
+    start = now_sec();
+    for (idx = 0; idx < count; ++idx)
+    {
+        results[idx] = sstr_indexof(strs[idx], pattern);
+    }
+    dspRate("sstr_indexof loop", now_sec() - start, count * length);
+
+    for (thread_count = 1; thread_count <= max_threads; ++thread_count)
+    {
+        pool = sstr_pool_alloc(thread_count, 0);
+        if (pool == NULL)
+        {
+            fputs("Out of memory\n", stderr);
+            exit(1);
+        }
+
+        start = now_sec();
+        sstr_indexof_batch(pool, (const sString* const*) strs, count,
+                           (const sString* const*) &pattern, 1, results);
+        snprintf(label, sizeof (label), "batch %zu threads", thread_count);
+        dspRate(label, now_sec() - start, count * length);
+
+        sstr_pool_dealloc(pool);
+    }
+
+    for (idx = 0; idx < count; ++idx)
+    {
+        sstr_dealloc(strs[idx]);
+    }
+    sstr_dealloc(pattern);
+    free(results);
+    free(strs);
+}
+
+/**
+ * Time spent by the calling thread in sstr_wipe and sstr_dealloc
+ * vs. sstr_dealloc_deferred, and the time for the following flush
+ */
+void bench_sstrDeallocDeferred(
+    size_t length
+)
+{
+    sString** strs;
+    double    start;
+    double    elapsed;
+    size_t    count;
+    size_t    idx;
+
+    /* about 256 MiB of strings */
+    count = ((size_t) 1 << 28) / (length + 1) + 1;
+    strs = malloc(count * sizeof (sString*));
+    if (strs == NULL)
+    {
+        fputs("Out of memory\n", stderr);
+        exit(1);
+    }
+
+    for (idx = 0; idx < count; ++idx)
+    {
+        strs[idx] = sstr_alloc(length);
+        if (strs[idx] == NULL)
+        {
+            fputs("Out of memory\n", stderr);
+            exit(1);
+        }
+        fill_chars(strs[idx]->chars, length, idx);
+        strs[idx]->len = length;
+    }
+    start = now_sec();
+    for (idx = 0; idx < count; ++idx)
+    {
+        sstr_wipe(strs[idx]);
+        sstr_dealloc(strs[idx]);
+    }
+    dspTime("sstr_wipe+sstr_dealloc", now_sec() - start, count);
+
+    for (idx = 0; idx < count; ++idx)
+    {
+        strs[idx] = sstr_alloc(length);
+        if (strs[idx] == NULL)
+        {
+            fputs("Out of memory\n", stderr);
+            exit(1);
+        }
+        fill_chars(strs[idx]->chars, length, idx);
+        strs[idx]->len = length;
+    }
+    start = now_sec();
+    for (idx = 0; idx < count; ++idx)
+    {
+        sstr_dealloc_deferred(strs[idx]);
+    }
+    elapsed = now_sec() - start;
+    dspTime("sstr_dealloc_deferred", elapsed, count);
+
+    start = now_sec();
+    sstr_dealloc_flush();
+    dspTime("sstr_dealloc_flush", now_sec() - start, 1);
+
+    free(strs);
+}
+
+/**
+ * Looking up a string in a set of strings of mixed lengths:
+ * sstr_cmp for each entry vs. sstr_cmp_any and sstr_cmp_any_ct
+ */
+void bench_sstrCmpAny(
+    size_t count,
+    size_t length
+)
+{
+    sstr_array* arr;
+    sString**   pats;
+    sString*    str;
+    sString     view;
+    double      start;
+    size_t      lookups;
+    size_t      sum;
+    size_t      idx;
+    size_t      arr_idx;
+
+    if (count == 0 || length == 0)
+    {
+        syntax_exit();
+    }
+
+    arr  = sstr_array_alloc(count * (length + 1), count);
+    pats = malloc(count * sizeof (sString*));
+    str  = sstr_alloc(length);
+    if (arr == NULL || pats == NULL || str == NULL)
+    {
+        fputs("Out of memory\n", stderr);
+        exit(1);
+    }
+
+    /* lengths from 1 to length, so that most entries differ in length */
+    for (idx = 0; idx < count; ++idx)
+    {
+        str->len = 1 + idx % length;
+        fill_chars(str->chars, str->len, idx);
+        sstr_array_appd(str, arr);
+        pats[idx] = sstr_alloc(length);
+        if (pats[idx] == NULL)
+        {
+            fputs("Out of memory\n", stderr);
+            exit(1);
+        }
+        sstr_cpy(str, pats[idx]);
+    }
+
+    /* about 2^26 compared chars per method */
+    lookups = ((size_t) 1 << 26) / (count * (length / 2 + 1)) + 1;
+
+    start = now_sec();
+    sum = 0;
+    for (idx = 0; idx < lookups; ++idx)
+    {
+        for (arr_idx = 0; arr_idx < count; ++arr_idx)
+        {
+            sstr_array_view(arr, &view, arr_idx);
+            if (sstr_cmp(&view, pats[idx % count]) == SSTR_TRUE)
+            {
+                sum += arr_idx;
+                break;
+            }
+        }
+    }
+    bench_sink = sum;
+    dspTime("sstr_cmp loop", now_sec() - start, lookups);
+
+    start = now_sec();
+    sum = 0;
+    for (idx = 0; idx < lookups; ++idx)
+    {
+        sum += sstr_cmp_any(pats[idx % count], arr);
+    }
+    bench_sink = sum;
+    dspTime("sstr_cmp_any", now_sec() - start, lookups);
+
+    start = now_sec();
+    sum = 0;
+    for (idx = 0; idx < lookups; ++idx)
+    {
+        sum += sstr_cmp_any_ct(pats[idx % count], arr);
+    }
+    bench_sink = sum;
+    dspTime("sstr_cmp_any_ct", now_sec() - start, lookups);
+
+    for (idx = 0; idx < count; ++idx)
+    {
+        sstr_wipe(pats[idx]);
+        sstr_dealloc(pats[idx]);
+    }
+    sstr_wipe(str);
+    sstr_dealloc(str);
+    sstr_array_wipe(arr);
+    sstr_array_dealloc(arr);
+    free(pats);
+}
+
+/**
+ * Building, saving and mapping a Bloom filter, and tests for contained
+ * and other strings, with the observed false positive rate
+ */
+void bench_sstrBloom(
+    size_t count
+)
+{
+    sstr_array* arr;
+    sstr_bloom* bloom;
+    sstr_bloom* mapped;
+    sString*    str;
+    char        file_path[] = "/tmp/libbench_bloom_XXXXXX";
+    int         file_fd;
+    double      start;
+    size_t      hits;
+    size_t      idx;
+
+    arr = sstr_array_alloc(count * 21, count);
+    str = sstr_alloc(20);
+    if (arr == NULL || str == NULL)
+    {
+        fputs("Out of memory\n", stderr);
+        exit(1);
+    }
+    for (idx = 0; idx < count; ++idx)
+    {
+        str->len = 0;
+        sstr_appd_u64(idx * 2, str);
+        sstr_array_appd(str, arr);
+    }
+
+    start = now_sec();
+    bloom = sstr_bloom_from_array(arr, 10);
+    if (bloom == NULL)
+    {
+        fputs("Out of memory\n", stderr);
+        exit(1);
+    }
+    dspTime("sstr_bloom_from_array", now_sec() - start, count);
+
+    file_fd = mkstemp(file_path);
+    if (file_fd < 0)
+    {
+        fputs("Cannot create a temporary file\n", stderr);
+        exit(1);
+    }
+    close(file_fd);
+    start = now_sec();
+    if (sstr_bloom_save(bloom, file_path) != SSTR_PASS)
+    {
+        fputs("Cannot save the Bloom filter\n", stderr);
+        exit(1);
+    }
+    dspTime("sstr_bloom_save", now_sec() - start, 1);
+
+    start = now_sec();
+    mapped = sstr_bloom_map(file_path);
+    if (mapped == NULL)
+    {
+        fputs("Cannot map the Bloom filter\n", stderr);
+        exit(1);
+    }
+    dspTime("sstr_bloom_map", now_sec() - start, 1);
+
+    /* even numbers have been added, odd numbers have not */
+    hits = 0;
+    start = now_sec();
+    for (idx = 0; idx < count; ++idx)
+    {
+        str->len = 0;
+        sstr_appd_u64(idx * 2, str);
+        hits += sstr_bloom_might_contain(mapped, str) == SSTR_TRUE;
+    }
+    dspTime("might_contain, contained", now_sec() - start, count);
+    bench_sink = hits;
+
+    hits = 0;
+    start = now_sec();
+    for (idx = 0; idx < count; ++idx)
+    {
+        str->len = 0;
+        sstr_appd_u64(idx * 2 + 1, str);
+        hits += sstr_bloom_might_contain(mapped, str) == SSTR_TRUE;
+    }
+    dspTime("might_contain, other", now_sec() - start, count);
+    printf("false positive rate %.3f %%\n", count > 0 ? 100.0 * (double) hits / (double) count : 0.0);
+
+    unlink(file_path);
+    sstr_bloom_dealloc(mapped);
+    sstr_bloom_dealloc(bloom);
+    sstr_dealloc(str);
+    sstr_array_dealloc(arr);
+}
+
+/**
+ * Longest matching prefix of request paths:
+ * sstr_startswith for each prefix vs. sstr_prefix_index_longest
+ */
+void bench_sstrPrefixIndex(
+    size_t count
+)
+{
+    sstr_array*        arr;
+    sstr_prefix_index* index;
+    sString*           str;
+    sString*           path;
+    sString            view;
+    double             start;
+    size_t             lookups;
+    size_t             longest_len;
+    size_t             sum;
+    size_t             idx;
+    size_t             arr_idx;
+
+    if (count == 0)
+    {
+        syntax_exit();
+    }
+
+    arr  = sstr_array_alloc(count * 32, count);
+    str  = sstr_alloc(31);
+    path = sstr_alloc(63);
+    if (arr == NULL || str == NULL || path == NULL)
+    {
+        fputs("Out of memory\n", stderr);
+        exit(1);
+    }
+    /* nested prefixes: /api/<n>/ and /api/<n>/v<m>/ */
+    for (idx = 0; idx < count; ++idx)
+    {
+        sstr_cpyf(str, idx % 2 == 0 ? "/api/%zu/" : "/api/%zu/v%zu/", idx / 2, idx % 7);
+        sstr_array_appd(str, arr);
+    }
+
+    start = now_sec();
+    index = sstr_prefix_index_alloc(arr);
+    if (index == NULL)
+    {
+        fputs("Out of memory\n", stderr);
+        exit(1);
+    }
+    dspTime("sstr_prefix_index_alloc", now_sec() - start, count);
+
+    lookups = ((size_t) 1 << 24) / count + 1;
+
+    start = now_sec();
+    sum = 0;
+    for (idx = 0; idx < lookups; ++idx)
+    {
+        sstr_cpyf(path, "/api/%zu/v%zu/users/%zu", idx % (count / 2 + 1), idx % 7, idx);
+        longest_len = 0;
+        for (arr_idx = 0; arr_idx < count; ++arr_idx)
+        {
+            sstr_array_view(arr, &view, arr_idx);
+            if (view.len >= longest_len && sstr_startswith(path, &view) == SSTR_TRUE)
+            {
+                longest_len = view.len;
+                sum += arr_idx;
+            }
+        }
+    }
+    bench_sink = sum;
+    dspTime("sstr_startswith loop", now_sec() - start, lookups);
+
+    start = now_sec();
+    sum = 0;
+    for (idx = 0; idx < lookups; ++idx)
+    {
+        sstr_cpyf(path, "/api/%zu/v%zu/users/%zu", idx % (count / 2 + 1), idx % 7, idx);
+        sum += sstr_prefix_index_longest(index, path);
+    }
+    bench_sink = sum;
+    dspTime("sstr_prefix_index_longest", now_sec() - start, lookups);
+
+    sstr_prefix_index_dealloc(index);
+    sstr_dealloc(path);
+    sstr_dealloc(str);
+    sstr_array_wipe(arr);
+    sstr_array_dealloc(arr);
+}
+
+/**
+ * Sorting strings that share long prefixes:
+ * qsort with memcmp vs. sstr_sort
+ */
+void bench_sstrSort(
+    size_t count,
+    size_t length
+)
+{
+    sString** strs;
+    sString** sorted;
+    double    start;
+    size_t    idx;
+    int       order;
+
+    if (length < 2)
+    {
+        syntax_exit();
+    }
+
+    strs   = malloc(count * sizeof (sString*));
+    sorted = malloc(count * sizeof (sString*));
+    if (strs == NULL || sorted == NULL)
+    {
+        fputs("Out of memory\n", stderr);
+        exit(1);
+    }
+    for (idx = 0; idx < count; ++idx)
+    {
+        strs[idx] = sstr_alloc(length);
+        if (strs[idx] == NULL)
+        {
+            fputs("Out of memory\n", stderr);
+            exit(1);
+        }
+        /* shuffled seeds; the strings differ in their last two chars */
+        fill_chars(strs[idx]->chars, length, (idx * 2654435761UL) % 676);
+        strs[idx]->len = length - (idx % 3);
+    }
+
+    memcpy(sorted, strs, count * sizeof (sString*));
+    start = now_sec();
+    qsort(sorted, count, sizeof (sString*), memcmp_order);
+    dspTime("qsort+memcmp", now_sec() - start, count);
+
+    memcpy(sorted, strs, count * sizeof (sString*));
+    start = now_sec();
+    sstr_sort(sorted, count);
+    dspTime("sstr_sort", now_sec() - start, count);
+
+    for (idx = 1; idx < count; ++idx)
+    {
+        sstr_order(sorted[idx - 1], sorted[idx], &order);
+        if (order > 0)
+        {
+            fputs("sstr_sort: wrong order\n", stderr);
+            exit(1);
+        }
+    }
+
+    for (idx = 0; idx < count; ++idx)
+    {
+        sstr_dealloc(strs[idx]);
+    }
+    free(sorted);
+    free(strs);
+}
+
+/**
+ * Redacting a word in a text: rebuilding the text with sstr_indexof,
+ * sstr_appdsubstr and sstr_appd vs. sstr_replace_all
+ */
+void bench_sstrReplace(
+    size_t length
+)
+{
+    sString* text;
+    sString* result;
+    sString  rest;
+    sString* word;
+    sString* mask;
+    sString* label;
+    double   start;
+    size_t   rounds;
+    size_t   round;
+    size_t   idx;
+    sstr_pos pos;
+    sstr_pos match;
+
+    text   = sstr_alloc(length);
+    result = sstr_alloc(length * 2);
+    word   = sstr_alloc(8);
+    mask   = sstr_alloc(8);
+    label  = sstr_alloc(10);
+    if (text == NULL || result == NULL || word == NULL || mask == NULL || label == NULL)
+    {
+        fputs("Out of memory\n", stderr);
+        exit(1);
+    }
+    sstr_cpycstr("secret", word, 6);
+    sstr_cpycstr("******", mask, 6);
+    sstr_cpycstr("[REDACTED]", label, 10);
+
+    /* one "secret" in every 64 chars */
+    for (idx = 0; idx < length; ++idx)
+    {
+        text->chars[idx] = (char) ('a' + (idx % 19));
+        if (idx % 64 == 20 && idx + 6 <= length)
+        {
+            memcpy(&(text->chars[idx]), "secret", 6);
+            idx += 5;
+        }
+    }
+    text->len = length;
+    text->chars[length] = '\0';
+
+    rounds = ((size_t) 1 << 28) / (length + 1) + 1;
+
+    start = now_sec();
+    for (round = 0; round < rounds; ++round)
+    {
+        sstr_clear(result);
+        pos = 0;
+        do
+        {
+            rest.chars = &(text->chars[pos]);
+            rest.cap   = text->len - pos;
+            rest.len   = text->len - pos;
+            match = sstr_indexof(&rest, word);
+            if (match != SSTR_NPOS)
+            {
+                sstr_appdsubstr(text, result, pos, match);
+                sstr_appd(label, result);
+                pos += match + word->len;
+            }
+        }
+        while (match != SSTR_NPOS);
+        sstr_appdsubstr(text, result, pos, text->len - pos);
+    }
+    dspRate("sstr_indexof+sstr_appd", now_sec() - start, rounds * length);
+
+    start = now_sec();
+    for (round = 0; round < rounds; ++round)
+    {
+        sstr_replace_all(text, word, label, result);
+    }
+    dspRate("sstr_replace_all", now_sec() - start, rounds * length);
+
+    start = now_sec();
+    for (round = 0; round < rounds; ++round)
+    {
+        sstr_cpy(text, result);
+        sstr_replace_all(result, word, mask, result);
+    }
+    dspRate("sstr_cpy+in place", now_sec() - start, rounds * length);
+
+    sstr_dealloc(label);
+    sstr_dealloc(mask);
+    sstr_dealloc(word);
+    sstr_dealloc(result);
+    sstr_dealloc(text);
+}
+
+/**
+ * Inserting and removing a span in the middle of a string:
+ * rebuilding it with sstr_substr and sstr_appdsubstr vs. sstr_insert
+ * and sstr_erase
+ */
+void bench_sstrSplice(
+    size_t length
+)
+{
+    sString* text;
+    sString* result;
+    sString* span;
+    double   start;
+    size_t   rounds;
+    size_t   round;
+    sstr_pos pos;
+
+    text   = sstr_alloc(length + 16);
+    result = sstr_alloc(length + 16);
+    span   = sstr_alloc(16);
+    if (text == NULL || result == NULL || span == NULL)
+    {
+        fputs("Out of memory\n", stderr);
+        exit(1);
+    }
+    fill_chars(text->chars, length, 0);
+    text->len = length;
+    fill_chars(span->chars, 16, 1);
+    span->len = 16;
+    pos = length / 2;
+
+    rounds = ((size_t) 1 << 28) / (length + 1) + 1;
+
+    start = now_sec();
+    for (round = 0; round < rounds; ++round)
+    {
+        /* insert the span, then remove it again */
+        sstr_substr(text, result, 0, pos);
+        sstr_appd(span, result);
+        sstr_appdsubstr(text, result, pos, text->len - pos);
+        sstr_substr(result, text, 0, pos);
+        sstr_appdsubstr(result, text, pos + span->len, result->len - pos - span->len);
+    }
+    dspRate("sstr_substr+sstr_appd", now_sec() - start, rounds * length * 2);
+
+    start = now_sec();
+    for (round = 0; round < rounds; ++round)
+    {
+        sstr_insert(span, text, pos);
+        sstr_erase(text, pos, span->len);
+    }
+    dspRate("sstr_insert+sstr_erase", now_sec() - start, rounds * length * 2);
+
+    sstr_dealloc(span);
+    sstr_dealloc(result);
+    sstr_dealloc(text);
+}
+
+/**
+ * qsort comparison of two secureStrings with memcmp
+ */
+int memcmp_order(
+    const void* left,
+    const void* right
+)
+{
+    const sString* left_str  = *(const sString* const*) left;
+    const sString* right_str = *(const sString* const*) right;
+    size_t         min_len;
+    int            order;
+
+    min_len = left_str->len < right_str->len ? left_str->len : right_str->len;
+    order   = memcmp(left_str->chars, right_str->chars, min_len);
+    if (order == 0)
+    {
+        order = left_str->len < right_str->len ? -1 : (left_str->len > right_str->len);
+    }
+
+    return order;
+}
+
+/**
+ * fill a buffer with printable characters derived from a seed value
+ */
+void fill_chars(
+    char*  dst,
+    size_t length,
+    size_t seed
+)
+{
+    size_t idx;
+
+    for (idx = 0; idx < length; ++idx)
+    {
+        dst[idx] = (char) ('a' + (idx % 26));
+    }
+    if (length > 0)
+    {
+        dst[length - 1] = (char) ('A' + (seed % 26));
+        if (length > 1)
+        {
+            dst[length - 2] = (char) ('A' + ((seed / 26) % 26));
+        }
+    }
+    dst[length] = '\0';
+}
+
+double now_sec(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double) ts.tv_sec + (double) ts.tv_nsec / 1e9;
+}
+
+void dspTime(
+    const char* label,
+    double      elapsed,
+    size_t      ops
+)
+{
+    fprintf(stdout, "%-24s %10.3f ms  %8.2f ns/op\n", label,
+        elapsed * 1e3, ops > 0 ? elapsed * 1e9 / (double) ops : 0.0);
+}
+
+void dspRate(
+    const char* label,
+    double      elapsed,
+    size_t      bytes
+)
+{
+    fprintf(stdout, "%-24s %10.3f ms  %8.2f GB/s\n", label,
+        elapsed * 1e3, elapsed > 0 ? (double) bytes / elapsed / 1e9 : 0.0);
+}
+
+size_t argSize(
+    const char* arg
+)
+{
+    return (size_t) strtoull(arg, NULL, 10);
+}
+
+sstr_rc argCmp(
+    sString*    p_src_str,
+    const char* p_pat_cstr
+)
+{
+    return ( sstrCmpCstr(p_src_str, p_pat_cstr, strlen(p_pat_cstr)) );
+}
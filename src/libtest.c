@@ -8,10 +8,13 @@
 #include <sys/types.h>
 #include <stdlib.h>
 #include <limits.h>
+#include <inttypes.h>
 #include <stdio.h>
 #include <string.h>
 #include <securestr.h>
 #include <securestr_conv.h>
+#include <securestr_map.h>
+#include <securestr_vault.h>
 
 /* size of the test strings */
 #define STR_A_SIZE   200
@@ -27,12 +30,27 @@ void test_sstrAppd(sString*, sString*);
 void test_sstrSubstr(sString*, sString*, char*[]);
 void test_sstrAppdSubstr(sString*, sString*, char*[]);
 void test_sstrCmp(sString*, sString*);
+void test_sstrOrder(sString*, sString*);
 void test_sstrStartsWith(sString*, sString*);
 void test_sstrEndsWith(sString*, sString*);
 void test_sstrIndexOf(sString*, sString*);
 void test_sstrSwap(sString*, sString*);
+void test_sstrReplace(sString*, sString*, char*[]);
+void test_sstrReplaceAll(sString*, sString*, char*[]);
+void test_sstrInsert(sString*, sString*, char*[]);
+void test_sstrErase(sString*, char*[]);
+void test_sstrSplice(sString*, sString*, char*[]);
+void test_sstrMap(sString*, sString*, char*[]);
+void test_sstrVault(sString*, sString*, char*[]);
+void test_sstrToU64(sString*);
+void test_sstrToI64(sString*);
+void test_sstrToDouble(sString*);
+void test_sstrConv(const char*, sstr_rc (*)(const sString*, sString*),
+                   sString*, sString*);
+void test_sstrCpyf(sString*, sString*);
 void chkArgs(int, int);
 void dspStr(const char*, sString*);
+void dspRc(const char*, sstr_rc);
 
 sstr_rc argCmp(sString*, const char*);
 
@@ -143,6 +161,11 @@ int main(
         chkArgs(argc, 4);
         test_sstrCmp(str_a, str_b);
     } else
+    if ( argCmp(func, "sstrOrder") == SSTR_TRUE )
+    {
+        chkArgs(argc, 4);
+        test_sstrOrder(str_a, str_b);
+    } else
     if ( argCmp(func, "sstrStartsWith") == SSTR_TRUE )
     {
         chkArgs(argc, 4);
@@ -161,6 +184,121 @@ int main(
     if ( argCmp(func, "sstrSwap") == SSTR_TRUE ){
         chkArgs(argc, 4);
         test_sstrSwap(str_a, str_b);
+    } else
+    if ( argCmp(func, "sstrReplace") == SSTR_TRUE )
+    {
+        chkArgs(argc, 5);
+        test_sstrReplace(str_a, str_b, argv);
+    } else
+    if ( argCmp(func, "sstrReplaceAll") == SSTR_TRUE )
+    {
+        chkArgs(argc, 5);
+        test_sstrReplaceAll(str_a, str_b, argv);
+    } else
+    if ( argCmp(func, "sstrInsert") == SSTR_TRUE )
+    {
+        chkArgs(argc, 5);
+        test_sstrInsert(str_a, str_b, argv);
+    } else
+    if ( argCmp(func, "sstrErase") == SSTR_TRUE )
+    {
+        chkArgs(argc, 5);
+        test_sstrErase(str_a, argv);
+    } else
+    if ( argCmp(func, "sstrSplice") == SSTR_TRUE )
+    {
+        chkArgs(argc, 6);
+        test_sstrSplice(str_a, str_b, argv);
+    } else
+    if ( argCmp(func, "sstrMap") == SSTR_TRUE )
+    {
+        chkArgs(argc, 5);
+        test_sstrMap(str_a, str_b, argv);
+    } else
+    if ( argCmp(func, "sstrVault") == SSTR_TRUE )
+    {
+        chkArgs(argc, 5);
+        test_sstrVault(str_a, str_b, argv);
+    } else
+    if ( argCmp(func, "sstrToU64") == SSTR_TRUE )
+    {
+        chkArgs(argc, 3);
+        test_sstrToU64(str_a);
+    } else
+    if ( argCmp(func, "sstrToI64") == SSTR_TRUE )
+    {
+        chkArgs(argc, 3);
+        test_sstrToI64(str_a);
+    } else
+    if ( argCmp(func, "sstrToDouble") == SSTR_TRUE )
+    {
+        chkArgs(argc, 3);
+        test_sstrToDouble(str_a);
+    } else
+    if ( argCmp(func, "sstrHexEncode") == SSTR_TRUE )
+    {
+        chkArgs(argc, 4);
+        test_sstrConv("sstrHexEncode(string_A, string_B)", sstr_hex_encode,
+            str_a, str_b);
+    } else
+    if ( argCmp(func, "sstrHexDecode") == SSTR_TRUE )
+    {
+        chkArgs(argc, 4);
+        test_sstrConv("sstrHexDecode(string_A, string_B)", sstr_hex_decode,
+            str_a, str_b);
+    } else
+    if ( argCmp(func, "sstrB64Encode") == SSTR_TRUE )
+    {
+        chkArgs(argc, 4);
+        test_sstrConv("sstrB64Encode(string_A, string_B)", sstr_b64_encode,
+            str_a, str_b);
+    } else
+    if ( argCmp(func, "sstrB64Decode") == SSTR_TRUE )
+    {
+        chkArgs(argc, 4);
+        test_sstrConv("sstrB64Decode(string_A, string_B)", sstr_b64_decode,
+            str_a, str_b);
+    } else
+    if ( argCmp(func, "sstrB64urlEncode") == SSTR_TRUE )
+    {
+        chkArgs(argc, 4);
+        test_sstrConv("sstrB64urlEncode(string_A, string_B)", sstr_b64url_encode,
+            str_a, str_b);
+    } else
+    if ( argCmp(func, "sstrB64urlDecode") == SSTR_TRUE )
+    {
+        chkArgs(argc, 4);
+        test_sstrConv("sstrB64urlDecode(string_A, string_B)", sstr_b64url_decode,
+            str_a, str_b);
+    } else
+    if ( argCmp(func, "sstrJsonEscape") == SSTR_TRUE )
+    {
+        chkArgs(argc, 4);
+        test_sstrConv("sstrJsonEscape(string_A, string_B)", sstr_json_escape,
+            str_a, str_b);
+    } else
+    if ( argCmp(func, "sstrJsonUnescape") == SSTR_TRUE )
+    {
+        chkArgs(argc, 4);
+        test_sstrConv("sstrJsonUnescape(string_A, string_B)", sstr_json_unescape,
+            str_a, str_b);
+    } else
+    if ( argCmp(func, "sstrUrlEncode") == SSTR_TRUE )
+    {
+        chkArgs(argc, 4);
+        test_sstrConv("sstrUrlEncode(string_A, string_B)", sstr_url_encode,
+            str_a, str_b);
+    } else
+    if ( argCmp(func, "sstrUrlDecode") == SSTR_TRUE )
+    {
+        chkArgs(argc, 4);
+        test_sstrConv("sstrUrlDecode(string_A, string_B)", sstr_url_decode,
+            str_a, str_b);
+    } else
+    if ( argCmp(func, "sstrCpyf") == SSTR_TRUE )
+    {
+        chkArgs(argc, 4);
+        test_sstrCpyf(str_a, str_b);
     } else {
         syntax_exit();
     }
@@ -202,10 +340,32 @@ void syntax_exit(void)
           "  sstrSubstr       <string_A> <string_B> <offset> <length>\n"
           "  sstrAppdSubstr   <string_A> <string_B> <offset> <length>\n"
           "  sstrCmp          <string_A> <string_B>\n"
+          "  sstrOrder        <string_A> <string_B>\n"
           "  sstrStartsWith   <string_A> <string_B>\n"
           "  sstrEndsWith     <string_A> <string_B>\n"
           "  sstrIndexOf      <string_A> <string_B>\n"
-          "  sstrSwap         <string_A> <string_B>\n", stderr);
+          "  sstrSwap         <string_A> <string_B>\n"
+          "  sstrReplace      <string_A> <string_B> <replacement>\n"
+          "  sstrReplaceAll   <string_A> <string_B> <replacement>\n"
+          "  sstrInsert       <string_A> <string_B> <offset>\n"
+          "  sstrErase        <string_A> <offset> <length>\n"
+          "  sstrSplice       <string_A> <string_B> <offset> <length>\n"
+          "  sstrMap          <string_A> <string_B> <new_value>\n"
+          "  sstrVault        <string_A> <string_B> <new_value>\n"
+          "  sstrToU64        <string_A>\n"
+          "  sstrToI64        <string_A>\n"
+          "  sstrToDouble     <string_A>\n"
+          "  sstrHexEncode    <string_A> <string_B>\n"
+          "  sstrHexDecode    <string_A> <string_B>\n"
+          "  sstrB64Encode    <string_A> <string_B>\n"
+          "  sstrB64Decode    <string_A> <string_B>\n"
+          "  sstrB64urlEncode <string_A> <string_B>\n"
+          "  sstrB64urlDecode <string_A> <string_B>\n"
+          "  sstrJsonEscape   <string_A> <string_B>\n"
+          "  sstrJsonUnescape <string_A> <string_B>\n"
+          "  sstrUrlEncode    <string_A> <string_B>\n"
+          "  sstrUrlDecode    <string_A> <string_B>\n"
+          "  sstrCpyf         <string_A> <string_B>\n", stderr);
 
     exit(1);
 }
@@ -354,6 +514,22 @@ void test_sstrCmp(
     dspStr("string_B", str_b);
 }
 
+void test_sstrOrder(
+    sString* str_a,
+    sString* str_b
+)
+{
+    sstr_rc rc;
+    int     order;
+
+    order = 2;
+    rc = sstr_order(str_a, str_b, &order);
+    dspRc("sstrOrder(string_A, string_B, order)", rc);
+    fprintf(stdout, "order(%i)\n", order);
+    dspStr("string_A", str_a);
+    dspStr("string_B", str_b);
+}
+
 void test_sstrStartsWith(
     sString* str_a,
     sString* str_b
@@ -457,6 +633,434 @@ void test_sstrSwap(
 }
 
 
+void test_sstrReplace(
+    sString* str_a,
+    sString* str_b,
+    char*    argv[]
+)
+{
+    sstr_rc  rc;
+    sString* rpl;
+    sString* result;
+    sString* small;
+
+    rpl    = sstr_alloc(strlen(argv[4]));
+    result = sstr_alloc( (size_t) STR_A_SIZE );
+    small  = sstr_alloc( (size_t) 4 );
+    if (rpl == NULL || result == NULL || small == NULL)
+    {
+        fputs("Out of memory\n", stderr);
+        exit(1);
+    }
+    sstrCpyCstr( (const char*) argv[4], rpl, strlen(argv[4]));
+
+    rc = sstr_replace(str_a, str_b, rpl, result);
+    dspRc("sstrReplace(string_A, string_B, replacement, result)", rc);
+    dspStr("result", result);
+
+    /* in place, if the replacement is not longer than the pattern */
+    if (str_a != NULL && str_b != NULL && rpl->len <= str_b->len)
+    {
+        sstr_cpy(str_a, result);
+        rc = sstr_replace(result, str_b, rpl, result);
+        dspRc("sstrReplace(result, string_B, replacement, result)", rc);
+        dspStr("result", result);
+    }
+
+    /* small is left unchanged if its capacity is not enough */
+    sstrCpyCstr( (const char*) "abc", small, (size_t) 3);
+    rc = sstr_replace(str_a, str_b, rpl, small);
+    dspRc("sstrReplace(string_A, string_B, replacement, small)", rc);
+    dspStr("small", small);
+
+    dspStr("string_A", str_a);
+    dspStr("string_B", str_b);
+
+    sstr_dealloc(small);
+    sstr_dealloc(result);
+    sstr_dealloc(rpl);
+}
+
+
+void test_sstrReplaceAll(
+    sString* str_a,
+    sString* str_b,
+    char*    argv[]
+)
+{
+    sstr_rc  rc;
+    sString* rpl;
+    sString* result;
+
+    rpl    = sstr_alloc(strlen(argv[4]));
+    result = sstr_alloc( (size_t) STR_A_SIZE );
+    if (rpl == NULL || result == NULL)
+    {
+        fputs("Out of memory\n", stderr);
+        exit(1);
+    }
+    sstrCpyCstr( (const char*) argv[4], rpl, strlen(argv[4]));
+
+    fputs("sstrReplaceAll(string_A, string_B, replacement, result): ", stdout);
+    fflush(stdout);
+    rc = sstr_replace_all(str_a, str_b, rpl, result);
+    if (rc == SSTR_PASS)
+    {
+        fputs("SSTR_PASS\n", stdout);
+    } else
+    if (rc == SSTR_FAIL)
+    {
+        fputs("SSTR_FAIL\n", stdout);
+    } else {
+        fputs("!! INVALID RETURN CODE !!\n", stdout);
+    }
+    dspStr("string_A", str_a);
+    dspStr("string_B", str_b);
+    dspStr("result", result);
+
+    sstr_dealloc(result);
+    sstr_dealloc(rpl);
+}
+
+
+void test_sstrInsert(
+    sString* str_a,
+    sString* str_b,
+    char*    argv[]
+)
+{
+    sstr_rc  rc;
+    sstr_pos offset;
+
+    offset = (sstr_pos) strtoll(argv[4], NULL, 10);
+
+    rc = sstr_insert(str_a, str_b, offset);
+    dspRc("sstrInsert(string_A, string_B, offset)", rc);
+    dspStr("string_A", str_a);
+    dspStr("string_B", str_b);
+}
+
+
+void test_sstrErase(
+    sString* str_a,
+    char*    argv[]
+)
+{
+    sstr_rc  rc;
+    sstr_pos offset;
+    size_t   length;
+    size_t   prev_len;
+    size_t   idx;
+    int      zeroed;
+
+    offset = (sstr_pos) strtoll(argv[3], NULL, 10);
+    length = (size_t) strtoll(argv[4], NULL, 10);
+
+    prev_len = (str_a != NULL) ? str_a->len : 0;
+    rc = sstr_erase(str_a, offset, length);
+    dspRc("sstrErase(string_A, offset, length)", rc);
+    dspStr("string_A", str_a);
+
+    /* no part of the removed data may remain after the new end */
+    if (str_a != NULL && str_a->len < prev_len)
+    {
+        zeroed = 1;
+        for (idx = str_a->len; idx <= prev_len; ++idx)
+        {
+            if (str_a->chars[idx] != '\0')
+            {
+                zeroed = 0;
+            }
+        }
+        fputs(zeroed ? "previous tail zeroed\n" : "!! PREVIOUS TAIL NOT ZEROED !!\n",
+              stdout);
+    }
+}
+
+
+void test_sstrSplice(
+    sString* str_a,
+    sString* str_b,
+    char*    argv[]
+)
+{
+    sstr_rc  rc;
+    sstr_pos offset;
+    size_t   length;
+
+    fputs("sstrSplice(string_A, string_B, offset, length): ", stdout);
+    fflush(stdout);
+
+    offset = (sstr_pos) strtoll(argv[4], NULL, 10);
+    length = (size_t) strtoll(argv[5], NULL, 10);
+
+    rc = sstr_splice(str_a, str_b, offset, length);
+    if (rc == SSTR_PASS)
+    {
+        fputs("SSTR_PASS\n", stdout);
+    } else
+    if (rc == SSTR_FAIL)
+    {
+        fputs("SSTR_FAIL\n", stdout);
+    } else {
+        fputs("!! INVALID RETURN CODE !!\n", stdout);
+    }
+    dspStr("string_A", str_a);
+    dspStr("string_B", str_b);
+}
+
+
+void test_sstrMap(
+    sString* str_a,
+    sString* str_b,
+    char*    argv[]
+)
+{
+    sstr_rc        rc;
+    sstr_map*      map;
+    sString*       new_value;
+    const sString* value;
+    size_t         prev_len;
+    size_t         idx;
+    int            zeroed;
+
+    map       = sstr_map_alloc( (size_t) 8 );
+    new_value = sstr_alloc(strlen(argv[4]));
+    if (map == NULL || new_value == NULL)
+    {
+        fputs("Out of memory\n", stderr);
+        exit(1);
+    }
+    sstrCpyCstr( (const char*) argv[4], new_value, strlen(argv[4]));
+
+    rc = sstr_map_put(str_a, str_b, map);
+    dspRc("sstrMapPut(string_A, string_B, map)", rc);
+    value = sstr_map_get(map, str_a);
+    dspStr("sstrMapGet(map, string_A)", (sString*) value);
+
+    /* overwrite; a shorter value must not leave the previous tail behind */
+    prev_len = (value != NULL) ? value->len : 0;
+    rc = sstr_map_put(str_a, new_value, map);
+    dspRc("sstrMapPut(string_A, new_value, map)", rc);
+    value = sstr_map_get(map, str_a);
+    dspStr("sstrMapGet(map, string_A)", (sString*) value);
+    if (value != NULL && value->len < prev_len)
+    {
+        zeroed = 1;
+        for (idx = value->len; idx <= prev_len; ++idx)
+        {
+            if (value->chars[idx] != '\0')
+            {
+                zeroed = 0;
+            }
+        }
+        fputs(zeroed ? "previous tail zeroed\n" : "!! PREVIOUS TAIL NOT ZEROED !!\n",
+              stdout);
+    }
+
+    /* overwrite an entry with its own value */
+    if (value != NULL)
+    {
+        rc = sstr_map_put(str_a, value, map);
+        dspRc("sstrMapPut(string_A, sstrMapGet(map, string_A), map)", rc);
+        value = sstr_map_get(map, str_a);
+        dspStr("sstrMapGet(map, string_A)", (sString*) value);
+    }
+
+    rc = sstr_map_erase(str_a, map);
+    dspRc("sstrMapErase(string_A, map)", rc);
+    value = sstr_map_get(map, str_a);
+    dspStr("sstrMapGet(map, string_A)", (sString*) value);
+    rc = sstr_map_erase(str_a, map);
+    dspRc("sstrMapErase(string_A, map)", rc);
+    fprintf(stdout, "sstrMapCount(map): %zu\n", sstr_map_count(map));
+
+    dspStr("string_A", str_a);
+    dspStr("string_B", str_b);
+
+    sstr_dealloc(new_value);
+    sstr_map_dealloc(map);
+}
+
+
+void test_sstrVault(
+    sString* str_a,
+    sString* str_b,
+    char*    argv[]
+)
+{
+    sstr_rc           rc;
+    sstr_vault*       vault;
+    sstr_vault_ticket ticket;
+    sString*          new_value;
+    sString*          value;
+    const sString*    found;
+
+    vault     = sstr_vault_alloc();
+    new_value = sstr_alloc(strlen(argv[4]));
+    value     = sstr_alloc( (size_t) STR_A_SIZE );
+    if (vault == NULL || new_value == NULL || value == NULL)
+    {
+        fputs("Out of memory\n", stderr);
+        exit(1);
+    }
+    sstrCpyCstr( (const char*) argv[4], new_value, strlen(argv[4]));
+
+    rc = sstr_vault_put(str_a, str_b, vault);
+    dspRc("sstrVaultPut(string_A, string_B, vault)", rc);
+
+    /* a reader sees the value that was current when it entered */
+    rc = sstr_vault_enter(vault, &ticket);
+    dspRc("sstrVaultEnter(vault, ticket)", rc);
+    found = sstr_vault_find(&ticket, str_a);
+    dspStr("sstrVaultFind(ticket, string_A)", (sString*) found);
+    rc = sstr_vault_leave(vault, &ticket);
+    dspRc("sstrVaultLeave(vault, ticket)", rc);
+
+    rc = sstr_vault_get(vault, str_a, value);
+    dspRc("sstrVaultGet(vault, string_A, value)", rc);
+    dspStr("value", value);
+
+    rc = sstr_vault_put(str_a, new_value, vault);
+    dspRc("sstrVaultPut(string_A, new_value, vault)", rc);
+    rc = sstr_vault_get(vault, str_a, value);
+    dspRc("sstrVaultGet(vault, string_A, value)", rc);
+    dspStr("value", value);
+
+    rc = sstr_vault_erase(str_a, vault);
+    dspRc("sstrVaultErase(string_A, vault)", rc);
+    rc = sstr_vault_get(vault, str_a, value);
+    dspRc("sstrVaultGet(vault, string_A, value)", rc);
+    sstr_vault_enter(vault, &ticket);
+    found = sstr_vault_find(&ticket, str_a);
+    dspStr("sstrVaultFind(ticket, string_A)", (sString*) found);
+    sstr_vault_leave(vault, &ticket);
+    rc = sstr_vault_erase(str_a, vault);
+    dspRc("sstrVaultErase(string_A, vault)", rc);
+
+    dspStr("string_A", str_a);
+    dspStr("string_B", str_b);
+
+    sstr_dealloc(value);
+    sstr_dealloc(new_value);
+    sstr_vault_dealloc(vault);
+}
+
+
+void test_sstrToU64(
+    sString* str_a
+)
+{
+    sstr_rc  rc;
+    uint64_t value;
+
+    /* the value must only be modified if the conversion succeeds */
+    value = 42;
+    rc = sstr_to_u64(str_a, &value);
+    dspRc("sstrToU64(string_A, value)", rc);
+    fprintf(stdout, "value(%" PRIu64 ")\n", value);
+    dspStr("string_A", str_a);
+}
+
+
+void test_sstrToI64(
+    sString* str_a
+)
+{
+    sstr_rc rc;
+    int64_t value;
+
+    value = 42;
+    rc = sstr_to_i64(str_a, &value);
+    dspRc("sstrToI64(string_A, value)", rc);
+    fprintf(stdout, "value(%" PRId64 ")\n", value);
+    dspStr("string_A", str_a);
+}
+
+
+void test_sstrToDouble(
+    sString* str_a
+)
+{
+    sstr_rc rc;
+    double  value;
+
+    value = 42.0;
+    rc = sstr_to_double(str_a, &value);
+    dspRc("sstrToDouble(string_A, value)", rc);
+    fprintf(stdout, "value(%.17g)\n", value);
+    dspStr("string_A", str_a);
+}
+
+
+void test_sstrConv(
+    const char* label,
+    sstr_rc     (*conv)(const sString*, sString*),
+    sString*    str_a,
+    sString*    str_b
+)
+{
+    sstr_rc rc;
+
+    /* string_B is overwritten; its previous contents show whether
+     * it is wiped or left unchanged on failure
+     */
+    rc = conv(str_a, str_b);
+    dspRc(label, rc);
+    dspStr("string_A", str_a);
+    dspStr("string_B", str_b);
+}
+
+
+void test_sstrCpyf(
+    sString* str_a,
+    sString* str_b
+)
+{
+    sstr_rc  rc;
+    sString* small;
+
+    small = sstr_alloc( (size_t) 8 );
+    if (small == NULL)
+    {
+        fputs("Out of memory\n", stderr);
+        exit(1);
+    }
+
+    /* field widths and the '-' and '0' flags */
+    rc = sstr_cpyf(str_b, "[%-6.3S|%6S|%05d|%-4x|%3c|%.2s]", str_a, str_a, -42,
+                   255U, 'z', "abc");
+    dspRc("sstrCpyf(string_B, \"[%-6.3S|%6S|%05d|%-4x|%3c|%.2s]\", ...)", rc);
+    dspStr("string_B", str_b);
+
+    rc = sstr_cpyf(str_b, "%*S|%%|%g", -8, str_a, 0.5);
+    dspRc("sstrCpyf(string_B, \"%*S|%%|%g\", -8, string_A, 0.5)", rc);
+    dspStr("string_B", str_b);
+
+    /* a failing sstr_appdf() leaves the destination unchanged */
+    sstrCpyCstr( (const char*) "ab", small, (size_t) 2);
+    rc = sstr_appdf(small, "%S%S", str_a, str_a);
+    dspRc("sstrAppdf(small, \"%S%S\", string_A, string_A)", rc);
+    dspStr("small", small);
+
+    /* rejected directives; sstr_cpyf() wipes the destination */
+    sstrCpyCstr( (const char*) "ab", small, (size_t) 2);
+    rc = sstr_appdf(small, "%5%");
+    dspRc("sstrAppdf(small, \"%5%\")", rc);
+    dspStr("small", small);
+    rc = sstr_appdf(small, "%.3d", 7);
+    dspRc("sstrAppdf(small, \"%.3d\", 7)", rc);
+    dspStr("small", small);
+    rc = sstr_cpyf(str_b, "%.3d", 7);
+    dspRc("sstrCpyf(string_B, \"%.3d\", 7)", rc);
+    dspStr("string_B", str_b);
+
+    dspStr("string_A", str_a);
+
+    sstr_dealloc(small);
+}
+
+
 sstr_rc argCmp(
     sString*    p_src_str,
     const char* p_pat_cstr
@@ -478,6 +1082,27 @@ void dspStr(
     }
 }
 
+void dspRc(
+    const char* label,
+    sstr_rc     rc
+)
+{
+    if (rc == SSTR_PASS)
+    {
+        fprintf(stdout, "%s: SSTR_PASS\n", label);
+    } else
+    if (rc == SSTR_FAIL)
+    {
+        fprintf(stdout, "%s: SSTR_FAIL\n", label);
+    } else
+    if (rc == SSTR_RANGE)
+    {
+        fprintf(stdout, "%s: SSTR_RANGE\n", label);
+    } else {
+        fprintf(stdout, "%s: !! INVALID RETURN CODE !!\n", label);
+    }
+}
+
 void chkArgs(
     int argc,
     int reqargc
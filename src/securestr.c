@@ -31,10 +31,48 @@
 #include <unistd.h>
 #include <sys/types.h>
 #include <stdlib.h>
+#include <string.h>
 #include <securestr.h>
 
+#ifdef __SSE2__
+    #include <emmintrin.h>
+#endif
+#ifdef __AVX2__
+    #include <immintrin.h>
+#endif
+
 #define sstr_version_cstr "0.54-beta (2014-10-25_001)"
 
+#ifdef __SSE2__
+static unsigned int sstr_lowbit(
+    unsigned int mask
+);
+#endif /* __SSE2__ */
+static sstr_pos sstr_find(
+    const sstring *src_str,
+    const sstring *pat_str,
+    sstr_pos      start_pos
+);
+static size_t sstr_diff_idx(
+    const unsigned char *src_chars,
+    const unsigned char *pat_chars,
+    size_t              cmp_len
+);
+static sstr_rc sstr_splice_chars(
+    const char *src_chars,
+    size_t     src_len,
+    sstring    *dst_str,
+    sstr_pos   dst_pos,
+    size_t     erase_len
+);
+static sstr_rc sstr_replace_count(
+    const sstring *src_str,
+    const sstring *pat_str,
+    const sstring *rpl_str,
+    sstring       *dst_str,
+    size_t        max_count
+);
+
 const sstring sstr_version_struct =
 {
     // chars = string buffer
@@ -124,8 +162,8 @@ void sstr_dealloc(
  * Copy a string to another string (overwrite)
  */
 sstr_rc sstr_cpy(
-    sstring *src_str,
-    sstring *dst_str
+    const sstring *src_str,
+    sstring       *dst_str
 )
 {
     sstr_rc sstr_status = SSTR_FAIL;
@@ -159,8 +197,8 @@ sstr_rc sstr_cpy(
  * Append a string to another string
  */
 sstr_rc sstr_appd(
-    sstring *src_str,
-    sstring *dst_str
+    const sstring *src_str,
+    sstring       *dst_str
 )
 {
     sstr_rc sstr_status = SSTR_FAIL;
@@ -456,6 +494,49 @@ sstr_rc sstr_cmp(
 }
 
 
+/**
+ * Compare two strings in lexicographic order
+ *
+ * Chars are compared as unsigned values, 16 or 32 at a time if SSE2 or
+ * AVX2 is available; a string that is a prefix of another string orders
+ * first. dst_order is set to -1, 0 or 1 if src_str orders before, equal to
+ * or after pat_str.
+ */
+sstr_rc sstr_order(
+    const sstring *src_str,
+    const sstring *pat_str,
+    int           *dst_order
+)
+{
+    sstr_rc sstr_status = SSTR_FAIL;
+
+    if (src_str != NULL && pat_str != NULL && dst_order != NULL)
+    {
+        const unsigned char *src_chars = (const unsigned char *) src_str->chars;
+        const unsigned char *pat_chars = (const unsigned char *) pat_str->chars;
+        size_t min_len  = src_str->len < pat_str->len ? src_str->len : pat_str->len;
+        size_t diff_idx = sstr_diff_idx(src_chars, pat_chars, min_len);
+
+        if (diff_idx < min_len)
+        {
+            (*dst_order) = src_chars[diff_idx] < pat_chars[diff_idx] ? -1 : 1;
+        }
+        else
+        if (src_str->len != pat_str->len)
+        {
+            (*dst_order) = src_str->len < pat_str->len ? -1 : 1;
+        }
+        else
+        {
+            (*dst_order) = 0;
+        }
+        sstr_status = SSTR_PASS;
+    }
+
+    return sstr_status;
+}
+
+
 /**
  * Compare the head part of two strings
  */
@@ -542,10 +623,10 @@ sstr_rc sstr_endswith(
  * Extract a substring from a string
  */
 sstr_rc sstr_substr(
-    sstring  *src_str,
-    sstring  *dst_str,
-    sstr_pos start_pos,
-    size_t   substr_len
+    const sstring *src_str,
+    sstring       *dst_str,
+    sstr_pos      start_pos,
+    size_t        substr_len
 )
 {
     sstr_rc sstr_status = SSTR_FAIL;
@@ -584,10 +665,10 @@ sstr_rc sstr_substr(
  * Extract a substring from a string and append it to another string
  */
 sstr_rc sstr_appdsubstr(
-    sstring  *src_str,
-    sstring  *dst_str,
-    sstr_pos start_pos,
-    size_t   substr_len
+    const sstring *src_str,
+    sstring       *dst_str,
+    sstr_pos      start_pos,
+    size_t        substr_len
 )
 {
     sstr_rc sstr_status = SSTR_FAIL;
@@ -676,4 +757,398 @@ sstr_pos sstr_indexof(
     }
 
     return sstr_index;
-}
\ No newline at end of file
+}
+
+
+/**
+ * Replace the first occurrence of a pattern in a string
+ *
+ * src_str and dst_str may be the same string if rpl_str is not longer
+ * than pat_str; otherwise they must be different strings. pat_str and
+ * rpl_str must not be dst_str. If the pattern does not occur, src_str
+ * is copied. Chars of dst_str that are no longer used are zeroed.
+ * Fails without modifying dst_str if pat_str is empty or dst_str does
+ * not have enough capacity.
+ */
+sstr_rc sstr_replace(
+    const sstring *src_str,
+    const sstring *pat_str,
+    const sstring *rpl_str,
+    sstring       *dst_str
+)
+{
+    return sstr_replace_count(src_str, pat_str, rpl_str, dst_str, 1);
+}
+
+
+/**
+ * Replace all non-overlapping occurrences of a pattern in a string
+ *
+ * Occurrences are found from left to right. The matches are counted
+ * first, so the capacity of dst_str is checked once before anything is
+ * written, and the result is written in a single pass.
+ * See sstr_replace() for the requirements on the arguments.
+ */
+sstr_rc sstr_replace_all(
+    const sstring *src_str,
+    const sstring *pat_str,
+    const sstring *rpl_str,
+    sstring       *dst_str
+)
+{
+    return sstr_replace_count(src_str, pat_str, rpl_str, dst_str, SSTR_SIZE_T_MAX);
+}
+
+
+/**
+ * Insert a string into another string at a specified position
+ *
+ * The tail of dst_str is moved in place. src_str must not be dst_str
+ * or a view of it. Fails without modifying dst_str if dst_pos is after
+ * the end of dst_str or dst_str does not have enough capacity.
+ */
+sstr_rc sstr_insert(
+    const sstring *src_str,
+    sstring       *dst_str,
+    sstr_pos      dst_pos
+)
+{
+    sstr_rc sstr_status = SSTR_FAIL;
+
+    if (src_str != NULL && src_str != dst_str)
+    {
+        sstr_status = sstr_splice_chars(src_str->chars, src_str->len, dst_str, dst_pos, 0);
+    }
+
+    return sstr_status;
+}
+
+
+/**
+ * Remove a part of a string
+ *
+ * The tail of dst_str is moved in place, and the chars that are no
+ * longer used are zeroed, so no part of the removed data remains.
+ * Fails without modifying dst_str if the part is not inside dst_str.
+ */
+sstr_rc sstr_erase(
+    sstring  *dst_str,
+    sstr_pos dst_pos,
+    size_t   erase_len
+)
+{
+    return sstr_splice_chars("", 0, dst_str, dst_pos, erase_len);
+}
+
+
+/**
+ * Replace a part of a string with another string
+ *
+ * Removes erase_len chars at dst_pos and inserts src_str in their place;
+ * see sstr_insert() and sstr_erase()
+ */
+sstr_rc sstr_splice(
+    const sstring *src_str,
+    sstring       *dst_str,
+    sstr_pos      dst_pos,
+    size_t        erase_len
+)
+{
+    sstr_rc sstr_status = SSTR_FAIL;
+
+    if (src_str != NULL && src_str != dst_str)
+    {
+        sstr_status = sstr_splice_chars(src_str->chars, src_str->len, dst_str, dst_pos,
+                                        erase_len);
+    }
+
+    return sstr_status;
+}
+
+
+/**
+ * Find a pattern in a string, starting at start_pos
+ *
+ * With SSE2, 16 positions are tested at once for both the first and the
+ * last character of the pattern, so that few candidates remain to be
+ * compared; otherwise candidates for the first character are located
+ * with memchr().
+ * Returns SSTR_NPOS if the pattern does not occur; pat_str must not be empty
+ */
+static sstr_pos sstr_find(
+    const sstring *src_str,
+    const sstring *pat_str,
+    sstr_pos      start_pos
+)
+{
+    sstr_pos sstr_index = SSTR_NPOS;
+
+    if (src_str->len >= pat_str->len && start_pos <= src_str->len - pat_str->len)
+    {
+        // last position where the pattern fits
+        sstr_pos search_end = src_str->len - pat_str->len;
+        sstr_pos src_idx    = start_pos;
+
+        #ifdef __SSE2__
+        size_t  last_off = pat_str->len - 1;
+        __m128i first_vec = _mm_set1_epi8(pat_str->chars[0]);
+        __m128i last_vec  = _mm_set1_epi8(pat_str->chars[last_off]);
+        while (sstr_index == SSTR_NPOS && src_idx <= search_end &&
+               search_end - src_idx >= 15)
+        {
+            __m128i first_blk = _mm_loadu_si128((const __m128i *) &(src_str->chars[src_idx]));
+            __m128i last_blk  = _mm_loadu_si128((const __m128i *)
+                                                &(src_str->chars[src_idx + last_off]));
+            unsigned int mask = (unsigned int) _mm_movemask_epi8(_mm_and_si128(
+                _mm_cmpeq_epi8(first_blk, first_vec), _mm_cmpeq_epi8(last_blk, last_vec)));
+            while (sstr_index == SSTR_NPOS && mask != 0)
+            {
+                sstr_pos cand_idx = src_idx + sstr_lowbit(mask);
+                if (memcmp(&(src_str->chars[cand_idx + 1]), &(pat_str->chars[1]),
+                           last_off) == 0)
+                {
+                    sstr_index = cand_idx;
+                }
+                mask &= mask - 1;
+            }
+            src_idx += 16;
+        }
+        #endif /* __SSE2__ */
+
+        while (sstr_index == SSTR_NPOS && src_idx <= search_end)
+        {
+            const char *first_char = memchr(&(src_str->chars[src_idx]), pat_str->chars[0],
+                                            search_end - src_idx + 1);
+            if (first_char != NULL)
+            {
+                src_idx = (sstr_pos) (first_char - src_str->chars);
+                if (memcmp(first_char + 1, &(pat_str->chars[1]), pat_str->len - 1) == 0)
+                {
+                    sstr_index = src_idx;
+                }
+                ++src_idx;
+            }
+            else
+            {
+                src_idx = search_end + 1;
+            }
+        }
+    }
+
+    return sstr_index;
+}
+
+
+/**
+ * Index of the first different char of two char arrays
+ *
+ * Returns cmp_len if the char arrays are equal
+ */
+static size_t sstr_diff_idx(
+    const unsigned char *src_chars,
+    const unsigned char *pat_chars,
+    size_t              cmp_len
+)
+{
+    size_t char_idx = 0;
+    size_t diff_idx = cmp_len;
+
+    #ifdef __AVX2__
+    while (diff_idx == cmp_len && cmp_len - char_idx >= 32)
+    {
+        __m256i src_vec = _mm256_loadu_si256((const __m256i *) &(src_chars[char_idx]));
+        __m256i pat_vec = _mm256_loadu_si256((const __m256i *) &(pat_chars[char_idx]));
+        unsigned int mask = ~(unsigned int) _mm256_movemask_epi8(
+            _mm256_cmpeq_epi8(src_vec, pat_vec));
+        if (mask != 0)
+        {
+            diff_idx = char_idx + sstr_lowbit(mask);
+        }
+        else
+        {
+            char_idx += 32;
+        }
+    }
+    #endif /* __AVX2__ */
+    #ifdef __SSE2__
+    while (diff_idx == cmp_len && cmp_len - char_idx >= 16)
+    {
+        __m128i src_vec = _mm_loadu_si128((const __m128i *) &(src_chars[char_idx]));
+        __m128i pat_vec = _mm_loadu_si128((const __m128i *) &(pat_chars[char_idx]));
+        unsigned int mask = ~(unsigned int) _mm_movemask_epi8(
+            _mm_cmpeq_epi8(src_vec, pat_vec)) & 0xFFFFU;
+        if (mask != 0)
+        {
+            diff_idx = char_idx + sstr_lowbit(mask);
+        }
+        else
+        {
+            char_idx += 16;
+        }
+    }
+    #endif /* __SSE2__ */
+    while (diff_idx == cmp_len && char_idx < cmp_len)
+    {
+        if (src_chars[char_idx] != pat_chars[char_idx])
+        {
+            diff_idx = char_idx;
+        }
+        ++char_idx;
+    }
+
+    return diff_idx;
+}
+
+
+/**
+ * Replace up to max_count occurrences of a pattern, see sstr_replace_all()
+ */
+static sstr_rc sstr_replace_count(
+    const sstring *src_str,
+    const sstring *pat_str,
+    const sstring *rpl_str,
+    sstring       *dst_str,
+    size_t        max_count
+)
+{
+    sstr_rc sstr_status = SSTR_FAIL;
+
+    if (src_str != NULL && pat_str != NULL && rpl_str != NULL && dst_str != NULL &&
+        pat_str->len > 0 && pat_str != dst_str && rpl_str != dst_str &&
+        (src_str != dst_str || rpl_str->len <= pat_str->len))
+    {
+        // count the matches
+        size_t   match_count = 0;
+        sstr_pos match_idx   = sstr_find(src_str, pat_str, 0);
+        while (match_idx != SSTR_NPOS && match_count < max_count)
+        {
+            ++match_count;
+            match_idx = sstr_find(src_str, pat_str, match_idx + pat_str->len);
+        }
+
+        // the length of the result either shrinks, or grows by at most
+        // the remaining capacity of the destination
+        size_t final_len = 0;
+        int    fits      = 0;
+        if (rpl_str->len <= pat_str->len)
+        {
+            final_len = src_str->len - match_count * (pat_str->len - rpl_str->len);
+            fits = dst_str->cap >= final_len;
+        }
+        else
+        if (dst_str->cap >= src_str->len)
+        {
+            size_t grow_len = rpl_str->len - pat_str->len;
+            fits = match_count <= (dst_str->cap - src_str->len) / grow_len;
+            final_len = src_str->len + match_count * grow_len;
+        }
+
+        if (fits)
+        {
+            // copy the chars between the matches and the replacements;
+            // if src_str is dst_str, the result is never ahead of the source
+            size_t   prev_len = dst_str->len;
+            sstr_pos src_idx  = 0;
+            sstr_pos dst_idx  = 0;
+            for (size_t match_nr = 0; match_nr < match_count; ++match_nr)
+            {
+                match_idx = sstr_find(src_str, pat_str, src_idx);
+                memmove(&(dst_str->chars[dst_idx]), &(src_str->chars[src_idx]),
+                        match_idx - src_idx);
+                dst_idx += match_idx - src_idx;
+                memcpy(&(dst_str->chars[dst_idx]), rpl_str->chars, rpl_str->len);
+                dst_idx += rpl_str->len;
+                src_idx = match_idx + pat_str->len;
+            }
+            memmove(&(dst_str->chars[dst_idx]), &(src_str->chars[src_idx]),
+                    src_str->len - src_idx);
+
+            // zero the chars after the result that held the previous contents
+            if (prev_len > final_len)
+            {
+                memset(&(dst_str->chars[final_len + 1]), '\0', prev_len - final_len);
+            }
+
+            // update destination secureString length
+            dst_str->len = final_len;
+            // terminate destination secureString with a null-character
+            dst_str->chars[dst_str->len] = '\0';
+
+            sstr_status = SSTR_PASS;
+        }
+    }
+
+    return sstr_status;
+}
+
+
+/**
+ * Replace erase_len chars of a string at dst_pos with src_len chars,
+ * see sstr_splice()
+ *
+ * The position, the length of the removed part and the capacity are
+ * checked before anything is modified.
+ */
+static sstr_rc sstr_splice_chars(
+    const char *src_chars,
+    size_t     src_len,
+    sstring    *dst_str,
+    sstr_pos   dst_pos,
+    size_t     erase_len
+)
+{
+    sstr_rc sstr_status = SSTR_FAIL;
+
+    if (dst_str != NULL && dst_pos <= dst_str->len &&
+        erase_len <= dst_str->len - dst_pos &&
+        src_len <= dst_str->cap - (dst_str->len - erase_len))
+    {
+        size_t prev_len  = dst_str->len;
+        size_t final_len = prev_len - erase_len + src_len;
+
+        // move the tail, then copy the inserted chars into the gap
+        memmove(&(dst_str->chars[dst_pos + src_len]),
+                &(dst_str->chars[dst_pos + erase_len]),
+                prev_len - dst_pos - erase_len);
+        memcpy(&(dst_str->chars[dst_pos]), src_chars, src_len);
+
+        // zero the chars after the new end that held the previous tail
+        if (prev_len > final_len)
+        {
+            memset(&(dst_str->chars[final_len + 1]), '\0', prev_len - final_len);
+        }
+
+        // update destination secureString length
+        dst_str->len = final_len;
+        // terminate destination secureString with a null-character
+        dst_str->chars[dst_str->len] = '\0';
+
+        sstr_status = SSTR_PASS;
+    }
+
+    return sstr_status;
+}
+
+
+#ifdef __SSE2__
+/**
+ * Index of the lowest set bit of a nonzero mask
+ */
+static unsigned int sstr_lowbit(
+    unsigned int mask
+)
+{
+    #ifdef __GNUC__
+    unsigned int bit_idx = (unsigned int) __builtin_ctz(mask);
+    #else
+    unsigned int bit_idx = 0;
+    while ((mask & 1) == 0)
+    {
+        mask >>= 1;
+        ++bit_idx;
+    }
+    #endif /* __GNUC__ */
+
+    return bit_idx;
+}
+#endif /* __SSE2__ */
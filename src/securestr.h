@@ -118,8 +118,8 @@ void sstr_dealloc(
  * Copy a string to another string (overwrite)
  */
 sstr_rc sstr_cpy(
-    sstring *src_str,
-    sstring *dst_str
+    const sstring *src_str,
+    sstring       *dst_str
 );
 
 
@@ -127,8 +127,8 @@ sstr_rc sstr_cpy(
  * Append a string to another string
  */
 sstr_rc sstr_appd(
-    sstring *src_str,
-    sstring *dst_str
+    const sstring *src_str,
+    sstring       *dst_str
 );
 
 
@@ -220,6 +220,21 @@ sstr_rc sstr_cmp(
 );
 
 
+/**
+ * Compare two strings in lexicographic order
+ *
+ * Chars are compared as unsigned values, 16 or 32 at a time if SSE2 or
+ * AVX2 is available; a string that is a prefix of another string orders
+ * first. dst_order is set to -1, 0 or 1 if src_str orders before, equal to
+ * or after pat_str.
+ */
+sstr_rc sstr_order(
+    const sstring *src_str,
+    const sstring *pat_str,
+    int           *dst_order
+);
+
+
 /**
  * Compare the head part of two strings
  */
@@ -242,10 +257,10 @@ sstr_rc sstr_endswith(
  * Extract a substring from a string
  */
 sstr_rc sstr_substr(
-    sstring  *src_str,
-    sstring  *dst_str,
-    sstr_pos start_pos,
-    size_t   substr_len
+    const sstring *src_str,
+    sstring       *dst_str,
+    sstr_pos      start_pos,
+    size_t        substr_len
 );
 
 
@@ -253,10 +268,10 @@ sstr_rc sstr_substr(
  * Extract a substring from a string and append it to another string
  */
 sstr_rc sstr_appdsubstr(
-    sstring  *src_str,
-    sstring  *dst_str,
-    sstr_pos start_pos,
-    size_t   substr_len
+    const sstring *src_str,
+    sstring       *dst_str,
+    sstr_pos      start_pos,
+    size_t        substr_len
 );
 
 
@@ -269,6 +284,82 @@ sstr_pos sstr_indexof(
 );
 
 
+/**
+ * Replace the first occurrence of a pattern in a string
+ *
+ * src_str and dst_str may be the same string if rpl_str is not longer
+ * than pat_str; otherwise they must be different strings. pat_str and
+ * rpl_str must not be dst_str. If the pattern does not occur, src_str
+ * is copied. Chars of dst_str that are no longer used are zeroed.
+ * Fails without modifying dst_str if pat_str is empty or dst_str does
+ * not have enough capacity.
+ */
+sstr_rc sstr_replace(
+    const sstring *src_str,
+    const sstring *pat_str,
+    const sstring *rpl_str,
+    sstring       *dst_str
+);
+
+
+/**
+ * Replace all non-overlapping occurrences of a pattern in a string
+ *
+ * Occurrences are found from left to right. The matches are counted
+ * first, so the capacity of dst_str is checked once before anything is
+ * written, and the result is written in a single pass.
+ * See sstr_replace() for the requirements on the arguments.
+ */
+sstr_rc sstr_replace_all(
+    const sstring *src_str,
+    const sstring *pat_str,
+    const sstring *rpl_str,
+    sstring       *dst_str
+);
+
+
+/**
+ * Insert a string into another string at a specified position
+ *
+ * The tail of dst_str is moved in place. src_str must not be dst_str
+ * or a view of it. Fails without modifying dst_str if dst_pos is after
+ * the end of dst_str or dst_str does not have enough capacity.
+ */
+sstr_rc sstr_insert(
+    const sstring *src_str,
+    sstring       *dst_str,
+    sstr_pos      dst_pos
+);
+
+
+/**
+ * Remove a part of a string
+ *
+ * The tail of dst_str is moved in place, and the chars that are no
+ * longer used are zeroed, so no part of the removed data remains.
+ * Fails without modifying dst_str if the part is not inside dst_str.
+ */
+sstr_rc sstr_erase(
+    sstring  *dst_str,
+    sstr_pos dst_pos,
+    size_t   erase_len
+);
+
+
+/**
+ * Replace a part of a string with another string
+ *
+ * Removes erase_len chars at dst_pos and inserts src_str in their place;
+ * see sstr_insert() and sstr_erase()
+ */
+sstr_rc sstr_splice(
+    const sstring *src_str,
+    sstring       *dst_str,
+    sstr_pos      dst_pos,
+    size_t        erase_len
+);
+
+
 #define sString         sstring
 
 #define sstrVersion     sstr_version
@@ -282,9 +373,15 @@ sstr_pos sstr_indexof(
 #define sstrAppdSubstr  sstr_appdsubstr
 #define sstrTrunc       sstr_trunc
 #define sstrCmp         sstr_cmp
+#define sstrOrder       sstr_order
 #define sstrStartsWith  sstr_startswith
 #define sstrEndsWith    sstr_endswith
 #define sstrIndexOf     sstr_indexof
+#define sstrReplace     sstr_replace
+#define sstrReplaceAll  sstr_replace_all
+#define sstrInsert      sstr_insert
+#define sstrErase       sstr_erase
+#define sstrSplice      sstr_splice
 #define sstrGetChar     sstr_getchar
 #define sstrSetChar     sstr_setchar
 #define sstrSwap        sstr_swap
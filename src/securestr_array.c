@@ -0,0 +1,859 @@
+/**
+ * secureStrings library
+ * version 0.54-beta (2014-10-25_001)
+ *
+ * secureStrings array container
+ *
+ * Copyright (C) 2010, 2014 Robert ALTNOEDER
+ *
+ * Redistribution and use in source and binary forms,
+ * with or without modification, are permitted provided that
+ * the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in
+ *     the documentation and/or other materials provided with the distribution.
+ *  3. The name of the author may not be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <unistd.h>
+#include <sys/types.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <securestr.h>
+#include <securestr_array.h>
+
+#ifdef __SSE2__
+    #include <emmintrin.h>
+#endif
+#ifdef __AVX2__
+    #include <immintrin.h>
+#endif
+
+#ifndef _SSTR_NO_DYNMEM
+// sstr_sort() sorts the strings by a cached 8 char section of their
+// contents, so that most comparisons do not access the strings
+typedef struct sstr_sort_entry_struct
+{
+    // chars depth ... depth + 7 in big endian order, zero-padded
+    uint64_t key;
+    sstring  *str;
+}
+sstr_sort_entry;
+
+// ranges below this size are sorted by insertion sort
+#define SSTR_SORT_SMALL ((size_t) 16)
+#endif /* not _SSTR_NO_DYNMEM */
+
+#ifdef __SSE2__
+static unsigned int sstr_array_lowbit(
+    unsigned int mask
+);
+#endif /* __SSE2__ */
+static size_t sstr_array_next_len(
+    const size_t *lengths,
+    size_t       count,
+    size_t       arr_idx,
+    size_t       str_len
+);
+static int sstr_array_order_chars(
+    const unsigned char *src_chars,
+    size_t              src_len,
+    const unsigned char *pat_chars,
+    size_t              pat_len
+);
+static size_t sstr_array_diff_idx(
+    const unsigned char *src_chars,
+    const unsigned char *pat_chars,
+    size_t              cmp_len
+);
+#ifndef _SSTR_NO_DYNMEM
+static uint64_t sstr_array_sort_key(
+    const sstring *src_str,
+    size_t        depth
+);
+static void sstr_array_sort_small(
+    sstr_sort_entry *dst_entries,
+    size_t          count,
+    size_t          depth
+);
+static void sstr_array_sort_range(
+    sstr_sort_entry *dst_entries,
+    size_t          count,
+    size_t          depth
+);
+#endif /* not _SSTR_NO_DYNMEM */
+
+
+#ifndef _SSTR_NO_DYNMEM
+/**
+ * Allocate an array of secureStrings
+ *
+ * chars_cap is the number of char elements that will be available for
+ * storing strings, including one trailing null character per string
+ *
+ * count_cap is the maximum number of strings in the array
+ */
+sstr_array *sstr_array_alloc(
+    size_t chars_cap,
+    size_t count_cap
+)
+{
+    sstr_array *dst_arr = NULL;
+
+    if (chars_cap <= SSTR_CAP_MAX &&
+        count_cap <= SSTR_SIZE_T_MAX / sizeof (size_t))
+    {
+        dst_arr = malloc(sizeof (sstr_array));
+        if (dst_arr != NULL)
+        {
+            // allocate at least one element for each table, so that
+            // an array with a count_cap of zero is still valid
+            size_t table_size = (count_cap > 0 ? count_cap : 1) * sizeof (size_t);
+
+            dst_arr->chars   = malloc(chars_cap + 1);
+            dst_arr->offsets = malloc(table_size);
+            dst_arr->lengths = malloc(table_size);
+            if (dst_arr->chars != NULL && dst_arr->offsets != NULL &&
+                dst_arr->lengths != NULL)
+            {
+                dst_arr->cap       = chars_cap;
+                dst_arr->len       = 0;
+                dst_arr->count_cap = count_cap;
+                dst_arr->count     = 0;
+                dst_arr->chars[0]  = '\0';
+            }
+            else
+            {
+                free(dst_arr->chars);
+                free(dst_arr->offsets);
+                free(dst_arr->lengths);
+                free(dst_arr);
+                dst_arr = NULL;
+            }
+        }
+    }
+
+    return dst_arr;
+}
+#endif /* not _SSTR_NO_DYNMEM */
+
+
+#ifndef _SSTR_NO_DYNMEM
+/**
+ * Deallocate an array of secureStrings
+ */
+void sstr_array_dealloc(
+    sstr_array *dst_arr
+)
+{
+    if (dst_arr != NULL)
+    {
+        free(dst_arr->chars);
+        free(dst_arr->offsets);
+        free(dst_arr->lengths);
+        free(dst_arr);
+    }
+}
+#endif /* not _SSTR_NO_DYNMEM */
+
+
+/**
+ * Append a string to an array
+ */
+sstr_rc sstr_array_appd(
+    const sstring *src_str,
+    sstr_array    *dst_arr
+)
+{
+    sstr_rc sstr_status = SSTR_FAIL;
+
+    if (src_str != NULL && dst_arr != NULL)
+    {
+        // check whether the array has a free table slot and enough
+        // capacity for the string and its trailing null character
+        if (dst_arr->count < dst_arr->count_cap &&
+            (dst_arr->cap - dst_arr->len) > src_str->len)
+        {
+            sstr_pos dst_idx = dst_arr->len;
+
+            memcpy(&(dst_arr->chars[dst_idx]), src_str->chars, src_str->len);
+            dst_arr->chars[dst_idx + src_str->len] = '\0';
+
+            dst_arr->offsets[dst_arr->count] = dst_idx;
+            dst_arr->lengths[dst_arr->count] = src_str->len;
+            ++(dst_arr->count);
+
+            // update the used length of the array's buffer
+            dst_arr->len += src_str->len + 1;
+
+            sstr_status = SSTR_PASS;
+        }
+    }
+
+    return sstr_status;
+}
+
+
+/**
+ * Query the number of strings in an array
+ */
+size_t sstr_array_count(
+    const sstr_array *src_arr
+)
+{
+    size_t sstr_result = SSTR_SIZE_FAIL;
+
+    if (src_arr != NULL)
+    {
+        sstr_result = src_arr->count;
+    }
+
+    return sstr_result;
+}
+
+
+/**
+ * Get a view of the string at a specified index in an array
+ *
+ * The view refers to the array's buffer and remains valid
+ * until the array is cleared, wiped or deallocated
+ */
+sstr_rc sstr_array_view(
+    const sstr_array *src_arr,
+    sstring          *dst_view,
+    sstr_pos         arr_idx
+)
+{
+    sstr_rc sstr_status = SSTR_FAIL;
+
+    if (src_arr != NULL && dst_view != NULL)
+    {
+        if (arr_idx < src_arr->count)
+        {
+            dst_view->chars = &(src_arr->chars[src_arr->offsets[arr_idx]]);
+            dst_view->cap   = src_arr->lengths[arr_idx];
+            dst_view->len   = src_arr->lengths[arr_idx];
+
+            sstr_status = SSTR_PASS;
+        }
+    }
+
+    return sstr_status;
+}
+
+
+/**
+ * Clear an array (remove all strings)
+ */
+sstr_rc sstr_array_clear(
+    sstr_array *dst_arr
+)
+{
+    sstr_rc sstr_status = SSTR_FAIL;
+
+    if (dst_arr != NULL)
+    {
+        dst_arr->len      = 0;
+        dst_arr->count    = 0;
+        dst_arr->chars[0] = '\0';
+
+        sstr_status = SSTR_PASS;
+    }
+
+    return sstr_status;
+}
+
+
+/**
+ * Clear an array by overwriting all strings with null characters
+ */
+sstr_rc sstr_array_wipe(
+    sstr_array *dst_arr
+)
+{
+    sstr_rc sstr_status = SSTR_FAIL;
+
+    if (dst_arr != NULL)
+    {
+        // the real capacity of the buffer is cap + 1, see sstr_wipe()
+        memset(dst_arr->chars, '\0', dst_arr->cap + 1);
+        // the tables do not contain secrets, but the lengths of
+        // the strings that were stored should not remain either
+        memset(dst_arr->offsets, 0, dst_arr->count * sizeof (sstr_pos));
+        memset(dst_arr->lengths, 0, dst_arr->count * sizeof (size_t));
+        dst_arr->len   = 0;
+        dst_arr->count = 0;
+
+        sstr_status = SSTR_PASS;
+    }
+
+    return sstr_status;
+}
+
+
+/**
+ * Find a string in an array
+ *
+ * The lengths of many strings are compared at once; only strings of
+ * the same length are compared char by char.
+ * Returns the index of the first string that is equal to src_str,
+ * or SSTR_NPOS if the array does not contain such a string
+ */
+sstr_pos sstr_cmp_any(
+    const sstring    *src_str,
+    const sstr_array *set_arr
+)
+{
+    sstr_pos match_idx = SSTR_NPOS;
+
+    if (src_str != NULL && set_arr != NULL)
+    {
+        size_t arr_idx = sstr_array_next_len(set_arr->lengths, set_arr->count, 0,
+                                             src_str->len);
+        while (match_idx == SSTR_NPOS && arr_idx < set_arr->count)
+        {
+            if (memcmp(&(set_arr->chars[set_arr->offsets[arr_idx]]), src_str->chars,
+                       src_str->len) == 0)
+            {
+                match_idx = arr_idx;
+            }
+            else
+            {
+                arr_idx = sstr_array_next_len(set_arr->lengths, set_arr->count,
+                                              arr_idx + 1, src_str->len);
+            }
+        }
+    }
+
+    return match_idx;
+}
+
+
+/**
+ * Find a string in an array in constant time
+ *
+ * Every char of every string in the array is compared, and the result
+ * is selected without branches, so the time depends only on the number
+ * and the lengths of the strings in the array, not on src_str or on
+ * the position of a match.
+ * Returns the index of the first string that is equal to src_str,
+ * or SSTR_NPOS if the array does not contain such a string
+ */
+sstr_pos sstr_cmp_any_ct(
+    const sstring    *src_str,
+    const sstr_array *set_arr
+)
+{
+    sstr_pos match_idx = SSTR_NPOS;
+
+    if (src_str != NULL && set_arr != NULL)
+    {
+        const unsigned char *src_chars = (const unsigned char *) src_str->chars;
+        size_t              src_len    = src_str->len;
+        // 1 once a match has been found
+        size_t              found      = 0;
+        for (size_t arr_idx = 0; arr_idx < set_arr->count; ++arr_idx)
+        {
+            const unsigned char *set_chars = (const unsigned char *)
+                                             &(set_arr->chars[set_arr->offsets[arr_idx]]);
+            size_t              set_len    = set_arr->lengths[arr_idx];
+
+            // nonzero if the strings differ
+            size_t diff = set_len ^ src_len;
+            for (size_t char_idx = 0; char_idx < set_len; ++char_idx)
+            {
+                // chars after the end of src_str are compared with its first
+                // char; such strings already differ in length
+                size_t inside = (size_t) 0 - (size_t) (char_idx < src_len);
+                diff |= (size_t) (set_chars[char_idx] ^ src_chars[char_idx & inside]);
+            }
+
+            // 1 if diff is zero
+            size_t equal  = ((diff | ((size_t) 0 - diff)) >> (sizeof (size_t) * 8 - 1)) ^ 1;
+            // all bits set if this is the first match
+            size_t select = (size_t) 0 - (equal & (found ^ 1));
+            match_idx = (match_idx & ~select) | (arr_idx & select);
+            found |= equal;
+        }
+    }
+
+    return match_idx;
+}
+
+
+#ifndef _SSTR_NO_DYNMEM
+/**
+ * Sort an array of strings in lexicographic order, see sstr_order()
+ *
+ * Only the pointers are moved, the contents of the strings are not copied.
+ * Multikey quicksort on 8 char sections of the strings that are cached
+ * together with the pointers; the cache is wiped before it is deallocated.
+ * Fails without modifying dst_strs if a string is NULL or the cache
+ * cannot be allocated.
+ */
+sstr_rc sstr_sort(
+    sstring **dst_strs,
+    size_t  count
+)
+{
+    sstr_rc sstr_status = SSTR_FAIL;
+
+    if (dst_strs != NULL && count <= SSTR_SIZE_T_MAX / sizeof (sstr_sort_entry))
+    {
+        int valid = 1;
+        for (size_t str_idx = 0; valid && str_idx < count; ++str_idx)
+        {
+            valid = dst_strs[str_idx] != NULL;
+        }
+
+        sstr_sort_entry *entries = NULL;
+        if (valid)
+        {
+            entries = malloc((count > 0 ? count : 1) * sizeof (sstr_sort_entry));
+        }
+        if (entries != NULL)
+        {
+            for (size_t str_idx = 0; str_idx < count; ++str_idx)
+            {
+                entries[str_idx].key = sstr_array_sort_key(dst_strs[str_idx], 0);
+                entries[str_idx].str = dst_strs[str_idx];
+            }
+
+            sstr_array_sort_range(entries, count, 0);
+
+            for (size_t str_idx = 0; str_idx < count; ++str_idx)
+            {
+                dst_strs[str_idx] = entries[str_idx].str;
+                // the keys are copies of the string contents
+                volatile uint64_t *key = &(entries[str_idx].key);
+                (*key) = 0;
+            }
+            free(entries);
+
+            sstr_status = SSTR_PASS;
+        }
+    }
+
+    return sstr_status;
+}
+#endif /* not _SSTR_NO_DYNMEM */
+
+
+#ifdef __SSE2__
+/**
+ * Index of the lowest set bit of a nonzero mask
+ */
+static unsigned int sstr_array_lowbit(
+    unsigned int mask
+)
+{
+    #ifdef __GNUC__
+    unsigned int bit_idx = (unsigned int) __builtin_ctz(mask);
+    #else
+    unsigned int bit_idx = 0;
+    while ((mask & 1) == 0)
+    {
+        mask >>= 1;
+        ++bit_idx;
+    }
+    #endif /* __GNUC__ */
+
+    return bit_idx;
+}
+#endif /* __SSE2__ */
+
+
+/**
+ * Find the next string of a specified length, starting at arr_idx
+ *
+ * With 64 bit lengths, eight lengths are compared per iteration.
+ * Returns count if there is no such string
+ */
+static size_t sstr_array_next_len(
+    const size_t *lengths,
+    size_t       count,
+    size_t       arr_idx,
+    size_t       str_len
+)
+{
+    size_t match_idx = count;
+
+    #if defined(__SSE2__) && SIZE_MAX == UINT64_MAX
+    #ifdef __AVX2__
+    __m256i len_vec = _mm256_set1_epi64x((long long) str_len);
+    while (match_idx == count && count - arr_idx >= 8)
+    {
+        __m256i lens_0 = _mm256_loadu_si256((const __m256i *) &(lengths[arr_idx]));
+        __m256i lens_4 = _mm256_loadu_si256((const __m256i *) &(lengths[arr_idx + 4]));
+        unsigned int mask =
+            (unsigned int) _mm256_movemask_pd(_mm256_castsi256_pd(
+                _mm256_cmpeq_epi64(lens_0, len_vec))) |
+            (unsigned int) _mm256_movemask_pd(_mm256_castsi256_pd(
+                _mm256_cmpeq_epi64(lens_4, len_vec))) << 4;
+        if (mask != 0)
+        {
+            match_idx = arr_idx + sstr_array_lowbit(mask);
+        }
+        else
+        {
+            arr_idx += 8;
+        }
+    }
+    #else
+    // SSE2 compares 32 bit halves; a length matches if both halves match
+    __m128i len_vec = _mm_set1_epi64x((long long) str_len);
+    while (match_idx == count && count - arr_idx >= 8)
+    {
+        unsigned int mask = 0;
+        for (size_t vec_nr = 0; vec_nr < 4; ++vec_nr)
+        {
+            __m128i lens  = _mm_loadu_si128((const __m128i *) &(lengths[arr_idx + vec_nr * 2]));
+            __m128i halfs = _mm_cmpeq_epi32(lens, len_vec);
+            __m128i equal = _mm_and_si128(halfs, _mm_shuffle_epi32(halfs, 0xB1));
+            mask |= (unsigned int) _mm_movemask_pd(_mm_castsi128_pd(equal)) << (vec_nr * 2);
+        }
+        if (mask != 0)
+        {
+            match_idx = arr_idx + sstr_array_lowbit(mask);
+        }
+        else
+        {
+            arr_idx += 8;
+        }
+    }
+    #endif /* __AVX2__ */
+    #endif /* __SSE2__ && 64 bit size_t */
+
+    while (match_idx == count && arr_idx < count)
+    {
+        if (lengths[arr_idx] == str_len)
+        {
+            match_idx = arr_idx;
+        }
+        ++arr_idx;
+    }
+
+    return match_idx;
+}
+
+
+/**
+ * Lexicographic order of two char arrays, see sstr_order()
+ */
+static int sstr_array_order_chars(
+    const unsigned char *src_chars,
+    size_t              src_len,
+    const unsigned char *pat_chars,
+    size_t              pat_len
+)
+{
+    size_t min_len  = src_len < pat_len ? src_len : pat_len;
+    size_t diff_idx = sstr_array_diff_idx(src_chars, pat_chars, min_len);
+
+    int order = 0;
+    if (diff_idx < min_len)
+    {
+        order = src_chars[diff_idx] < pat_chars[diff_idx] ? -1 : 1;
+    }
+    else
+    if (src_len != pat_len)
+    {
+        order = src_len < pat_len ? -1 : 1;
+    }
+
+    return order;
+}
+
+
+/**
+ * Index of the first different char of two char arrays
+ *
+ * Returns cmp_len if the char arrays are equal
+ */
+static size_t sstr_array_diff_idx(
+    const unsigned char *src_chars,
+    const unsigned char *pat_chars,
+    size_t              cmp_len
+)
+{
+    size_t char_idx = 0;
+    size_t diff_idx = cmp_len;
+
+    #ifdef __AVX2__
+    while (diff_idx == cmp_len && cmp_len - char_idx >= 32)
+    {
+        __m256i src_vec = _mm256_loadu_si256((const __m256i *) &(src_chars[char_idx]));
+        __m256i pat_vec = _mm256_loadu_si256((const __m256i *) &(pat_chars[char_idx]));
+        unsigned int mask = ~(unsigned int) _mm256_movemask_epi8(
+            _mm256_cmpeq_epi8(src_vec, pat_vec));
+        if (mask != 0)
+        {
+            diff_idx = char_idx + sstr_array_lowbit(mask);
+        }
+        else
+        {
+            char_idx += 32;
+        }
+    }
+    #endif /* __AVX2__ */
+    #ifdef __SSE2__
+    while (diff_idx == cmp_len && cmp_len - char_idx >= 16)
+    {
+        __m128i src_vec = _mm_loadu_si128((const __m128i *) &(src_chars[char_idx]));
+        __m128i pat_vec = _mm_loadu_si128((const __m128i *) &(pat_chars[char_idx]));
+        unsigned int mask = ~(unsigned int) _mm_movemask_epi8(
+            _mm_cmpeq_epi8(src_vec, pat_vec)) & 0xFFFFU;
+        if (mask != 0)
+        {
+            diff_idx = char_idx + sstr_array_lowbit(mask);
+        }
+        else
+        {
+            char_idx += 16;
+        }
+    }
+    #endif /* __SSE2__ */
+    while (diff_idx == cmp_len && char_idx < cmp_len)
+    {
+        if (src_chars[char_idx] != pat_chars[char_idx])
+        {
+            diff_idx = char_idx;
+        }
+        ++char_idx;
+    }
+
+    return diff_idx;
+}
+
+
+#ifndef _SSTR_NO_DYNMEM
+/**
+ * Chars depth ... depth + 7 of a string as a big endian number,
+ * so that numeric order is lexicographic order
+ *
+ * Chars after the end of the string are zero
+ */
+static uint64_t sstr_array_sort_key(
+    const sstring *src_str,
+    size_t        depth
+)
+{
+    uint64_t key = 0;
+    if (src_str->len >= depth + 8)
+    {
+        const unsigned char *key_chars = (const unsigned char *) &(src_str->chars[depth]);
+        key = (uint64_t) key_chars[0] << 56 | (uint64_t) key_chars[1] << 48 |
+              (uint64_t) key_chars[2] << 40 | (uint64_t) key_chars[3] << 32 |
+              (uint64_t) key_chars[4] << 24 | (uint64_t) key_chars[5] << 16 |
+              (uint64_t) key_chars[6] << 8  | (uint64_t) key_chars[7];
+    }
+    else
+    {
+        for (size_t char_idx = depth; char_idx < depth + 8; ++char_idx)
+        {
+            key <<= 8;
+            if (char_idx < src_str->len)
+            {
+                key |= (unsigned char) src_str->chars[char_idx];
+            }
+        }
+    }
+
+    return key;
+}
+
+
+/**
+ * Insertion sort of a small range whose strings share their first
+ * depth chars
+ */
+static void sstr_array_sort_small(
+    sstr_sort_entry *dst_entries,
+    size_t          count,
+    size_t          depth
+)
+{
+    for (size_t entry_idx = 1; entry_idx < count; ++entry_idx)
+    {
+        sstr_sort_entry entry  = dst_entries[entry_idx];
+        size_t          dst_idx = entry_idx;
+        int             before  = 1;
+        while (dst_idx > 0 && before)
+        {
+            const sstr_sort_entry *prev = &(dst_entries[dst_idx - 1]);
+            if (entry.key != prev->key)
+            {
+                before = entry.key < prev->key;
+            }
+            else
+            {
+                // equal keys: compare the remaining chars
+                size_t entry_len = entry.str->len > depth ? entry.str->len - depth : 0;
+                size_t prev_len  = prev->str->len > depth ? prev->str->len - depth : 0;
+                before = sstr_array_order_chars(
+                    (const unsigned char *) &(entry.str->chars[entry_len > 0 ? depth : 0]),
+                    entry_len,
+                    (const unsigned char *) &(prev->str->chars[prev_len > 0 ? depth : 0]),
+                    prev_len) < 0;
+            }
+            if (before)
+            {
+                dst_entries[dst_idx] = dst_entries[dst_idx - 1];
+                --dst_idx;
+            }
+        }
+        dst_entries[dst_idx] = entry;
+    }
+}
+
+
+/**
+ * Multikey quicksort of a range whose strings share their first depth
+ * chars; the keys of the entries hold chars depth ... depth + 7
+ *
+ * The range is partitioned into keys less than, equal to and greater than
+ * the pivot. Strings with equal keys that end within the key order first,
+ * by length; the others are sorted by their next 8 chars. The largest
+ * part is sorted by the loop and the other parts recursively, so the
+ * recursion depth is logarithmic.
+ */
+static void sstr_array_sort_range(
+    sstr_sort_entry *dst_entries,
+    size_t          count,
+    size_t          depth
+)
+{
+    while (count >= SSTR_SORT_SMALL)
+    {
+        // median of three
+        uint64_t key_a = dst_entries[0].key;
+        uint64_t key_b = dst_entries[count / 2].key;
+        uint64_t key_c = dst_entries[count - 1].key;
+        uint64_t pivot = key_a < key_b ?
+                         (key_b < key_c ? key_b : (key_a < key_c ? key_c : key_a)) :
+                         (key_a < key_c ? key_a : (key_b < key_c ? key_c : key_b));
+
+        // [0, less_end) < pivot, [less_end, scan_idx) == pivot,
+        // [greater_begin, count) > pivot
+        size_t less_end      = 0;
+        size_t scan_idx      = 0;
+        size_t greater_begin = count;
+        while (scan_idx < greater_begin)
+        {
+            sstr_sort_entry entry = dst_entries[scan_idx];
+            if (entry.key < pivot)
+            {
+                dst_entries[scan_idx++] = dst_entries[less_end];
+                dst_entries[less_end++] = entry;
+            }
+            else
+            if (entry.key > pivot)
+            {
+                dst_entries[scan_idx]        = dst_entries[--greater_begin];
+                dst_entries[greater_begin]   = entry;
+            }
+            else
+            {
+                ++scan_idx;
+            }
+        }
+
+        // strings that end within the key are prefixes of the longer
+        // strings with the same key, so they are moved to the front
+        sstr_sort_entry *equal       = &(dst_entries[less_end]);
+        size_t          equal_count  = greater_begin - less_end;
+        size_t          ended_count  = 0;
+        for (size_t entry_idx = 0; entry_idx < equal_count; ++entry_idx)
+        {
+            if (equal[entry_idx].str->len <= depth + 8)
+            {
+                sstr_sort_entry entry  = equal[entry_idx];
+                equal[entry_idx]       = equal[ended_count];
+                equal[ended_count++]   = entry;
+            }
+        }
+        // and sorted by their length, which is at most 8 chars more
+        // than depth
+        size_t sorted_count = 0;
+        for (size_t rest_len = 0; rest_len <= 8 && sorted_count < ended_count; ++rest_len)
+        {
+            for (size_t entry_idx = sorted_count; entry_idx < ended_count; ++entry_idx)
+            {
+                size_t entry_len = equal[entry_idx].str->len;
+                if ((entry_len > depth ? entry_len - depth : 0) == rest_len)
+                {
+                    sstr_sort_entry entry  = equal[entry_idx];
+                    equal[entry_idx]       = equal[sorted_count];
+                    equal[sorted_count++]  = entry;
+                }
+            }
+        }
+        sstr_sort_entry *next       = &(equal[ended_count]);
+        size_t          next_count  = equal_count - ended_count;
+        size_t          next_depth  = depth + 8;
+        if (next_count == count)
+        {
+            // all strings continue after the key; skip their common prefix
+            // instead of stepping through it 8 chars at a time
+            const sstring *first_str = next[0].str;
+            size_t        common_len = first_str->len;
+            for (size_t entry_idx = 1; entry_idx < next_count; ++entry_idx)
+            {
+                const sstring *entry_str = next[entry_idx].str;
+                size_t        cmp_len    = entry_str->len < common_len ?
+                                           entry_str->len : common_len;
+                common_len = next_depth + sstr_array_diff_idx(
+                    (const unsigned char *) &(first_str->chars[next_depth]),
+                    (const unsigned char *) &(entry_str->chars[next_depth]),
+                    cmp_len - next_depth);
+            }
+            next_depth = common_len;
+        }
+        for (size_t entry_idx = 0; entry_idx < next_count; ++entry_idx)
+        {
+            next[entry_idx].key = sstr_array_sort_key(next[entry_idx].str, next_depth);
+        }
+
+        size_t greater_count = count - greater_begin;
+        if (next_count >= less_end && next_count >= greater_count)
+        {
+            sstr_array_sort_range(dst_entries, less_end, depth);
+            sstr_array_sort_range(&(dst_entries[greater_begin]), greater_count, depth);
+            dst_entries = next;
+            count       = next_count;
+            depth       = next_depth;
+        }
+        else
+        if (less_end >= greater_count)
+        {
+            sstr_array_sort_range(next, next_count, next_depth);
+            sstr_array_sort_range(&(dst_entries[greater_begin]), greater_count, depth);
+            count = less_end;
+        }
+        else
+        {
+            sstr_array_sort_range(dst_entries, less_end, depth);
+            sstr_array_sort_range(next, next_count, next_depth);
+            dst_entries = &(dst_entries[greater_begin]);
+            count       = greater_count;
+        }
+    }
+    sstr_array_sort_small(dst_entries, count, depth);
+}
+#endif /* not _SSTR_NO_DYNMEM */
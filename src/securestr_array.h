@@ -0,0 +1,198 @@
+/**
+ * secureStrings library
+ * version 0.54-beta (2014-10-25_001)
+ *
+ * secureStrings array container
+ *
+ * Copyright (C) 2010, 2014 Robert ALTNOEDER
+ *
+ * Redistribution and use in source and binary forms,
+ * with or without modification, are permitted provided that
+ * the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in
+ *     the documentation and/or other materials provided with the distribution.
+ *  3. The name of the author may not be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _SECURESTR_ARRAY_H
+#define _SECURESTR_ARRAY_H
+
+#include <unistd.h>
+#include <sys/types.h>
+#include <stdlib.h>
+#include <securestr.h>
+
+// An sstr_array packs many strings into one contiguous char buffer
+//
+// The offset and length of each string are kept in two separate
+// tables, so that scanning the lengths does not touch the string data
+// and wiping or freeing all strings is a single operation.
+//
+// Each packed string is followed by a null character, so a view of
+// a packed string behaves like a secureString with (cap == len).
+//
+// Like a secureString, an sstr_array has a fixed capacity and is
+// never reallocated, so no copies of its contents are left behind.
+typedef struct sstr_array_struct
+{
+    char     *chars;
+    size_t   cap;
+    size_t   len;
+    sstr_pos *offsets;
+    size_t   *lengths;
+    size_t   count_cap;
+    size_t   count;
+}
+sstr_array;
+
+
+#ifndef _SSTR_NO_DYNMEM
+/**
+ * Allocate an array of secureStrings
+ *
+ * chars_cap is the number of char elements that will be available for
+ * storing strings, including one trailing null character per string
+ *
+ * count_cap is the maximum number of strings in the array
+ */
+sstr_array *sstr_array_alloc(
+    size_t chars_cap,
+    size_t count_cap
+);
+#endif /* not _SSTR_NO_DYNMEM */
+
+
+#ifndef _SSTR_NO_DYNMEM
+/**
+ * Deallocate an array of secureStrings
+ */
+void sstr_array_dealloc(
+    sstr_array *dst_arr
+);
+#endif /* not _SSTR_NO_DYNMEM */
+
+
+/**
+ * Append a string to an array
+ */
+sstr_rc sstr_array_appd(
+    const sstring *src_str,
+    sstr_array    *dst_arr
+);
+
+
+/**
+ * Query the number of strings in an array
+ */
+size_t sstr_array_count(
+    const sstr_array *src_arr
+);
+
+
+/**
+ * Get a view of the string at a specified index in an array
+ *
+ * The view refers to the array's buffer and remains valid
+ * until the array is cleared, wiped or deallocated
+ */
+sstr_rc sstr_array_view(
+    const sstr_array *src_arr,
+    sstring          *dst_view,
+    sstr_pos         arr_idx
+);
+
+
+/**
+ * Clear an array (remove all strings)
+ */
+sstr_rc sstr_array_clear(
+    sstr_array *dst_arr
+);
+
+
+/**
+ * Clear an array by overwriting all strings with null characters
+ */
+sstr_rc sstr_array_wipe(
+    sstr_array *dst_arr
+);
+
+
+/**
+ * Find a string in an array
+ *
+ * The lengths of many strings are compared at once; only strings of
+ * the same length are compared char by char.
+ * Returns the index of the first string that is equal to src_str,
+ * or SSTR_NPOS if the array does not contain such a string
+ */
+sstr_pos sstr_cmp_any(
+    const sstring    *src_str,
+    const sstr_array *set_arr
+);
+
+
+/**
+ * Find a string in an array in constant time
+ *
+ * Every char of every string in the array is compared, and the result
+ * is selected without branches, so the time depends only on the number
+ * and the lengths of the strings in the array, not on src_str or on
+ * the position of a match.
+ * Returns the index of the first string that is equal to src_str,
+ * or SSTR_NPOS if the array does not contain such a string
+ */
+sstr_pos sstr_cmp_any_ct(
+    const sstring    *src_str,
+    const sstr_array *set_arr
+);
+
+
+#ifndef _SSTR_NO_DYNMEM
+/**
+ * Sort an array of strings in lexicographic order, see sstr_order()
+ *
+ * Only the pointers are moved, the contents of the strings are not copied.
+ * Multikey quicksort on 8 char sections of the strings that are cached
+ * together with the pointers; the cache is wiped before it is deallocated.
+ * Fails without modifying dst_strs if a string is NULL or the cache
+ * cannot be allocated.
+ */
+sstr_rc sstr_sort(
+    sstring **dst_strs,
+    size_t  count
+);
+#endif /* not _SSTR_NO_DYNMEM */
+
+
+
+#define sstrArray           sstr_array
+
+#define sstrArrayAlloc      sstr_array_alloc
+#define sstrArrayDealloc    sstr_array_dealloc
+#define sstrArrayAppd       sstr_array_appd
+#define sstrArrayCount      sstr_array_count
+#define sstrArrayView       sstr_array_view
+#define sstrArrayClear      sstr_array_clear
+#define sstrArrayWipe       sstr_array_wipe
+#define sstrCmpAny          sstr_cmp_any
+#define sstrCmpAnyCt        sstr_cmp_any_ct
+#define sstrSort            sstr_sort
+
+#endif /* _SECURESTR_ARRAY_H */
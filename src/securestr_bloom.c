@@ -0,0 +1,469 @@
+/**
+ * secureStrings library
+ * version 0.54-beta (2014-10-25_001)
+ *
+ * secureStrings Bloom filter
+ *
+ * Copyright (C) 2010, 2014 Robert ALTNOEDER
+ *
+ * Redistribution and use in source and binary forms,
+ * with or without modification, are permitted provided that
+ * the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in
+ *     the documentation and/or other materials provided with the distribution.
+ *  3. The name of the author may not be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <securestr.h>
+#include <securestr_array.h>
+#include <securestr_hash.h>
+#include <securestr_io.h>
+#include <securestr_bloom.h>
+
+// one block fills one cache line
+#define SSTR_BLOOM_BLOCK_WORDS ((size_t) 8)
+#define SSTR_BLOOM_BLOCK_SIZE  (SSTR_BLOOM_BLOCK_WORDS * sizeof (uint64_t))
+// the block index is taken from 32 bits of the hash value
+#define SSTR_BLOOM_BLOCKS_MAX  ((uint64_t) 1 << 32)
+// "SSTRBLM1" in a little endian file
+#define SSTR_BLOOM_MAGIC       ((uint64_t) 0x314D4C4252545353ULL)
+// the header of a saved filter has the size of one block, so that the
+// blocks of a mapped filter are aligned to cache lines
+#define SSTR_BLOOM_HEADER_WORDS SSTR_BLOOM_BLOCK_WORDS
+
+struct sstr_bloom_struct
+{
+    // block_count * SSTR_BLOOM_BLOCK_WORDS words, aligned to a cache line
+    uint64_t *words;
+    size_t   block_count;
+    // the mapped file, or NULL if the filter is allocated
+    void     *map_addr;
+    size_t   map_len;
+};
+
+// odd multipliers that select one bit in each word of a block
+static const uint32_t sstr_bloom_salts[SSTR_BLOOM_BLOCK_WORDS] =
+{
+    0x47B6137BUL, 0x44974D91UL, 0x8824AD5BUL, 0xA2B7289DUL,
+    0x705495C7UL, 0x2DF1424BUL, 0x9EFC4947UL, 0x5C6BFB31UL
+};
+
+static uint64_t *sstr_bloom_block(
+    const sstr_bloom *src_bloom,
+    const sstring    *src_str,
+    uint64_t         *dst_masks
+);
+#ifndef _SSTR_NO_DYNMEM
+static size_t sstr_bloom_add_lines(
+    const sstring *src_str,
+    sstr_bloom    *dst_bloom
+);
+#endif /* not _SSTR_NO_DYNMEM */
+
+
+#ifndef _SSTR_NO_DYNMEM
+/**
+ * Allocate an empty Bloom filter
+ *
+ * The filter is sized for key_count strings at bits_per_key bits each;
+ * 10 bits per key yield a false positive rate of about 1 %, 16 bits per
+ * key about 0.1 %. Returns NULL if the filter cannot be allocated.
+ */
+sstr_bloom *sstr_bloom_alloc(
+    size_t key_count,
+    size_t bits_per_key
+)
+{
+    sstr_bloom *dst_bloom = NULL;
+
+    if (bits_per_key > 0 && key_count <= SSTR_SIZE_T_MAX / bits_per_key)
+    {
+        size_t block_bits  = SSTR_BLOOM_BLOCK_SIZE * 8;
+        size_t block_count = (key_count * bits_per_key) / block_bits + 1;
+        if (block_count <= SSTR_BLOOM_BLOCKS_MAX &&
+            block_count <= SSTR_SIZE_T_MAX / SSTR_BLOOM_BLOCK_SIZE)
+        {
+            dst_bloom = malloc(sizeof (sstr_bloom));
+        }
+        if (dst_bloom != NULL)
+        {
+            void *words = NULL;
+            if (posix_memalign(&words, SSTR_BLOOM_BLOCK_SIZE,
+                               block_count * SSTR_BLOOM_BLOCK_SIZE) == 0)
+            {
+                memset(words, 0, block_count * SSTR_BLOOM_BLOCK_SIZE);
+                dst_bloom->words       = words;
+                dst_bloom->block_count = block_count;
+                dst_bloom->map_addr    = NULL;
+                dst_bloom->map_len     = 0;
+            }
+            else
+            {
+                free(dst_bloom);
+                dst_bloom = NULL;
+            }
+        }
+    }
+
+    return dst_bloom;
+}
+#endif /* not _SSTR_NO_DYNMEM */
+
+
+#ifndef _SSTR_NO_DYNMEM
+/**
+ * Deallocate or unmap a Bloom filter
+ */
+void sstr_bloom_dealloc(
+    sstr_bloom *dst_bloom
+)
+{
+    if (dst_bloom != NULL)
+    {
+        if (dst_bloom->map_addr != NULL)
+        {
+            munmap(dst_bloom->map_addr, dst_bloom->map_len);
+        }
+        else
+        {
+            free(dst_bloom->words);
+        }
+        free(dst_bloom);
+    }
+}
+#endif /* not _SSTR_NO_DYNMEM */
+
+
+#ifndef _SSTR_NO_DYNMEM
+/**
+ * Build a Bloom filter from all strings in an array
+ */
+sstr_bloom *sstr_bloom_from_array(
+    const sstr_array *src_arr,
+    size_t           bits_per_key
+)
+{
+    sstr_bloom *dst_bloom = NULL;
+
+    if (src_arr != NULL)
+    {
+        size_t arr_count = sstr_array_count(src_arr);
+        dst_bloom = sstr_bloom_alloc(arr_count, bits_per_key);
+        if (dst_bloom != NULL)
+        {
+            sstring src_view;
+            for (size_t arr_idx = 0; arr_idx < arr_count; ++arr_idx)
+            {
+                sstr_array_view(src_arr, &src_view, arr_idx);
+                sstr_bloom_add(&src_view, dst_bloom);
+            }
+        }
+    }
+
+    return dst_bloom;
+}
+#endif /* not _SSTR_NO_DYNMEM */
+
+
+#ifndef _SSTR_NO_DYNMEM
+/**
+ * Build a Bloom filter from the lines of a text file
+ *
+ * Lines end with '\n' or "\r\n"; empty lines are ignored.
+ * Returns NULL if the file cannot be read or the filter cannot be allocated.
+ */
+sstr_bloom *sstr_bloom_from_file(
+    const char *file_path,
+    size_t     bits_per_key
+)
+{
+    sstr_bloom *dst_bloom = NULL;
+
+    sstr_mapping *src_mapping = sstr_map_file(file_path);
+    if (src_mapping != NULL)
+    {
+        const sstring *src_str = sstr_mapping_str(src_mapping);
+        // the first pass only counts the lines
+        dst_bloom = sstr_bloom_alloc(sstr_bloom_add_lines(src_str, NULL), bits_per_key);
+        if (dst_bloom != NULL)
+        {
+            sstr_bloom_add_lines(src_str, dst_bloom);
+        }
+        sstr_unmap_file(src_mapping);
+    }
+
+    return dst_bloom;
+}
+#endif /* not _SSTR_NO_DYNMEM */
+
+
+#ifndef _SSTR_NO_DYNMEM
+/**
+ * Map a Bloom filter that was saved by sstr_bloom_save() into memory
+ *
+ * The filter is read-only. Returns NULL if the file cannot be mapped or
+ * is not a Bloom filter saved on a machine with the same byte order.
+ */
+sstr_bloom *sstr_bloom_map(
+    const char *file_path
+)
+{
+    sstr_bloom *dst_bloom = NULL;
+
+    if (file_path != NULL)
+    {
+        int         src_fd = open(file_path, O_RDONLY);
+        struct stat src_stat;
+        if (src_fd >= 0)
+        {
+            size_t header_size = SSTR_BLOOM_HEADER_WORDS * sizeof (uint64_t);
+            if (fstat(src_fd, &src_stat) == 0 && S_ISREG(src_stat.st_mode) &&
+                (uintmax_t) src_stat.st_size > (uintmax_t) header_size &&
+                (uintmax_t) src_stat.st_size <= (uintmax_t) SSTR_SIZE_T_MAX &&
+                (size_t) src_stat.st_size % SSTR_BLOOM_BLOCK_SIZE == 0)
+            {
+                dst_bloom = malloc(sizeof (sstr_bloom));
+            }
+            if (dst_bloom != NULL)
+            {
+                size_t   map_len   = (size_t) src_stat.st_size;
+                uint64_t *map_addr = mmap(NULL, map_len, PROT_READ, MAP_SHARED, src_fd, 0);
+                if (map_addr != MAP_FAILED &&
+                    map_addr[0] == SSTR_BLOOM_MAGIC &&
+                    map_addr[1] == (map_len - header_size) / SSTR_BLOOM_BLOCK_SIZE &&
+                    map_addr[1] <= SSTR_BLOOM_BLOCKS_MAX)
+                {
+                    // tests read random blocks
+                    posix_madvise(map_addr, map_len, POSIX_MADV_RANDOM);
+
+                    dst_bloom->words       = &(map_addr[SSTR_BLOOM_HEADER_WORDS]);
+                    dst_bloom->block_count = (size_t) map_addr[1];
+                    dst_bloom->map_addr    = map_addr;
+                    dst_bloom->map_len     = map_len;
+                }
+                else
+                {
+                    if (map_addr != MAP_FAILED)
+                    {
+                        munmap(map_addr, map_len);
+                    }
+                    free(dst_bloom);
+                    dst_bloom = NULL;
+                }
+            }
+            // the mapping remains valid after the file is closed
+            close(src_fd);
+        }
+    }
+
+    return dst_bloom;
+}
+#endif /* not _SSTR_NO_DYNMEM */
+
+
+/**
+ * Add a string to a Bloom filter
+ *
+ * Fails if the filter is mapped from a file
+ */
+sstr_rc sstr_bloom_add(
+    const sstring *src_str,
+    sstr_bloom    *dst_bloom
+)
+{
+    sstr_rc sstr_status = SSTR_FAIL;
+
+    if (src_str != NULL && dst_bloom != NULL && dst_bloom->map_addr == NULL)
+    {
+        uint64_t masks[SSTR_BLOOM_BLOCK_WORDS];
+        uint64_t *block = sstr_bloom_block(dst_bloom, src_str, masks);
+        for (size_t word_idx = 0; word_idx < SSTR_BLOOM_BLOCK_WORDS; ++word_idx)
+        {
+            block[word_idx] |= masks[word_idx];
+        }
+        sstr_status = SSTR_PASS;
+    }
+
+    return sstr_status;
+}
+
+
+/**
+ * Test whether a Bloom filter might contain a string
+ *
+ * Returns SSTR_FALSE if the string has definitely not been added
+ * to the filter, otherwise SSTR_TRUE
+ */
+sstr_rc sstr_bloom_might_contain(
+    const sstr_bloom *src_bloom,
+    const sstring    *src_str
+)
+{
+    sstr_rc sstr_status = SSTR_FAIL;
+
+    if (src_bloom != NULL && src_str != NULL)
+    {
+        uint64_t masks[SSTR_BLOOM_BLOCK_WORDS];
+        const uint64_t *block = sstr_bloom_block(src_bloom, src_str, masks);
+        // all words are tested without branches, the block is a single
+        // cache line anyway
+        uint64_t missing = 0;
+        for (size_t word_idx = 0; word_idx < SSTR_BLOOM_BLOCK_WORDS; ++word_idx)
+        {
+            missing |= masks[word_idx] & ~block[word_idx];
+        }
+        sstr_status = missing == 0 ? SSTR_TRUE : SSTR_FALSE;
+    }
+
+    return sstr_status;
+}
+
+
+/**
+ * Save a Bloom filter to a file
+ *
+ * The file is created with permissions 0600, or truncated if it exists
+ */
+sstr_rc sstr_bloom_save(
+    const sstr_bloom *src_bloom,
+    const char       *file_path
+)
+{
+    sstr_rc sstr_status = SSTR_FAIL;
+
+    if (src_bloom != NULL && file_path != NULL)
+    {
+        int dst_fd = open(file_path, O_WRONLY | O_CREAT | O_TRUNC, 0600);
+        if (dst_fd >= 0)
+        {
+            uint64_t header[SSTR_BLOOM_HEADER_WORDS] = { 0 };
+            header[0] = SSTR_BLOOM_MAGIC;
+            header[1] = (uint64_t) src_bloom->block_count;
+
+            sstring header_view;
+            header_view.chars = (char *) header;
+            header_view.cap   = sizeof (header);
+            header_view.len   = sizeof (header);
+
+            sstring words_view;
+            words_view.chars  = (char *) src_bloom->words;
+            words_view.cap    = src_bloom->block_count * SSTR_BLOOM_BLOCK_SIZE;
+            words_view.len    = words_view.cap;
+
+            if (sstr_write_fd(&header_view, dst_fd) == SSTR_PASS &&
+                sstr_write_fd(&words_view, dst_fd) == SSTR_PASS)
+            {
+                sstr_status = SSTR_PASS;
+            }
+            if (close(dst_fd) != 0)
+            {
+                sstr_status = SSTR_FAIL;
+            }
+        }
+    }
+
+    return sstr_status;
+}
+
+
+/**
+ * Select the block of a string and the bit of the string in each word
+ * of the block
+ *
+ * The upper 32 bits of the hash value select the block, the lower 32 bits
+ * are multiplied with a different odd number for each word, and the top
+ * 6 bits of each product select the bit.
+ */
+static uint64_t *sstr_bloom_block(
+    const sstr_bloom *src_bloom,
+    const sstring    *src_str,
+    uint64_t         *dst_masks
+)
+{
+    sstr_hashval hash = 0;
+    sstr_hash_fast(src_str, &hash);
+
+    // maps the upper 32 bits to 0 ... block_count - 1 without a division
+    size_t   block_idx = (size_t) (((hash >> 32) * (uint64_t) src_bloom->block_count) >> 32);
+    uint32_t bit_key   = (uint32_t) hash;
+    for (size_t word_idx = 0; word_idx < SSTR_BLOOM_BLOCK_WORDS; ++word_idx)
+    {
+        uint32_t bit_idx = (uint32_t) (bit_key * sstr_bloom_salts[word_idx]) >> 26;
+        dst_masks[word_idx] = (uint64_t) 1 << bit_idx;
+    }
+
+    return &(src_bloom->words[block_idx * SSTR_BLOOM_BLOCK_WORDS]);
+}
+
+
+#ifndef _SSTR_NO_DYNMEM
+/**
+ * Add the lines of a string to a Bloom filter
+ *
+ * Lines end with '\n' or "\r\n"; empty lines are skipped.
+ * If dst_bloom is NULL, the lines are only counted.
+ * Returns the number of lines
+ */
+static size_t sstr_bloom_add_lines(
+    const sstring *src_str,
+    sstr_bloom    *dst_bloom
+)
+{
+    size_t line_count = 0;
+    size_t line_begin = 0;
+    while (line_begin < src_str->len)
+    {
+        const char *line_end = memchr(&(src_str->chars[line_begin]), '\n',
+                                      src_str->len - line_begin);
+        size_t next_begin = line_end != NULL ?
+                            (size_t) (line_end - src_str->chars) + 1 : src_str->len;
+        size_t line_len   = (line_end != NULL ?
+                             next_begin - 1 : next_begin) - line_begin;
+        if (line_len > 0 && src_str->chars[line_begin + line_len - 1] == '\r')
+        {
+            --line_len;
+        }
+        if (line_len > 0)
+        {
+            if (dst_bloom != NULL)
+            {
+                sstring line_view;
+                line_view.chars = &(src_str->chars[line_begin]);
+                line_view.cap   = line_len;
+                line_view.len   = line_len;
+                sstr_bloom_add(&line_view, dst_bloom);
+            }
+            ++line_count;
+        }
+        line_begin = next_begin;
+    }
+
+    return line_count;
+}
+#endif /* not _SSTR_NO_DYNMEM */
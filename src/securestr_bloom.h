@@ -0,0 +1,164 @@
+/**
+ * secureStrings library
+ * version 0.54-beta (2014-10-25_001)
+ *
+ * secureStrings Bloom filter
+ *
+ * Copyright (C) 2010, 2014 Robert ALTNOEDER
+ *
+ * Redistribution and use in source and binary forms,
+ * with or without modification, are permitted provided that
+ * the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in
+ *     the documentation and/or other materials provided with the distribution.
+ *  3. The name of the author may not be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _SECURESTR_BLOOM_H
+#define _SECURESTR_BLOOM_H
+
+#include <unistd.h>
+#include <sys/types.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <securestr.h>
+#include <securestr_array.h>
+
+// A Bloom filter tells whether a string is definitely not contained in
+// a set of strings, e.g. a list of breached passwords, without storing
+// the strings themselves
+//
+// The filter is split into blocks of 64 bytes, one cache line each.
+// A string selects one block and sets or tests one bit in each of the
+// eight 64 bit words of that block, so a test reads a single cache line.
+// Strings are hashed with sstr_hash_fast(), because hash values must be
+// stable across processes for filters that are saved to a file. Saved
+// filters use the byte order of the machine that saved them and can be
+// mapped into memory by sstr_bloom_map() without being read or copied.
+typedef struct sstr_bloom_struct sstr_bloom;
+
+
+#ifndef _SSTR_NO_DYNMEM
+/**
+ * Allocate an empty Bloom filter
+ *
+ * The filter is sized for key_count strings at bits_per_key bits each;
+ * 10 bits per key yield a false positive rate of about 1 %, 16 bits per
+ * key about 0.1 %. Returns NULL if the filter cannot be allocated.
+ */
+sstr_bloom *sstr_bloom_alloc(
+    size_t key_count,
+    size_t bits_per_key
+);
+#endif /* not _SSTR_NO_DYNMEM */
+
+
+#ifndef _SSTR_NO_DYNMEM
+/**
+ * Deallocate or unmap a Bloom filter
+ */
+void sstr_bloom_dealloc(
+    sstr_bloom *dst_bloom
+);
+#endif /* not _SSTR_NO_DYNMEM */
+
+
+#ifndef _SSTR_NO_DYNMEM
+/**
+ * Build a Bloom filter from all strings in an array
+ */
+sstr_bloom *sstr_bloom_from_array(
+    const sstr_array *src_arr,
+    size_t           bits_per_key
+);
+#endif /* not _SSTR_NO_DYNMEM */
+
+
+#ifndef _SSTR_NO_DYNMEM
+/**
+ * Build a Bloom filter from the lines of a text file
+ *
+ * Lines end with '\n' or "\r\n"; empty lines are ignored.
+ * Returns NULL if the file cannot be read or the filter cannot be allocated.
+ */
+sstr_bloom *sstr_bloom_from_file(
+    const char *file_path,
+    size_t     bits_per_key
+);
+#endif /* not _SSTR_NO_DYNMEM */
+
+
+#ifndef _SSTR_NO_DYNMEM
+/**
+ * Map a Bloom filter that was saved by sstr_bloom_save() into memory
+ *
+ * The filter is read-only. Returns NULL if the file cannot be mapped or
+ * is not a Bloom filter saved on a machine with the same byte order.
+ */
+sstr_bloom *sstr_bloom_map(
+    const char *file_path
+);
+#endif /* not _SSTR_NO_DYNMEM */
+
+
+/**
+ * Add a string to a Bloom filter
+ *
+ * Fails if the filter is mapped from a file
+ */
+sstr_rc sstr_bloom_add(
+    const sstring *src_str,
+    sstr_bloom    *dst_bloom
+);
+
+
+/**
+ * Test whether a Bloom filter might contain a string
+ *
+ * Returns SSTR_FALSE if the string has definitely not been added
+ * to the filter, otherwise SSTR_TRUE
+ */
+sstr_rc sstr_bloom_might_contain(
+    const sstr_bloom *src_bloom,
+    const sstring    *src_str
+);
+
+
+/**
+ * Save a Bloom filter to a file
+ *
+ * The file is created with permissions 0600, or truncated if it exists
+ */
+sstr_rc sstr_bloom_save(
+    const sstr_bloom *src_bloom,
+    const char       *file_path
+);
+
+
+#define sstrBloom           sstr_bloom
+#define sstrBloomAlloc      sstr_bloom_alloc
+#define sstrBloomDealloc    sstr_bloom_dealloc
+#define sstrBloomFromArray  sstr_bloom_from_array
+#define sstrBloomFromFile   sstr_bloom_from_file
+#define sstrBloomMap        sstr_bloom_map
+#define sstrBloomAdd        sstr_bloom_add
+#define sstrBloomMightContain sstr_bloom_might_contain
+#define sstrBloomSave       sstr_bloom_save
+
+#endif /* _SECURESTR_BLOOM_H */
@@ -0,0 +1,466 @@
+/**
+ * secureStrings library
+ * version 0.54-beta (2014-10-25_001)
+ *
+ * secureStrings case conversion functions
+ *
+ * Copyright (C) 2010, 2014 Robert ALTNOEDER
+ *
+ * Redistribution and use in source and binary forms,
+ * with or without modification, are permitted provided that
+ * the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in
+ *     the documentation and/or other materials provided with the distribution.
+ *  3. The name of the author may not be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <unistd.h>
+#include <sys/types.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <securestr.h>
+#include <securestr_case.h>
+
+#ifdef __SSE2__
+    #include <emmintrin.h>
+#endif
+#ifdef __AVX2__
+    #include <immintrin.h>
+#endif
+
+// first letter of the range that is converted
+#define SSTR_CASE_UPPER ((unsigned char) 'A')
+#define SSTR_CASE_LOWER ((unsigned char) 'a')
+
+// bit that distinguishes lowercase from uppercase ASCII letters
+#define SSTR_CASE_BIT   0x20
+
+static void sstr_case_convert(
+    sstring       *dst_str,
+    unsigned char first
+);
+static int sstr_case_equal(
+    const char *src_chars,
+    const char *pat_chars,
+    size_t     cmp_len
+);
+static unsigned char sstr_case_flip(
+    unsigned char src_char,
+    unsigned char first
+);
+static uint64_t sstr_case_flip_swar(
+    uint64_t      word,
+    unsigned char first
+);
+#ifdef __SSE2__
+static unsigned int sstr_case_lowbit(
+    unsigned int mask
+);
+#endif /* __SSE2__ */
+
+
+/*
+ * SIMD range-compare-and-flip kernels
+ *
+ * Adding (0x80 - first) moves the 26 letters of the range to the lowest
+ * signed byte values -128 to -103, so a single signed comparison selects
+ * them; their case bit is then flipped.
+ */
+#ifdef __SSE2__
+static __m128i sstr_case_flip_sse2(
+    __m128i       bytes,
+    unsigned char first
+)
+{
+    __m128i shifted  = _mm_add_epi8(bytes, _mm_set1_epi8((char) (0x80 - first)));
+    __m128i in_range = _mm_cmplt_epi8(shifted, _mm_set1_epi8(-128 + 26));
+    return _mm_xor_si128(bytes, _mm_and_si128(in_range, _mm_set1_epi8(SSTR_CASE_BIT)));
+}
+#endif /* __SSE2__ */
+
+
+#ifdef __AVX2__
+static __m256i sstr_case_flip_avx2(
+    __m256i       bytes,
+    unsigned char first
+)
+{
+    __m256i shifted  = _mm256_add_epi8(bytes, _mm256_set1_epi8((char) (0x80 - first)));
+    __m256i in_range = _mm256_cmpgt_epi8(_mm256_set1_epi8(-128 + 26), shifted);
+    return _mm256_xor_si256(bytes, _mm256_and_si256(in_range, _mm256_set1_epi8(SSTR_CASE_BIT)));
+}
+#endif /* __AVX2__ */
+
+
+/**
+ * Convert a string to lowercase in place
+ */
+sstr_rc sstr_tolower(
+    sstring *dst_str
+)
+{
+    sstr_rc sstr_status = SSTR_FAIL;
+
+    if (dst_str != NULL)
+    {
+        sstr_case_convert(dst_str, SSTR_CASE_UPPER);
+
+        sstr_status = SSTR_PASS;
+    }
+
+    return sstr_status;
+}
+
+
+/**
+ * Convert a string to uppercase in place
+ */
+sstr_rc sstr_toupper(
+    sstring *dst_str
+)
+{
+    sstr_rc sstr_status = SSTR_FAIL;
+
+    if (dst_str != NULL)
+    {
+        sstr_case_convert(dst_str, SSTR_CASE_LOWER);
+
+        sstr_status = SSTR_PASS;
+    }
+
+    return sstr_status;
+}
+
+
+/**
+ * Compare two strings, ignoring case
+ */
+sstr_rc sstr_casecmp(
+    const sstring *src_str,
+    const sstring *pat_str
+)
+{
+    sstr_rc sstr_status = SSTR_FAIL;
+
+    if (src_str != NULL && pat_str != NULL)
+    {
+        if (src_str->len == pat_str->len &&
+            sstr_case_equal(src_str->chars, pat_str->chars, src_str->len))
+        {
+            sstr_status = SSTR_TRUE;
+        }
+        else
+        {
+            sstr_status = SSTR_FALSE;
+        }
+    }
+
+    return sstr_status;
+}
+
+
+/**
+ * Compare the head part of two strings, ignoring case
+ */
+sstr_rc sstr_casestartswith(
+    const sstring *src_str,
+    const sstring *pat_str
+)
+{
+    sstr_rc sstr_status = SSTR_FAIL;
+
+    if (src_str != NULL && pat_str != NULL)
+    {
+        if (src_str->len >= pat_str->len &&
+            sstr_case_equal(src_str->chars, pat_str->chars, pat_str->len))
+        {
+            sstr_status = SSTR_TRUE;
+        }
+        else
+        {
+            sstr_status = SSTR_FALSE;
+        }
+    }
+
+    return sstr_status;
+}
+
+
+/**
+ * Find a substring in another string, ignoring case
+ *
+ * The SIMD search compares the first and the last character of the
+ * pattern at 16 (SSE2) or 32 (AVX2) positions at once and compares
+ * the complete pattern only at the positions where both match.
+ */
+sstr_pos sstr_caseindexof(
+    const sstring *src_str,
+    const sstring *pat_str
+)
+{
+    sstr_pos sstr_index = SSTR_NPOS;
+
+    if (src_str != NULL && pat_str != NULL)
+    {
+        if (src_str->len >= pat_str->len)
+        {
+            // the empty string always matches at position zero of the
+            // source string
+            if (pat_str->len > 0)
+            {
+                const char    *src_chars  = src_str->chars;
+                size_t        pat_len     = pat_str->len;
+                sstr_pos      search_len  = src_str->len - pat_len;
+                sstr_pos      src_idx     = 0;
+                unsigned char first_char  = sstr_case_flip(
+                    (unsigned char) pat_str->chars[0], SSTR_CASE_UPPER);
+                unsigned char last_char   = sstr_case_flip(
+                    (unsigned char) pat_str->chars[pat_len - 1], SSTR_CASE_UPPER);
+
+                #ifdef __AVX2__
+                __m256i first_avx2 = _mm256_set1_epi8((char) first_char);
+                __m256i last_avx2  = _mm256_set1_epi8((char) last_char);
+                for (; search_len - src_idx >= 32 && sstr_index == SSTR_NPOS; src_idx += 32)
+                {
+                    __m256i head = sstr_case_flip_avx2(
+                        _mm256_loadu_si256((const __m256i *) &(src_chars[src_idx])),
+                        SSTR_CASE_UPPER);
+                    __m256i tail = sstr_case_flip_avx2(
+                        _mm256_loadu_si256((const __m256i *) &(src_chars[src_idx + pat_len - 1])),
+                        SSTR_CASE_UPPER);
+                    unsigned int candidates = (unsigned int) _mm256_movemask_epi8(
+                        _mm256_and_si256(_mm256_cmpeq_epi8(head, first_avx2),
+                                         _mm256_cmpeq_epi8(tail, last_avx2)));
+                    while (candidates != 0 && sstr_index == SSTR_NPOS)
+                    {
+                        sstr_pos cand_idx = src_idx + sstr_case_lowbit(candidates);
+                        if (sstr_case_equal(&(src_chars[cand_idx]), pat_str->chars, pat_len))
+                        {
+                            sstr_index = cand_idx;
+                        }
+                        candidates &= candidates - 1;
+                    }
+                }
+                #endif /* __AVX2__ */
+
+                #ifdef __SSE2__
+                __m128i first_sse2 = _mm_set1_epi8((char) first_char);
+                __m128i last_sse2  = _mm_set1_epi8((char) last_char);
+                for (; search_len - src_idx >= 16 && sstr_index == SSTR_NPOS; src_idx += 16)
+                {
+                    __m128i head = sstr_case_flip_sse2(
+                        _mm_loadu_si128((const __m128i *) &(src_chars[src_idx])),
+                        SSTR_CASE_UPPER);
+                    __m128i tail = sstr_case_flip_sse2(
+                        _mm_loadu_si128((const __m128i *) &(src_chars[src_idx + pat_len - 1])),
+                        SSTR_CASE_UPPER);
+                    unsigned int candidates = (unsigned int) _mm_movemask_epi8(
+                        _mm_and_si128(_mm_cmpeq_epi8(head, first_sse2),
+                                      _mm_cmpeq_epi8(tail, last_sse2)));
+                    while (candidates != 0 && sstr_index == SSTR_NPOS)
+                    {
+                        sstr_pos cand_idx = src_idx + sstr_case_lowbit(candidates);
+                        if (sstr_case_equal(&(src_chars[cand_idx]), pat_str->chars, pat_len))
+                        {
+                            sstr_index = cand_idx;
+                        }
+                        candidates &= candidates - 1;
+                    }
+                }
+                #endif /* __SSE2__ */
+
+                for (; src_idx <= search_len && sstr_index == SSTR_NPOS; ++src_idx)
+                {
+                    if (sstr_case_flip((unsigned char) src_chars[src_idx], SSTR_CASE_UPPER) ==
+                        first_char &&
+                        sstr_case_flip((unsigned char) src_chars[src_idx + pat_len - 1],
+                                       SSTR_CASE_UPPER) == last_char &&
+                        sstr_case_equal(&(src_chars[src_idx]), pat_str->chars, pat_len))
+                    {
+                        sstr_index = src_idx;
+                    }
+                }
+            }
+            else
+            {
+                sstr_index = 0;
+            }
+        }
+    }
+
+    return sstr_index;
+}
+
+
+/**
+ * Flip the case of the letters from first to first + 25 in place
+ */
+static void sstr_case_convert(
+    sstring       *dst_str,
+    unsigned char first
+)
+{
+    char   *dst_chars = dst_str->chars;
+    size_t dst_len    = dst_str->len;
+    size_t dst_idx    = 0;
+
+    #ifdef __AVX2__
+    for (; dst_len - dst_idx >= 32; dst_idx += 32)
+    {
+        __m256i *dst_vec = (__m256i *) &(dst_chars[dst_idx]);
+        _mm256_storeu_si256(dst_vec, sstr_case_flip_avx2(_mm256_loadu_si256(dst_vec), first));
+    }
+    #endif /* __AVX2__ */
+
+    #ifdef __SSE2__
+    for (; dst_len - dst_idx >= 16; dst_idx += 16)
+    {
+        __m128i *dst_vec = (__m128i *) &(dst_chars[dst_idx]);
+        _mm_storeu_si128(dst_vec, sstr_case_flip_sse2(_mm_loadu_si128(dst_vec), first));
+    }
+    #endif /* __SSE2__ */
+
+    for (; dst_len - dst_idx >= 8; dst_idx += 8)
+    {
+        uint64_t word;
+        memcpy(&word, &(dst_chars[dst_idx]), sizeof (word));
+        word = sstr_case_flip_swar(word, first);
+        memcpy(&(dst_chars[dst_idx]), &word, sizeof (word));
+    }
+
+    for (; dst_idx < dst_len; ++dst_idx)
+    {
+        dst_chars[dst_idx] = (char) sstr_case_flip((unsigned char) dst_chars[dst_idx], first);
+    }
+}
+
+
+/**
+ * Compare two char arrays of the same length, ignoring case
+ */
+static int sstr_case_equal(
+    const char *src_chars,
+    const char *pat_chars,
+    size_t     cmp_len
+)
+{
+    int    equal   = 1;
+    size_t cmp_idx = 0;
+
+    #ifdef __AVX2__
+    for (; cmp_len - cmp_idx >= 32 && equal; cmp_idx += 32)
+    {
+        __m256i src_lower = sstr_case_flip_avx2(
+            _mm256_loadu_si256((const __m256i *) &(src_chars[cmp_idx])), SSTR_CASE_UPPER);
+        __m256i pat_lower = sstr_case_flip_avx2(
+            _mm256_loadu_si256((const __m256i *) &(pat_chars[cmp_idx])), SSTR_CASE_UPPER);
+        equal = _mm256_movemask_epi8(_mm256_cmpeq_epi8(src_lower, pat_lower)) == -1;
+    }
+    #endif /* __AVX2__ */
+
+    #ifdef __SSE2__
+    for (; cmp_len - cmp_idx >= 16 && equal; cmp_idx += 16)
+    {
+        __m128i src_lower = sstr_case_flip_sse2(
+            _mm_loadu_si128((const __m128i *) &(src_chars[cmp_idx])), SSTR_CASE_UPPER);
+        __m128i pat_lower = sstr_case_flip_sse2(
+            _mm_loadu_si128((const __m128i *) &(pat_chars[cmp_idx])), SSTR_CASE_UPPER);
+        equal = _mm_movemask_epi8(_mm_cmpeq_epi8(src_lower, pat_lower)) == 0xFFFF;
+    }
+    #endif /* __SSE2__ */
+
+    for (; cmp_len - cmp_idx >= 8 && equal; cmp_idx += 8)
+    {
+        uint64_t src_word;
+        uint64_t pat_word;
+        memcpy(&src_word, &(src_chars[cmp_idx]), sizeof (src_word));
+        memcpy(&pat_word, &(pat_chars[cmp_idx]), sizeof (pat_word));
+        equal = sstr_case_flip_swar(src_word, SSTR_CASE_UPPER) ==
+                sstr_case_flip_swar(pat_word, SSTR_CASE_UPPER);
+    }
+
+    for (; cmp_idx < cmp_len && equal; ++cmp_idx)
+    {
+        equal = sstr_case_flip((unsigned char) src_chars[cmp_idx], SSTR_CASE_UPPER) ==
+                sstr_case_flip((unsigned char) pat_chars[cmp_idx], SSTR_CASE_UPPER);
+    }
+
+    return equal;
+}
+
+
+/**
+ * Flip the case of a letter from first to first + 25
+ */
+static unsigned char sstr_case_flip(
+    unsigned char src_char,
+    unsigned char first
+)
+{
+    unsigned int in_range = (unsigned int) (src_char - first) < 26U;
+    return (unsigned char) (src_char ^ (in_range << 5));
+}
+
+
+/**
+ * Flip the case of the letters from first to first + 25 in 8 bytes
+ *
+ * The high bit of each byte is cleared before the additions, so no
+ * carry crosses into the next byte; bytes with the high bit set are
+ * never letters.
+ */
+static uint64_t sstr_case_flip_swar(
+    uint64_t      word,
+    unsigned char first
+)
+{
+    const uint64_t ones      = 0x0101010101010101ULL;
+    const uint64_t high_bits = ones * 0x80;
+    uint64_t       heptets   = word & ~high_bits;
+    // high bit set if the byte is first or above
+    uint64_t       from_first = heptets + ones * (uint64_t) (0x80 - first);
+    // high bit set if the byte is above first + 25
+    uint64_t       past_last  = heptets + ones * (uint64_t) (0x80 - first - 26);
+    uint64_t       in_range   = (from_first ^ past_last) & ~word & high_bits;
+    return word ^ (in_range >> 2);
+}
+
+
+#ifdef __SSE2__
+/**
+ * Index of the lowest set bit in a non-zero mask
+ */
+static unsigned int sstr_case_lowbit(
+    unsigned int mask
+)
+{
+    #ifdef __GNUC__
+    return (unsigned int) __builtin_ctz(mask);
+    #else
+    unsigned int bit_idx = 0;
+    while ((mask & 1U) == 0)
+    {
+        mask >>= 1;
+        ++bit_idx;
+    }
+    return bit_idx;
+    #endif /* __GNUC__ */
+}
+#endif /* __SSE2__ */
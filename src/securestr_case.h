@@ -0,0 +1,95 @@
+/**
+ * secureStrings library
+ * version 0.54-beta (2014-10-25_001)
+ *
+ * secureStrings case conversion functions
+ *
+ * Copyright (C) 2010, 2014 Robert ALTNOEDER
+ *
+ * Redistribution and use in source and binary forms,
+ * with or without modification, are permitted provided that
+ * the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in
+ *     the documentation and/or other materials provided with the distribution.
+ *  3. The name of the author may not be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _SECURESTR_CASE_H
+#define _SECURESTR_CASE_H
+
+#include <unistd.h>
+#include <sys/types.h>
+#include <stdlib.h>
+#include <securestr.h>
+
+// Case conversion and case-insensitive comparison apply to the ASCII
+// letters A - Z and a - z only; all other bytes, including those of
+// multibyte UTF-8 sequences, are left unchanged and compared exactly.
+
+
+/**
+ * Convert a string to lowercase in place
+ */
+sstr_rc sstr_tolower(
+    sstring *dst_str
+);
+
+
+/**
+ * Convert a string to uppercase in place
+ */
+sstr_rc sstr_toupper(
+    sstring *dst_str
+);
+
+
+/**
+ * Compare two strings, ignoring case
+ */
+sstr_rc sstr_casecmp(
+    const sstring *src_str,
+    const sstring *pat_str
+);
+
+
+/**
+ * Compare the head part of two strings, ignoring case
+ */
+sstr_rc sstr_casestartswith(
+    const sstring *src_str,
+    const sstring *pat_str
+);
+
+
+/**
+ * Find a substring in another string, ignoring case
+ */
+sstr_pos sstr_caseindexof(
+    const sstring *src_str,
+    const sstring *pat_str
+);
+
+
+#define sstrToLower         sstr_tolower
+#define sstrToUpper         sstr_toupper
+#define sstrCaseCmp         sstr_casecmp
+#define sstrCaseStartsWith  sstr_casestartswith
+#define sstrCaseIndexOf     sstr_caseindexof
+
+#endif /* _SECURESTR_CASE_H */
@@ -0,0 +1,605 @@
+/**
+ * secureStrings library
+ * version 0.54-beta (2014-10-25_001)
+ *
+ * secureStrings character class functions
+ *
+ * Copyright (C) 2010, 2014 Robert ALTNOEDER
+ *
+ * Redistribution and use in source and binary forms,
+ * with or without modification, are permitted provided that
+ * the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in
+ *     the documentation and/or other materials provided with the distribution.
+ *  3. The name of the author may not be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <unistd.h>
+#include <sys/types.h>
+#include <stdlib.h>
+#include <string.h>
+#include <securestr.h>
+#include <securestr_class.h>
+
+#ifdef __SSSE3__
+    #include <tmmintrin.h>
+#endif
+#ifdef __AVX2__
+    #include <immintrin.h>
+#endif
+
+const sstr_class SSTR_CLASS_SPACE =
+{
+    {
+        // ' '
+        0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // '\t', '\n', '\v', '\f', '\r'
+        0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    }
+};
+
+const sstr_class SSTR_CLASS_CNTRL =
+{
+    {
+        // 0x00 - 0x1F
+        0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+        // 0x7F
+        0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x83,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    }
+};
+
+static size_t sstr_class_rspan(
+    const char       *src_chars,
+    size_t           src_len,
+    const sstr_class *src_class
+);
+static void sstr_class_trim(
+    sstring          *dst_str,
+    const sstr_class *src_class,
+    int              trim_left,
+    int              trim_right
+);
+static unsigned int sstr_class_test(
+    const sstr_class *src_class,
+    unsigned char    src_char
+);
+#ifdef __SSSE3__
+static unsigned int sstr_class_lowbit(
+    unsigned int mask
+);
+static unsigned int sstr_class_highbit(
+    unsigned int mask
+);
+#endif /* __SSSE3__ */
+
+
+/*
+ * SIMD nibble lookup
+ *
+ * The low nibble of each byte selects the set of high nibbles that are
+ * in the class from the first (bytes 00 - 7F) or the second (bytes
+ * 80 - FF) half of the class; pshufb yields zero for the half that does
+ * not apply, because its index has the high bit set. The high nibble
+ * selects the bit to test. Returns 0xFF for each byte in the class.
+ */
+#ifdef __SSSE3__
+static __m128i sstr_class_match_ssse3(
+    __m128i bytes,
+    __m128i low_sets,
+    __m128i high_sets
+)
+{
+    __m128i index_mask = _mm_set1_epi8((char) 0x8F);
+    __m128i low_bits   = _mm_shuffle_epi8(low_sets, _mm_and_si128(bytes, index_mask));
+    __m128i high_bits  = _mm_shuffle_epi8(
+        high_sets, _mm_and_si128(_mm_xor_si128(bytes, _mm_set1_epi8((char) 0x80)), index_mask));
+    __m128i test_bit   = _mm_shuffle_epi8(
+        _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128),
+        _mm_and_si128(_mm_srli_epi16(bytes, 4), _mm_set1_epi8(0x0F)));
+    return _mm_cmpeq_epi8(_mm_and_si128(_mm_or_si128(low_bits, high_bits), test_bit), test_bit);
+}
+#endif /* __SSSE3__ */
+
+
+#ifdef __AVX2__
+static __m256i sstr_class_match_avx2(
+    __m256i bytes,
+    __m256i low_sets,
+    __m256i high_sets
+)
+{
+    __m256i index_mask = _mm256_set1_epi8((char) 0x8F);
+    __m256i low_bits   = _mm256_shuffle_epi8(low_sets, _mm256_and_si256(bytes, index_mask));
+    __m256i high_bits  = _mm256_shuffle_epi8(
+        high_sets,
+        _mm256_and_si256(_mm256_xor_si256(bytes, _mm256_set1_epi8((char) 0x80)), index_mask));
+    __m256i test_bit   = _mm256_shuffle_epi8(
+        _mm256_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128,
+                         1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128),
+        _mm256_and_si256(_mm256_srli_epi16(bytes, 4), _mm256_set1_epi8(0x0F)));
+    return _mm256_cmpeq_epi8(
+        _mm256_and_si256(_mm256_or_si256(low_bits, high_bits), test_bit), test_bit);
+}
+#endif /* __AVX2__ */
+
+
+/**
+ * Clear a character class
+ */
+sstr_rc sstr_class_clear(
+    sstr_class *dst_class
+)
+{
+    sstr_rc sstr_status = SSTR_FAIL;
+
+    if (dst_class != NULL)
+    {
+        memset(dst_class->sets, 0, sizeof (dst_class->sets));
+
+        sstr_status = SSTR_PASS;
+    }
+
+    return sstr_status;
+}
+
+
+/**
+ * Add the characters from first_char to last_char to a character class
+ *
+ * Characters are compared as unsigned char values
+ */
+sstr_rc sstr_class_add(
+    char       first_char,
+    char       last_char,
+    sstr_class *dst_class
+)
+{
+    sstr_rc sstr_status = SSTR_FAIL;
+
+    if (dst_class != NULL)
+    {
+        unsigned int first_value = (unsigned char) first_char;
+        unsigned int last_value  = (unsigned char) last_char;
+        if (first_value <= last_value)
+        {
+            for (unsigned int value = first_value; value <= last_value; ++value)
+            {
+                dst_class->sets[((value >> 3) & 0x10) | (value & 0x0F)] |=
+                    (unsigned char) (1U << ((value >> 4) & 0x07));
+            }
+
+            sstr_status = SSTR_PASS;
+        }
+    }
+
+    return sstr_status;
+}
+
+
+/**
+ * Add the characters of a string to a character class
+ */
+sstr_rc sstr_class_addstr(
+    const sstring *src_str,
+    sstr_class    *dst_class
+)
+{
+    sstr_rc sstr_status = SSTR_FAIL;
+
+    if (src_str != NULL && dst_class != NULL)
+    {
+        for (sstr_pos src_idx = 0; src_idx < src_str->len; ++src_idx)
+        {
+            sstr_class_add(src_str->chars[src_idx], src_str->chars[src_idx], dst_class);
+        }
+
+        sstr_status = SSTR_PASS;
+    }
+
+    return sstr_status;
+}
+
+
+/**
+ * Check whether a character is in a character class
+ */
+sstr_rc sstr_class_contains(
+    const sstr_class *src_class,
+    char             src_char
+)
+{
+    sstr_rc sstr_status = SSTR_FAIL;
+
+    if (src_class != NULL)
+    {
+        if (sstr_class_test(src_class, (unsigned char) src_char))
+        {
+            sstr_status = SSTR_TRUE;
+        }
+        else
+        {
+            sstr_status = SSTR_FALSE;
+        }
+    }
+
+    return sstr_status;
+}
+
+
+/**
+ * Length of the run of characters in a character class
+ * that starts at start_pos
+ *
+ * Returns SSTR_SIZE_FAIL if an argument is NULL or start_pos is beyond
+ * the end of the string.
+ */
+size_t sstr_span_class(
+    const sstring    *src_str,
+    const sstr_class *src_class,
+    sstr_pos         start_pos
+)
+{
+    size_t span_len = SSTR_SIZE_FAIL;
+
+    if (src_str != NULL && src_class != NULL)
+    {
+        if (start_pos <= src_str->len)
+        {
+            const char *src_chars = src_str->chars;
+            size_t     src_len    = src_str->len;
+            size_t     src_idx    = start_pos;
+            int        in_class   = 1;
+
+            #ifdef __AVX2__
+            __m256i low_avx2  = _mm256_broadcastsi128_si256(
+                _mm_loadu_si128((const __m128i *) &(src_class->sets[0])));
+            __m256i high_avx2 = _mm256_broadcastsi128_si256(
+                _mm_loadu_si128((const __m128i *) &(src_class->sets[16])));
+            while (in_class && src_len - src_idx >= 32)
+            {
+                unsigned int other_mask = ~((unsigned int) _mm256_movemask_epi8(
+                    sstr_class_match_avx2(
+                        _mm256_loadu_si256((const __m256i *) &(src_chars[src_idx])),
+                        low_avx2, high_avx2)));
+                if (other_mask == 0)
+                {
+                    src_idx += 32;
+                }
+                else
+                {
+                    src_idx += sstr_class_lowbit(other_mask);
+                    in_class = 0;
+                }
+            }
+            #endif /* __AVX2__ */
+
+            #ifdef __SSSE3__
+            __m128i low_sse  = _mm_loadu_si128((const __m128i *) &(src_class->sets[0]));
+            __m128i high_sse = _mm_loadu_si128((const __m128i *) &(src_class->sets[16]));
+            while (in_class && src_len - src_idx >= 16)
+            {
+                unsigned int other_mask = 0xFFFFU & ~((unsigned int) _mm_movemask_epi8(
+                    sstr_class_match_ssse3(
+                        _mm_loadu_si128((const __m128i *) &(src_chars[src_idx])),
+                        low_sse, high_sse)));
+                if (other_mask == 0)
+                {
+                    src_idx += 16;
+                }
+                else
+                {
+                    src_idx += sstr_class_lowbit(other_mask);
+                    in_class = 0;
+                }
+            }
+            #endif /* __SSSE3__ */
+
+            while (in_class && src_idx < src_len &&
+                   sstr_class_test(src_class, (unsigned char) src_chars[src_idx]))
+            {
+                ++src_idx;
+            }
+
+            span_len = src_idx - start_pos;
+        }
+    }
+
+    return span_len;
+}
+
+
+/**
+ * Remove all characters in a character class from a string in place
+ *
+ * The characters that are kept are moved at most once; the vacated
+ * tail of the string is overwritten with null characters
+ */
+sstr_rc sstr_strip_class(
+    const sstr_class *src_class,
+    sstring          *dst_str
+)
+{
+    sstr_rc sstr_status = SSTR_FAIL;
+
+    if (src_class != NULL && dst_str != NULL)
+    {
+        char   *dst_chars = dst_str->chars;
+        size_t src_len    = dst_str->len;
+        size_t src_idx    = 0;
+        size_t dst_idx    = 0;
+
+        #ifdef __SSSE3__
+        __m128i low_sse  = _mm_loadu_si128((const __m128i *) &(src_class->sets[0]));
+        __m128i high_sse = _mm_loadu_si128((const __m128i *) &(src_class->sets[16]));
+        for (; src_len - src_idx >= 16; src_idx += 16)
+        {
+            __m128i      block      = _mm_loadu_si128((const __m128i *) &(dst_chars[src_idx]));
+            unsigned int class_mask = (unsigned int) _mm_movemask_epi8(
+                sstr_class_match_ssse3(block, low_sse, high_sse));
+            if (class_mask == 0)
+            {
+                // the store ends at or before the end of the block that
+                // was just loaded, so no unread characters are overwritten
+                _mm_storeu_si128((__m128i *) &(dst_chars[dst_idx]), block);
+                dst_idx += 16;
+            }
+            else
+            {
+                for (size_t block_idx = 0; block_idx < 16; ++block_idx)
+                {
+                    if ((class_mask & (1U << block_idx)) == 0)
+                    {
+                        dst_chars[dst_idx] = dst_chars[src_idx + block_idx];
+                        ++dst_idx;
+                    }
+                }
+            }
+        }
+        #endif /* __SSSE3__ */
+
+        for (; src_idx < src_len; ++src_idx)
+        {
+            if (!sstr_class_test(src_class, (unsigned char) dst_chars[src_idx]))
+            {
+                dst_chars[dst_idx] = dst_chars[src_idx];
+                ++dst_idx;
+            }
+        }
+
+        // overwrite the vacated tail
+        memset(&(dst_chars[dst_idx]), '\0', src_len - dst_idx);
+        // update destination secureString length
+        dst_str->len = dst_idx;
+        // terminate destination secureString with a null-character
+        dst_str->chars[dst_str->len] = '\0';
+
+        sstr_status = SSTR_PASS;
+    }
+
+    return sstr_status;
+}
+
+
+/**
+ * Remove leading and trailing whitespace from a string in place
+ *
+ * The remaining characters are moved at most once; the vacated tail
+ * of the string is overwritten with null characters
+ */
+sstr_rc sstr_trim(
+    sstring *dst_str
+)
+{
+    sstr_rc sstr_status = SSTR_FAIL;
+
+    if (dst_str != NULL)
+    {
+        sstr_class_trim(dst_str, &SSTR_CLASS_SPACE, 1, 1);
+
+        sstr_status = SSTR_PASS;
+    }
+
+    return sstr_status;
+}
+
+
+/**
+ * Remove leading whitespace from a string in place
+ */
+sstr_rc sstr_ltrim(
+    sstring *dst_str
+)
+{
+    sstr_rc sstr_status = SSTR_FAIL;
+
+    if (dst_str != NULL)
+    {
+        sstr_class_trim(dst_str, &SSTR_CLASS_SPACE, 1, 0);
+
+        sstr_status = SSTR_PASS;
+    }
+
+    return sstr_status;
+}
+
+
+/**
+ * Remove trailing whitespace from a string in place
+ */
+sstr_rc sstr_rtrim(
+    sstring *dst_str
+)
+{
+    sstr_rc sstr_status = SSTR_FAIL;
+
+    if (dst_str != NULL)
+    {
+        sstr_class_trim(dst_str, &SSTR_CLASS_SPACE, 0, 1);
+
+        sstr_status = SSTR_PASS;
+    }
+
+    return sstr_status;
+}
+
+
+/**
+ * Length of the run of characters in a character class
+ * at the end of a char array
+ */
+static size_t sstr_class_rspan(
+    const char       *src_chars,
+    size_t           src_len,
+    const sstr_class *src_class
+)
+{
+    // src_end is the index after the last character of the run
+    size_t src_end  = src_len;
+    int    in_class = 1;
+
+    #ifdef __SSSE3__
+    __m128i low_sse  = _mm_loadu_si128((const __m128i *) &(src_class->sets[0]));
+    __m128i high_sse = _mm_loadu_si128((const __m128i *) &(src_class->sets[16]));
+    while (in_class && src_end >= 16)
+    {
+        unsigned int other_mask = 0xFFFFU & ~((unsigned int) _mm_movemask_epi8(
+            sstr_class_match_ssse3(
+                _mm_loadu_si128((const __m128i *) &(src_chars[src_end - 16])),
+                low_sse, high_sse)));
+        if (other_mask == 0)
+        {
+            src_end -= 16;
+        }
+        else
+        {
+            src_end -= 15 - sstr_class_highbit(other_mask);
+            in_class = 0;
+        }
+    }
+    #endif /* __SSSE3__ */
+
+    while (in_class && src_end > 0 &&
+           sstr_class_test(src_class, (unsigned char) src_chars[src_end - 1]))
+    {
+        --src_end;
+    }
+
+    return src_len - src_end;
+}
+
+
+/**
+ * Remove the runs of characters in a character class
+ * at the start and/or the end of a string
+ */
+static void sstr_class_trim(
+    sstring          *dst_str,
+    const sstr_class *src_class,
+    int              trim_left,
+    int              trim_right
+)
+{
+    size_t src_len   = dst_str->len;
+    size_t lead_len  = 0;
+    size_t trail_len = 0;
+
+    if (trim_left)
+    {
+        lead_len = sstr_span_class(dst_str, src_class, 0);
+    }
+    if (trim_right && lead_len < src_len)
+    {
+        trail_len = sstr_class_rspan(&(dst_str->chars[lead_len]), src_len - lead_len,
+                                     src_class);
+    }
+
+    size_t final_len = src_len - lead_len - trail_len;
+    if (lead_len > 0)
+    {
+        memmove(dst_str->chars, &(dst_str->chars[lead_len]), final_len);
+    }
+
+    // overwrite the vacated tail
+    memset(&(dst_str->chars[final_len]), '\0', src_len - final_len);
+    // update destination secureString length
+    dst_str->len = final_len;
+    // terminate destination secureString with a null-character
+    dst_str->chars[dst_str->len] = '\0';
+}
+
+
+/**
+ * Check whether a character is in a character class
+ */
+static unsigned int sstr_class_test(
+    const sstr_class *src_class,
+    unsigned char    src_char
+)
+{
+    return (src_class->sets[((src_char >> 3) & 0x10) | (src_char & 0x0F)] >>
+            ((src_char >> 4) & 0x07)) & 1U;
+}
+
+
+#ifdef __SSSE3__
+/**
+ * Index of the lowest set bit in a non-zero mask
+ */
+static unsigned int sstr_class_lowbit(
+    unsigned int mask
+)
+{
+    #ifdef __GNUC__
+    return (unsigned int) __builtin_ctz(mask);
+    #else
+    unsigned int bit_idx = 0;
+    while ((mask & 1U) == 0)
+    {
+        mask >>= 1;
+        ++bit_idx;
+    }
+    return bit_idx;
+    #endif /* __GNUC__ */
+}
+
+
+/**
+ * Index of the highest set bit in a non-zero mask
+ */
+static unsigned int sstr_class_highbit(
+    unsigned int mask
+)
+{
+    #ifdef __GNUC__
+    return (unsigned int) (sizeof (unsigned int) * 8 - 1) - (unsigned int) __builtin_clz(mask);
+    #else
+    unsigned int bit_idx = 0;
+    while ((mask >> 1) != 0)
+    {
+        mask >>= 1;
+        ++bit_idx;
+    }
+    return bit_idx;
+    #endif /* __GNUC__ */
+}
+#endif /* __SSSE3__ */
@@ -0,0 +1,164 @@
+/**
+ * secureStrings library
+ * version 0.54-beta (2014-10-25_001)
+ *
+ * secureStrings character class functions
+ *
+ * Copyright (C) 2010, 2014 Robert ALTNOEDER
+ *
+ * Redistribution and use in source and binary forms,
+ * with or without modification, are permitted provided that
+ * the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in
+ *     the documentation and/or other materials provided with the distribution.
+ *  3. The name of the author may not be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _SECURESTR_CLASS_H
+#define _SECURESTR_CLASS_H
+
+#include <unistd.h>
+#include <sys/types.h>
+#include <stdlib.h>
+#include <securestr.h>
+
+// An sstr_class is a set of char values (a 256-bit set)
+//
+// The set is stored in the layout of the SIMD nibble lookup:
+// bit h of sets[l] is set if (h << 4 | l) is in the set,
+// bit h of sets[16 + l] is set if (0x80 | h << 4 | l) is in the set.
+// Use sstr_class_clear(), sstr_class_add() and sstr_class_addstr()
+// to build a set.
+typedef struct sstr_class_struct
+{
+    unsigned char sets[32];
+}
+sstr_class;
+
+// whitespace: space, \t, \n, \v, \f, \r
+extern const sstr_class SSTR_CLASS_SPACE;
+
+// control characters: 0x00 - 0x1F and 0x7F
+extern const sstr_class SSTR_CLASS_CNTRL;
+
+
+/**
+ * Clear a character class
+ */
+sstr_rc sstr_class_clear(
+    sstr_class *dst_class
+);
+
+
+/**
+ * Add the characters from first_char to last_char to a character class
+ *
+ * Characters are compared as unsigned char values
+ */
+sstr_rc sstr_class_add(
+    char       first_char,
+    char       last_char,
+    sstr_class *dst_class
+);
+
+
+/**
+ * Add the characters of a string to a character class
+ */
+sstr_rc sstr_class_addstr(
+    const sstring *src_str,
+    sstr_class    *dst_class
+);
+
+
+/**
+ * Check whether a character is in a character class
+ */
+sstr_rc sstr_class_contains(
+    const sstr_class *src_class,
+    char             src_char
+);
+
+
+/**
+ * Length of the run of characters in a character class
+ * that starts at start_pos
+ *
+ * Returns SSTR_SIZE_FAIL if an argument is NULL or start_pos is beyond
+ * the end of the string.
+ */
+size_t sstr_span_class(
+    const sstring    *src_str,
+    const sstr_class *src_class,
+    sstr_pos         start_pos
+);
+
+
+/**
+ * Remove all characters in a character class from a string in place
+ *
+ * The characters that are kept are moved at most once; the vacated
+ * tail of the string is overwritten with null characters
+ */
+sstr_rc sstr_strip_class(
+    const sstr_class *src_class,
+    sstring          *dst_str
+);
+
+
+/**
+ * Remove leading and trailing whitespace from a string in place
+ *
+ * The remaining characters are moved at most once; the vacated tail
+ * of the string is overwritten with null characters
+ */
+sstr_rc sstr_trim(
+    sstring *dst_str
+);
+
+
+/**
+ * Remove leading whitespace from a string in place
+ */
+sstr_rc sstr_ltrim(
+    sstring *dst_str
+);
+
+
+/**
+ * Remove trailing whitespace from a string in place
+ */
+sstr_rc sstr_rtrim(
+    sstring *dst_str
+);
+
+
+#define sstrClass           sstr_class
+
+#define sstrClassClear      sstr_class_clear
+#define sstrClassAdd        sstr_class_add
+#define sstrClassAddStr     sstr_class_addstr
+#define sstrClassContains   sstr_class_contains
+#define sstrSpanClass       sstr_span_class
+#define sstrStripClass      sstr_strip_class
+#define sstrTrim            sstr_trim
+#define sstrLTrim           sstr_ltrim
+#define sstrRTrim           sstr_rtrim
+
+#endif /* _SECURESTR_CLASS_H */
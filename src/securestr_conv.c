@@ -32,9 +32,202 @@
 
 #include <unistd.h>
 #include <sys/types.h>
+#include <stdint.h>
+#include <stdarg.h>
+#include <string.h>
+#include <float.h>
 #include <securestr.h>
 #include <securestr_conv.h>
 
+#ifdef __SSE2__
+    #include <emmintrin.h>
+#endif
+#ifdef __SSSE3__
+    #include <tmmintrin.h>
+#endif
+#ifdef __AVX2__
+    #include <immintrin.h>
+#endif
+
+// return value for numbers that are out of range
+const sstr_rc SSTR_RANGE = (sstr_rc) 2;
+
+// conversion specification of a format directive
+typedef struct sstr_format_spec_struct
+{
+    // left-justify within the field width ('-' flag)
+    int    left;
+    // pad integers with zeros instead of spaces ('0' flag)
+    int    zero_pad;
+    // minimum number of chars written
+    size_t width;
+    // maximum number of chars of a string, SSTR_SIZE_FAIL if unlimited
+    size_t precision;
+} sstr_format_spec;
+
+static size_t sstr_u64_digits(uint64_t value);
+static void sstr_write_u64(char *dst_end, uint64_t value);
+static size_t sstr_u64_hex_digits(uint64_t value);
+static void sstr_write_hex(
+    char       *dst_end,
+    uint64_t   value,
+    const char *hex_digits
+);
+static void sstr_format_decimal(
+    char     *dst_chars,
+    int      negative,
+    uint64_t digits,
+    int32_t  digits_len,
+    int32_t  point
+);
+static void sstr_ryu_d2d(
+    uint64_t ieee_mantissa,
+    uint32_t ieee_exponent,
+    uint64_t *dst_digits,
+    int32_t  *dst_exp10
+);
+static size_t sstr_format_width(
+    const char **fmt_chars
+);
+static int64_t sstr_format_signed_arg(
+    char    len_mod,
+    va_list *args
+);
+static uint64_t sstr_format_unsigned_arg(
+    char    len_mod,
+    va_list *args
+);
+static int sstr_format_chars(
+    const char             *src_chars,
+    size_t                 src_len,
+    const sstr_format_spec *spec,
+    sstring                *dst_str
+);
+static int sstr_format_integer(
+    uint64_t               magnitude,
+    int                    negative,
+    const char             *hex_digits,
+    const sstr_format_spec *spec,
+    sstring                *dst_str
+);
+static int sstr_format_double(
+    double                 src_value,
+    const sstr_format_spec *spec,
+    sstring                *dst_str
+);
+static sstr_rc sstr_parse_u64(
+    const char *src_chars,
+    size_t     src_len,
+    size_t     src_idx,
+    uint64_t   *dst_value
+);
+static sstr_rc sstr_parse_double(
+    const char *src_chars,
+    size_t     src_len,
+    double     *dst_value
+);
+static void sstr_hex_encode_chars(
+    const char *src_chars,
+    size_t     src_len,
+    char       *dst_chars
+);
+static int sstr_hex_decode_chars(
+    const char *src_chars,
+    size_t     src_len,
+    char       *dst_chars
+);
+static sstr_rc sstr_b64_encode_impl(
+    const sstring *src_str,
+    sstring       *dst_str,
+    const char    *alphabet,
+    int           padded
+);
+static sstr_rc sstr_b64_decode_impl(
+    const sstring *src_str,
+    sstring       *dst_str,
+    const char    *alphabet,
+    int           padded
+);
+static int sstr_hex_value(
+    char hex_char
+);
+#ifdef __SSE2__
+static unsigned int sstr_conv_lowbit(
+    unsigned int mask
+);
+#endif /* __SSE2__ */
+static size_t sstr_json_next_special(
+    const char *src_chars,
+    size_t     src_len,
+    size_t     src_idx
+);
+static char sstr_json_short_escape(
+    char src_char
+);
+static size_t sstr_json_escape_extra(
+    const char *src_chars,
+    size_t     src_len
+);
+static void sstr_json_escape_chars(
+    const char *src_chars,
+    size_t     src_len,
+    char       *dst_chars
+);
+static char sstr_json_short_unescape(
+    char esc_char
+);
+static long sstr_json_hex4(
+    const char *src_chars
+);
+static size_t sstr_json_code_point(
+    const char *src_chars,
+    size_t     src_len,
+    size_t     src_idx,
+    uint32_t   *dst_cp
+);
+static size_t sstr_json_utf8_len(
+    uint32_t code_point
+);
+static size_t sstr_json_unescaped_len(
+    const char *src_chars,
+    size_t     src_len
+);
+static void sstr_json_unescape_chars(
+    const char *src_chars,
+    size_t     src_len,
+    char       *dst_chars
+);
+static int sstr_url_unreserved(
+    char src_char
+);
+static size_t sstr_url_next_reserved(
+    const char *src_chars,
+    size_t     src_len,
+    size_t     src_idx
+);
+
+// two-digit decimal strings "00" to "99"
+static const char sstr_digit_pairs[201] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+static const char sstr_hex_digits[17] = "0123456789abcdef";
+static const char sstr_hex_digits_upper[17] = "0123456789ABCDEF";
+
+// Base64 alphabets (RFC 4648)
+static const char sstr_b64_std_alphabet[65] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+static const char sstr_b64_url_alphabet[65] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+
 
 /**
  * Copy a C string to a secureString (overwrite)
@@ -115,9 +308,9 @@ sstr_rc sstr_appdcstr(
  * Compare a secureString with a C string
  */
 sstr_rc sstr_cmpcstr(
-    sstring    *src_str,
-    const char *pat_str,
-    size_t     cstr_len
+    const sstring *src_str,
+    const char    *pat_str,
+    size_t        cstr_len
 )
 {
     sstr_rc sstr_status = SSTR_FAIL;
@@ -148,4 +341,4930 @@ sstr_rc sstr_cmpcstr(
     }
 
     return sstr_status;
-}
\ No newline at end of file
+}
+
+
+/**
+ * Append the decimal representation of an unsigned integer to a secureString
+ */
+sstr_rc sstr_appd_u64(
+    uint64_t src_value,
+    sstring  *dst_str
+)
+{
+    sstr_rc sstr_status = SSTR_FAIL;
+
+    if (dst_str != NULL)
+    {
+        size_t value_len = sstr_u64_digits(src_value);
+
+        // check whether the destination secureString has enough
+        // capacity to get appended all digits
+        if ((dst_str->cap - dst_str->len) >= value_len)
+        {
+            dst_str->len += value_len;
+            sstr_write_u64(&(dst_str->chars[dst_str->len]), src_value);
+            // terminate destination secureString with a null-character
+            dst_str->chars[dst_str->len] = '\0';
+
+            sstr_status = SSTR_PASS;
+        }
+    }
+
+    return sstr_status;
+}
+
+
+/**
+ * Append the decimal representation of a signed integer to a secureString
+ */
+sstr_rc sstr_appd_i64(
+    int64_t src_value,
+    sstring *dst_str
+)
+{
+    sstr_rc sstr_status = SSTR_FAIL;
+
+    if (dst_str != NULL)
+    {
+        // the magnitude of INT64_MIN is only representable as unsigned
+        uint64_t magnitude = src_value < 0 ?
+                             0 - (uint64_t) src_value : (uint64_t) src_value;
+        size_t   value_len = sstr_u64_digits(magnitude) + (src_value < 0 ? 1 : 0);
+
+        if ((dst_str->cap - dst_str->len) >= value_len)
+        {
+            if (src_value < 0)
+            {
+                dst_str->chars[dst_str->len] = '-';
+            }
+            dst_str->len += value_len;
+            sstr_write_u64(&(dst_str->chars[dst_str->len]), magnitude);
+            // terminate destination secureString with a null-character
+            dst_str->chars[dst_str->len] = '\0';
+
+            sstr_status = SSTR_PASS;
+        }
+    }
+
+    return sstr_status;
+}
+
+
+/**
+ * Append the hexadecimal representation of an unsigned integer
+ * to a secureString
+ *
+ * Lowercase digits, no prefix, no leading zeros
+ */
+sstr_rc sstr_appd_hex(
+    uint64_t src_value,
+    sstring  *dst_str
+)
+{
+    sstr_rc sstr_status = SSTR_FAIL;
+
+    if (dst_str != NULL)
+    {
+        size_t value_len = sstr_u64_hex_digits(src_value);
+
+        if ((dst_str->cap - dst_str->len) >= value_len)
+        {
+            dst_str->len += value_len;
+            sstr_write_hex(&(dst_str->chars[dst_str->len]), src_value, sstr_hex_digits);
+            // terminate destination secureString with a null-character
+            dst_str->chars[dst_str->len] = '\0';
+
+            sstr_status = SSTR_PASS;
+        }
+    }
+
+    return sstr_status;
+}
+
+
+/**
+ * Append the shortest decimal representation of a double that converts
+ * back to the same value to a secureString
+ *
+ * Values from 1e-6 up to 1e21 are written in fixed-point notation,
+ * all other values in exponential notation (e.g. 1.5e-7, 2e+21).
+ * Special values are written as "inf", "-inf" and "nan".
+ */
+sstr_rc sstr_appd_double(
+    double  src_value,
+    sstring *dst_str
+)
+{
+    sstr_rc sstr_status = SSTR_FAIL;
+
+    if (dst_str != NULL)
+    {
+        uint64_t ieee_bits;
+        memcpy(&ieee_bits, &src_value, sizeof (ieee_bits));
+
+        int      negative      = (ieee_bits >> 63) != 0;
+        uint64_t ieee_mantissa = ieee_bits & ((((uint64_t) 1) << 52) - 1);
+        uint32_t ieee_exponent = (uint32_t) ((ieee_bits >> 52) & 0x7FF);
+
+        if (ieee_exponent == 0x7FF)
+        {
+            if (ieee_mantissa != 0)
+            {
+                sstr_status = sstr_appdcstr("nan", dst_str, 3);
+            }
+            else
+            if (negative)
+            {
+                sstr_status = sstr_appdcstr("-inf", dst_str, 4);
+            }
+            else
+            {
+                sstr_status = sstr_appdcstr("inf", dst_str, 3);
+            }
+        }
+        else
+        if (ieee_exponent == 0 && ieee_mantissa == 0)
+        {
+            if (negative)
+            {
+                sstr_status = sstr_appdcstr("-0", dst_str, 2);
+            }
+            else
+            {
+                sstr_status = sstr_appdcstr("0", dst_str, 1);
+            }
+        }
+        else
+        {
+            uint64_t digits;
+            int32_t  exp10;
+            sstr_ryu_d2d(ieee_mantissa, ieee_exponent, &digits, &exp10);
+
+            // the value is 0.d1d2...dk * 10^point
+            int32_t digits_len = (int32_t) sstr_u64_digits(digits);
+            int32_t point      = exp10 + digits_len;
+
+            size_t value_len = negative ? 1 : 0;
+            if (point >= digits_len && point <= 21)
+            {
+                // integer, padded with zeros
+                value_len += (size_t) point;
+            }
+            else
+            if (point > 0 && point <= 21)
+            {
+                // decimal point inside the digits
+                value_len += (size_t) digits_len + 1;
+            }
+            else
+            if (point > -6 && point <= 0)
+            {
+                // "0." followed by zeros and the digits
+                value_len += (size_t) (2 - point + digits_len);
+            }
+            else
+            {
+                // d[.ddd]e+x
+                int32_t exp_abs = point - 1 < 0 ? 1 - point : point - 1;
+                value_len += (size_t) digits_len + (digits_len > 1 ? 1 : 0) + 2 +
+                             sstr_u64_digits((uint64_t) exp_abs);
+            }
+
+            if ((dst_str->cap - dst_str->len) >= value_len)
+            {
+                sstr_format_decimal(&(dst_str->chars[dst_str->len]), negative,
+                                    digits, digits_len, point);
+                dst_str->len += value_len;
+                // terminate destination secureString with a null-character
+                dst_str->chars[dst_str->len] = '\0';
+
+                sstr_status = SSTR_PASS;
+            }
+        }
+    }
+
+    return sstr_status;
+}
+
+
+/**
+ * Append formatted text to a secureString
+ *
+ * Supports a subset of printf():
+ *   %d %i         int, with the length modifiers hh h l ll z j
+ *   %u %x %X      unsigned int, with the same length modifiers
+ *   %c            char
+ *   %s            C string; the precision limits the number of chars
+ *   %S            const sstring *; the precision limits the number of chars
+ *   %g            double, written as by sstr_appd_double()
+ *   %%            the '%' character, without flags or a field width
+ * Directives accept the flags '-' (left-justify) and '0' (pad integers
+ * with zeros) and a field width; width and precision may be given as '*'.
+ * Only %s and %S accept a precision.
+ *
+ * If the destination secureString does not have enough capacity, or the
+ * format contains an unsupported directive, a precision that is not
+ * supported or a NULL string argument, the chars appended so far are
+ * wiped and dst_str remains unchanged.
+ */
+sstr_rc sstr_appdf(
+    sstring    *dst_str,
+    const char *format,
+    ...
+)
+{
+    sstr_rc sstr_status = SSTR_FAIL;
+
+    va_list args;
+    va_start(args, format);
+    sstr_status = sstr_vappdf(dst_str, format, args);
+    va_end(args);
+
+    return sstr_status;
+}
+
+
+/**
+ * Append formatted text to a secureString, see sstr_appdf()
+ */
+sstr_rc sstr_vappdf(
+    sstring    *dst_str,
+    const char *format,
+    va_list    args
+)
+{
+    sstr_rc sstr_status = SSTR_FAIL;
+
+    if (dst_str != NULL && format != NULL)
+    {
+        // the helper functions fetch arguments through a pointer, which
+        // requires a va_list object rather than a va_list parameter
+        va_list fmt_args;
+        va_copy(fmt_args, args);
+
+        size_t     orig_len  = dst_str->len;
+        const char *fmt_char = format;
+        int        fmt_ok    = 1;
+        while (fmt_ok && *fmt_char != '\0')
+        {
+            sstr_format_spec spec = { 0, 0, 0, SSTR_SIZE_FAIL };
+            if (*fmt_char != '%')
+            {
+                // copy the text up to the next directive
+                const char *next_dir = strchr(fmt_char, '%');
+                size_t     text_len  = next_dir != NULL ?
+                                       (size_t) (next_dir - fmt_char) : strlen(fmt_char);
+                fmt_ok = sstr_format_chars(fmt_char, text_len, &spec, dst_str);
+                fmt_char += text_len;
+            }
+            else
+            {
+                ++fmt_char;
+                while (*fmt_char == '-' || *fmt_char == '0')
+                {
+                    if (*fmt_char == '-')
+                    {
+                        spec.left = 1;
+                    }
+                    else
+                    {
+                        spec.zero_pad = 1;
+                    }
+                    ++fmt_char;
+                }
+
+                if (*fmt_char == '*')
+                {
+                    int width = va_arg(fmt_args, int);
+                    if (width < 0)
+                    {
+                        // a negative width argument is a '-' flag
+                        spec.left  = 1;
+                        spec.width = 0 - (size_t) width;
+                    }
+                    else
+                    {
+                        spec.width = (size_t) width;
+                    }
+                    ++fmt_char;
+                }
+                else
+                {
+                    spec.width = sstr_format_width(&fmt_char);
+                }
+
+                if (*fmt_char == '.')
+                {
+                    ++fmt_char;
+                    if (*fmt_char == '*')
+                    {
+                        // a negative precision argument is ignored
+                        int precision = va_arg(fmt_args, int);
+                        if (precision >= 0)
+                        {
+                            spec.precision = (size_t) precision;
+                        }
+                        ++fmt_char;
+                    }
+                    else
+                    {
+                        spec.precision = sstr_format_width(&fmt_char);
+                    }
+                }
+
+                // length modifier, 'H' for hh and 'L' for ll
+                char len_mod = '\0';
+                if (*fmt_char == 'h' || *fmt_char == 'l')
+                {
+                    len_mod = *fmt_char;
+                    ++fmt_char;
+                    if (*fmt_char == len_mod)
+                    {
+                        len_mod = len_mod == 'h' ? 'H' : 'L';
+                        ++fmt_char;
+                    }
+                }
+                else
+                if (*fmt_char == 'z' || *fmt_char == 'j')
+                {
+                    len_mod = *fmt_char;
+                    ++fmt_char;
+                }
+
+                // the '0' flag is ignored with the '-' flag
+                spec.zero_pad = spec.zero_pad && !spec.left;
+
+                // only %s and %S accept a precision
+                int  has_precision = spec.precision != SSTR_SIZE_FAIL;
+                char conversion    = *fmt_char;
+                if ((conversion == 'd' || conversion == 'i') && !has_precision)
+                {
+                    int64_t value = sstr_format_signed_arg(len_mod, &fmt_args);
+                    // the magnitude of INT64_MIN is only representable as unsigned
+                    uint64_t magnitude = value < 0 ?
+                                         0 - (uint64_t) value : (uint64_t) value;
+                    fmt_ok = sstr_format_integer(magnitude, value < 0, NULL, &spec, dst_str);
+                }
+                else
+                if ((conversion == 'u' || conversion == 'x' || conversion == 'X') &&
+                    !has_precision)
+                {
+                    uint64_t   value      = sstr_format_unsigned_arg(len_mod, &fmt_args);
+                    const char *hex_chars = conversion == 'x' ? sstr_hex_digits :
+                                            conversion == 'X' ? sstr_hex_digits_upper : NULL;
+                    fmt_ok = sstr_format_integer(value, 0, hex_chars, &spec, dst_str);
+                }
+                else
+                if (conversion == 'c' && len_mod == '\0' && !has_precision)
+                {
+                    char src_char = (char) va_arg(fmt_args, int);
+                    fmt_ok = sstr_format_chars(&src_char, 1, &spec, dst_str);
+                }
+                else
+                if (conversion == 's' && len_mod == '\0')
+                {
+                    const char *src_cstr = va_arg(fmt_args, const char *);
+                    if (src_cstr != NULL)
+                    {
+                        size_t src_len = 0;
+                        if (spec.precision != SSTR_SIZE_FAIL)
+                        {
+                            // the string is not required to be terminated
+                            // within the precision
+                            const char *src_end = memchr(src_cstr, '\0', spec.precision);
+                            src_len = src_end != NULL ?
+                                      (size_t) (src_end - src_cstr) : spec.precision;
+                        }
+                        else
+                        {
+                            src_len = strlen(src_cstr);
+                        }
+                        fmt_ok = sstr_format_chars(src_cstr, src_len, &spec, dst_str);
+                    }
+                    else
+                    {
+                        fmt_ok = 0;
+                    }
+                }
+                else
+                if (conversion == 'S' && len_mod == '\0')
+                {
+                    const sstring *src_str = va_arg(fmt_args, const sstring *);
+                    if (src_str != NULL)
+                    {
+                        fmt_ok = sstr_format_chars(src_str->chars, src_str->len, &spec, dst_str);
+                    }
+                    else
+                    {
+                        fmt_ok = 0;
+                    }
+                }
+                else
+                if (conversion == 'g' && len_mod == '\0' && !has_precision)
+                {
+                    fmt_ok = sstr_format_double(va_arg(fmt_args, double), &spec, dst_str);
+                }
+                else
+                if (conversion == '%' && len_mod == '\0' && !has_precision &&
+                    !spec.left && !spec.zero_pad && spec.width == 0)
+                {
+                    fmt_ok = sstr_format_chars("%", 1, &spec, dst_str);
+                }
+                else
+                {
+                    // unsupported directive, precision or flags,
+                    // or end of the format
+                    fmt_ok = 0;
+                }
+
+                if (fmt_ok)
+                {
+                    ++fmt_char;
+                }
+            }
+        }
+        va_end(fmt_args);
+
+        if (fmt_ok)
+        {
+            sstr_status = SSTR_PASS;
+        }
+        else
+        {
+            // wipe the chars appended so far
+            memset(&(dst_str->chars[orig_len]), 0, dst_str->len - orig_len);
+            dst_str->len = orig_len;
+        }
+        // terminate destination secureString with a null-character
+        dst_str->chars[dst_str->len] = '\0';
+    }
+
+    return sstr_status;
+}
+
+
+/**
+ * Copy formatted text to a secureString (overwrite), see sstr_appdf()
+ *
+ * The arguments must not refer to dst_str.
+ * If formatting fails, dst_str is wiped.
+ */
+sstr_rc sstr_cpyf(
+    sstring    *dst_str,
+    const char *format,
+    ...
+)
+{
+    sstr_rc sstr_status = SSTR_FAIL;
+
+    if (dst_str != NULL)
+    {
+        dst_str->len = 0;
+
+        va_list args;
+        va_start(args, format);
+        sstr_status = sstr_vappdf(dst_str, format, args);
+        va_end(args);
+
+        if (sstr_status != SSTR_PASS)
+        {
+            // the previous contents have been partially overwritten
+            sstr_wipe(dst_str);
+        }
+    }
+
+    return sstr_status;
+}
+
+
+/**
+ * Convert a secureString to an unsigned integer
+ *
+ * The string must consist of decimal digits only. Leading zeros are
+ * accepted; signs and whitespace are not.
+ * Returns SSTR_RANGE if the value does not fit into an uint64_t.
+ * dst_value is only modified if the conversion succeeds.
+ */
+sstr_rc sstr_to_u64(
+    const sstring *src_str,
+    uint64_t      *dst_value
+)
+{
+    sstr_rc sstr_status = SSTR_FAIL;
+
+    if (src_str != NULL && dst_value != NULL)
+    {
+        sstr_status = sstr_parse_u64(src_str->chars, src_str->len, 0, dst_value);
+    }
+
+    return sstr_status;
+}
+
+
+/**
+ * Convert a secureString to a signed integer
+ *
+ * The string must consist of an optional sign followed by decimal digits.
+ * Returns SSTR_RANGE if the value does not fit into an int64_t.
+ * dst_value is only modified if the conversion succeeds.
+ */
+sstr_rc sstr_to_i64(
+    const sstring *src_str,
+    int64_t       *dst_value
+)
+{
+    sstr_rc sstr_status = SSTR_FAIL;
+
+    if (src_str != NULL && dst_value != NULL)
+    {
+        int    negative = 0;
+        size_t src_idx  = 0;
+        if (src_str->len > 0 && (src_str->chars[0] == '-' || src_str->chars[0] == '+'))
+        {
+            negative = src_str->chars[0] == '-';
+            src_idx  = 1;
+        }
+
+        uint64_t magnitude;
+        sstr_status = sstr_parse_u64(src_str->chars, src_str->len, src_idx, &magnitude);
+        if (sstr_status == SSTR_PASS)
+        {
+            // the magnitude of INT64_MIN is one more than INT64_MAX
+            if (magnitude > ((uint64_t) INT64_MAX) + (negative ? 1 : 0))
+            {
+                sstr_status = SSTR_RANGE;
+            }
+            else
+            if (negative)
+            {
+                (*dst_value) = magnitude > (uint64_t) INT64_MAX ?
+                               INT64_MIN : -((int64_t) magnitude);
+            }
+            else
+            {
+                (*dst_value) = (int64_t) magnitude;
+            }
+        }
+    }
+
+    return sstr_status;
+}
+
+
+/**
+ * Convert a secureString to a double
+ *
+ * The string must consist of an optional sign, decimal digits with an
+ * optional decimal point and an optional exponent (e.g. -1.5e-7), or one
+ * of "inf", "infinity" and "nan" (case-insensitive). Whitespace, hexadecimal
+ * notation and locale-specific decimal points are not accepted.
+ * The result is correctly rounded. Returns SSTR_RANGE if a finite number
+ * is too large for a double; numbers that are too small are rounded to
+ * zero or a subnormal value.
+ * dst_value is only modified if the conversion succeeds.
+ */
+sstr_rc sstr_to_double(
+    const sstring *src_str,
+    double        *dst_value
+)
+{
+    sstr_rc sstr_status = SSTR_FAIL;
+
+    if (src_str != NULL && dst_value != NULL)
+    {
+        sstr_status = sstr_parse_double(src_str->chars, src_str->len, dst_value);
+    }
+
+    return sstr_status;
+}
+
+
+/**
+ * Encode a secureString in hexadecimal (overwrite)
+ *
+ * Lowercase digits; dst_str needs a capacity of twice the length of src_str
+ */
+sstr_rc sstr_hex_encode(
+    const sstring *src_str,
+    sstring       *dst_str
+)
+{
+    sstr_rc sstr_status = SSTR_FAIL;
+
+    if (src_str != NULL && dst_str != NULL && src_str != dst_str)
+    {
+        if (src_str->len <= dst_str->cap / 2)
+        {
+            sstr_hex_encode_chars(src_str->chars, src_str->len, dst_str->chars);
+
+            // update destination secureString length
+            dst_str->len = src_str->len * 2;
+            // terminate destination secureString with a null-character
+            dst_str->chars[dst_str->len] = '\0';
+
+            sstr_status = SSTR_PASS;
+        }
+    }
+
+    return sstr_status;
+}
+
+
+/**
+ * Decode a hexadecimal secureString (overwrite)
+ *
+ * Upper- and lowercase digits are accepted; src_str must have an even
+ * length. If decoding fails on an invalid character, dst_str is wiped,
+ * so that no partially decoded data remains.
+ */
+sstr_rc sstr_hex_decode(
+    const sstring *src_str,
+    sstring       *dst_str
+)
+{
+    sstr_rc sstr_status = SSTR_FAIL;
+
+    if (src_str != NULL && dst_str != NULL && src_str != dst_str)
+    {
+        if (src_str->len % 2 == 0 && src_str->len / 2 <= dst_str->cap)
+        {
+            if (sstr_hex_decode_chars(src_str->chars, src_str->len, dst_str->chars))
+            {
+                // update destination secureString length
+                dst_str->len = src_str->len / 2;
+                // terminate destination secureString with a null-character
+                dst_str->chars[dst_str->len] = '\0';
+
+                sstr_status = SSTR_PASS;
+            }
+            else
+            {
+                sstr_wipe(dst_str);
+            }
+        }
+    }
+
+    return sstr_status;
+}
+
+
+/**
+ * Encode a secureString in Base64 (overwrite)
+ *
+ * Standard alphabet (RFC 4648, section 4) with padding;
+ * dst_str needs a capacity of 4 * ceil(src_len / 3)
+ */
+sstr_rc sstr_b64_encode(
+    const sstring *src_str,
+    sstring       *dst_str
+)
+{
+    return sstr_b64_encode_impl(src_str, dst_str, sstr_b64_std_alphabet, 1);
+}
+
+
+/**
+ * Decode a Base64 secureString (overwrite)
+ *
+ * Standard alphabet with padding. Whitespace and non-zero unused bits in
+ * the last character are rejected. If decoding fails on an invalid
+ * character, dst_str is wiped, so that no partially decoded data remains.
+ */
+sstr_rc sstr_b64_decode(
+    const sstring *src_str,
+    sstring       *dst_str
+)
+{
+    return sstr_b64_decode_impl(src_str, dst_str, sstr_b64_std_alphabet, 1);
+}
+
+
+/**
+ * Encode a secureString in URL-safe Base64 (overwrite)
+ *
+ * URL and filename safe alphabet (RFC 4648, section 5) without padding;
+ * dst_str needs a capacity of ceil(4 * src_len / 3)
+ */
+sstr_rc sstr_b64url_encode(
+    const sstring *src_str,
+    sstring       *dst_str
+)
+{
+    return sstr_b64_encode_impl(src_str, dst_str, sstr_b64_url_alphabet, 0);
+}
+
+
+/**
+ * Decode a URL-safe Base64 secureString (overwrite)
+ *
+ * URL and filename safe alphabet; padding is optional, but must be
+ * correct if present. If decoding fails on an invalid character, dst_str
+ * is wiped, so that no partially decoded data remains.
+ */
+sstr_rc sstr_b64url_decode(
+    const sstring *src_str,
+    sstring       *dst_str
+)
+{
+    return sstr_b64_decode_impl(src_str, dst_str, sstr_b64_url_alphabet, 0);
+}
+
+/**
+ * Escape a secureString for use in a JSON string (overwrite)
+ *
+ * '"', '\\' and the control characters 00 - 1F are escaped; all other
+ * bytes, including UTF-8 sequences, are copied unchanged. The exact
+ * output length is determined before anything is written, so dst_str
+ * remains unchanged if its capacity is insufficient.
+ */
+sstr_rc sstr_json_escape(
+    const sstring *src_str,
+    sstring       *dst_str
+)
+{
+    sstr_rc sstr_status = SSTR_FAIL;
+
+    if (src_str != NULL && dst_str != NULL && src_str != dst_str)
+    {
+        size_t extra_len = sstr_json_escape_extra(src_str->chars, src_str->len);
+        if (extra_len <= dst_str->cap && src_str->len <= dst_str->cap - extra_len)
+        {
+            if (extra_len == 0)
+            {
+                memcpy(dst_str->chars, src_str->chars, src_str->len);
+            }
+            else
+            {
+                sstr_json_escape_chars(src_str->chars, src_str->len, dst_str->chars);
+            }
+
+            // update destination secureString length
+            dst_str->len = src_str->len + extra_len;
+            // terminate destination secureString with a null-character
+            dst_str->chars[dst_str->len] = '\0';
+
+            sstr_status = SSTR_PASS;
+        }
+    }
+
+    return sstr_status;
+}
+
+
+/**
+ * Unescape the contents of a JSON string (overwrite)
+ *
+ * \uXXXX escapes, including surrogate pairs, are converted to UTF-8.
+ * Unescaped '"' and control characters, unknown escapes and lone
+ * surrogates are rejected. The input is validated completely before
+ * anything is written, so dst_str remains unchanged on failure.
+ */
+sstr_rc sstr_json_unescape(
+    const sstring *src_str,
+    sstring       *dst_str
+)
+{
+    sstr_rc sstr_status = SSTR_FAIL;
+
+    if (src_str != NULL && dst_str != NULL && src_str != dst_str)
+    {
+        size_t dst_len = sstr_json_unescaped_len(src_str->chars, src_str->len);
+        if (dst_len != SSTR_SIZE_FAIL && dst_len <= dst_str->cap)
+        {
+            // every escape is longer than the characters it stands for
+            if (dst_len == src_str->len)
+            {
+                memcpy(dst_str->chars, src_str->chars, src_str->len);
+            }
+            else
+            {
+                sstr_json_unescape_chars(src_str->chars, src_str->len, dst_str->chars);
+            }
+
+            // update destination secureString length
+            dst_str->len = dst_len;
+            // terminate destination secureString with a null-character
+            dst_str->chars[dst_str->len] = '\0';
+
+            sstr_status = SSTR_PASS;
+        }
+    }
+
+    return sstr_status;
+}
+
+
+/**
+ * Percent-encode a secureString (overwrite)
+ *
+ * All bytes except the unreserved characters of RFC 3986
+ * (A-Z a-z 0-9 - . _ ~) are encoded as %XX with uppercase hex digits.
+ * dst_str remains unchanged if its capacity is insufficient.
+ */
+sstr_rc sstr_url_encode(
+    const sstring *src_str,
+    sstring       *dst_str
+)
+{
+    sstr_rc sstr_status = SSTR_FAIL;
+
+    if (src_str != NULL && dst_str != NULL && src_str != dst_str)
+    {
+        size_t reserved_count = 0;
+        size_t src_idx        = sstr_url_next_reserved(src_str->chars, src_str->len, 0);
+        while (src_idx < src_str->len)
+        {
+            ++reserved_count;
+            src_idx = sstr_url_next_reserved(src_str->chars, src_str->len, src_idx + 1);
+        }
+
+        // each encoded byte adds two characters
+        if (reserved_count <= dst_str->cap / 2 &&
+            src_str->len <= dst_str->cap - reserved_count * 2)
+        {
+            char   *dst_chars = dst_str->chars;
+            size_t dst_idx    = 0;
+            src_idx = 0;
+            if (reserved_count == 0)
+            {
+                memcpy(dst_chars, src_str->chars, src_str->len);
+                dst_idx = src_idx = src_str->len;
+            }
+            while (src_idx < src_str->len)
+            {
+                size_t reserved_idx = sstr_url_next_reserved(src_str->chars, src_str->len,
+                                                             src_idx);
+                memcpy(&(dst_chars[dst_idx]), &(src_str->chars[src_idx]),
+                       reserved_idx - src_idx);
+                dst_idx += reserved_idx - src_idx;
+                if (reserved_idx < src_str->len)
+                {
+                    unsigned char src_char = (unsigned char) src_str->chars[reserved_idx];
+                    dst_chars[dst_idx]     = '%';
+                    dst_chars[dst_idx + 1] = sstr_hex_digits_upper[src_char >> 4];
+                    dst_chars[dst_idx + 2] = sstr_hex_digits_upper[src_char & 0x0F];
+                    dst_idx += 3;
+                }
+                src_idx = reserved_idx + 1;
+            }
+
+            // update destination secureString length
+            dst_str->len = dst_idx;
+            // terminate destination secureString with a null-character
+            dst_str->chars[dst_str->len] = '\0';
+
+            sstr_status = SSTR_PASS;
+        }
+    }
+
+    return sstr_status;
+}
+
+
+/**
+ * Decode a percent-encoded secureString (overwrite)
+ *
+ * Every '%' must be followed by two hex digits; '+' is not converted.
+ * The input is validated completely before anything is written,
+ * so dst_str remains unchanged on failure.
+ */
+sstr_rc sstr_url_decode(
+    const sstring *src_str,
+    sstring       *dst_str
+)
+{
+    sstr_rc sstr_status = SSTR_FAIL;
+
+    if (src_str != NULL && dst_str != NULL && src_str != dst_str)
+    {
+        const char *src_chars    = src_str->chars;
+        size_t     src_len       = src_str->len;
+        size_t     percent_count = 0;
+        int        valid         = 1;
+        const char *percent      = memchr(src_chars, '%', src_len);
+        while (valid && percent != NULL)
+        {
+            size_t percent_idx = (size_t) (percent - src_chars);
+            valid = src_len - percent_idx >= 3 &&
+                    sstr_hex_value(src_chars[percent_idx + 1]) >= 0 &&
+                    sstr_hex_value(src_chars[percent_idx + 2]) >= 0;
+            ++percent_count;
+            percent = valid ? memchr(&(src_chars[percent_idx + 3]), '%',
+                                     src_len - percent_idx - 3) : NULL;
+        }
+
+        // each decoded escape removes two characters
+        if (valid && src_len - percent_count * 2 <= dst_str->cap)
+        {
+            char   *dst_chars = dst_str->chars;
+            size_t src_idx    = 0;
+            size_t dst_idx    = 0;
+            while (src_idx < src_len)
+            {
+                percent = memchr(&(src_chars[src_idx]), '%', src_len - src_idx);
+                size_t percent_idx = percent != NULL ? (size_t) (percent - src_chars) : src_len;
+                memcpy(&(dst_chars[dst_idx]), &(src_chars[src_idx]), percent_idx - src_idx);
+                dst_idx += percent_idx - src_idx;
+                if (percent_idx < src_len)
+                {
+                    dst_chars[dst_idx] = (char) ((sstr_hex_value(src_chars[percent_idx + 1]) << 4) |
+                                                 sstr_hex_value(src_chars[percent_idx + 2]));
+                    ++dst_idx;
+                }
+                src_idx = percent_idx + 3;
+            }
+
+            // update destination secureString length
+            dst_str->len = dst_idx;
+            // terminate destination secureString with a null-character
+            dst_str->chars[dst_str->len] = '\0';
+
+            sstr_status = SSTR_PASS;
+        }
+    }
+
+    return sstr_status;
+}
+
+
+/**
+ * Number of decimal digits of an unsigned integer
+ */
+static size_t sstr_u64_digits(
+    uint64_t value
+)
+{
+    size_t   digits_len = 1;
+    uint64_t limit      = 10;
+    while (digits_len < 20 && value >= limit)
+    {
+        ++digits_len;
+        limit *= 10;
+    }
+
+    return digits_len;
+}
+
+
+/**
+ * Write the decimal digits of an unsigned integer backwards,
+ * ending before dst_end
+ *
+ * Two digits are produced per division using the digit pair table
+ */
+static void sstr_write_u64(
+    char     *dst_end,
+    uint64_t value
+)
+{
+    while (value >= 100)
+    {
+        size_t pair_idx = (size_t) (value % 100) * 2;
+        value /= 100;
+        *(--dst_end) = sstr_digit_pairs[pair_idx + 1];
+        *(--dst_end) = sstr_digit_pairs[pair_idx];
+    }
+    if (value >= 10)
+    {
+        size_t pair_idx = (size_t) value * 2;
+        *(--dst_end) = sstr_digit_pairs[pair_idx + 1];
+        *(--dst_end) = sstr_digit_pairs[pair_idx];
+    }
+    else
+    {
+        *(--dst_end) = (char) ('0' + value);
+    }
+}
+
+
+/**
+ * Write the decimal representation 0.d1d2...dk * 10^point
+ * in the notation selected by sstr_appd_double()
+ */
+static void sstr_format_decimal(
+    char     *dst_chars,
+    int      negative,
+    uint64_t digits,
+    int32_t  digits_len,
+    int32_t  point
+)
+{
+    size_t dst_idx = 0;
+    if (negative)
+    {
+        dst_chars[dst_idx++] = '-';
+    }
+
+    if (point >= digits_len && point <= 21)
+    {
+        sstr_write_u64(&(dst_chars[dst_idx + (size_t) digits_len]), digits);
+        dst_idx += (size_t) digits_len;
+        for (int32_t zero_nr = digits_len; zero_nr < point; ++zero_nr)
+        {
+            dst_chars[dst_idx++] = '0';
+        }
+    }
+    else
+    if (point > 0 && point <= 21)
+    {
+        // write the digits, then move the fractional digits one place
+        // to the right to make room for the decimal point
+        sstr_write_u64(&(dst_chars[dst_idx + (size_t) digits_len]), digits);
+        memmove(&(dst_chars[dst_idx + (size_t) point + 1]),
+                &(dst_chars[dst_idx + (size_t) point]),
+                (size_t) (digits_len - point));
+        dst_chars[dst_idx + (size_t) point] = '.';
+    }
+    else
+    if (point > -6 && point <= 0)
+    {
+        dst_chars[dst_idx++] = '0';
+        dst_chars[dst_idx++] = '.';
+        for (int32_t zero_nr = point; zero_nr < 0; ++zero_nr)
+        {
+            dst_chars[dst_idx++] = '0';
+        }
+        sstr_write_u64(&(dst_chars[dst_idx + (size_t) digits_len]), digits);
+    }
+    else
+    {
+        // write the digits after the position of the decimal point,
+        // then move the first digit in front of it
+        sstr_write_u64(&(dst_chars[dst_idx + 1 + (size_t) digits_len]), digits);
+        dst_chars[dst_idx] = dst_chars[dst_idx + 1];
+        if (digits_len > 1)
+        {
+            dst_chars[dst_idx + 1] = '.';
+            dst_idx += (size_t) digits_len + 1;
+        }
+        else
+        {
+            dst_idx += 1;
+        }
+
+        int32_t exp_value = point - 1;
+        dst_chars[dst_idx++] = 'e';
+        dst_chars[dst_idx++] = exp_value < 0 ? '-' : '+';
+        uint64_t exp_abs = (uint64_t) (exp_value < 0 ? -exp_value : exp_value);
+        sstr_write_u64(&(dst_chars[dst_idx + sstr_u64_digits(exp_abs)]), exp_abs);
+    }
+}
+
+
+/**
+ * Number of hexadecimal digits of an unsigned integer
+ */
+static size_t sstr_u64_hex_digits(
+    uint64_t value
+)
+{
+    size_t digits_len = 1;
+    while (digits_len < 16 && (value >> (digits_len * 4)) != 0)
+    {
+        ++digits_len;
+    }
+
+    return digits_len;
+}
+
+
+/**
+ * Write the hexadecimal digits of an unsigned integer backwards,
+ * ending before dst_end
+ */
+static void sstr_write_hex(
+    char       *dst_end,
+    uint64_t   value,
+    const char *hex_digits
+)
+{
+    do
+    {
+        *(--dst_end) = hex_digits[value & 0xF];
+        value >>= 4;
+    }
+    while (value != 0);
+}
+
+
+/**
+ * Parse the decimal field width or precision of a format directive
+ *
+ * Values that exceed the maximum capacity of a secureString are limited
+ * to a value that no secureString can accommodate.
+ */
+static size_t sstr_format_width(
+    const char **fmt_chars
+)
+{
+    size_t     width    = 0;
+    const char *fmt_char = *fmt_chars;
+    while (*fmt_char >= '0' && *fmt_char <= '9')
+    {
+        if (width <= SSTR_CAP_MAX)
+        {
+            width = width * 10 + (size_t) (*fmt_char - '0');
+        }
+        ++fmt_char;
+    }
+    *fmt_chars = fmt_char;
+
+    return width <= SSTR_CAP_MAX ? width : SSTR_CAP_MAX + 1;
+}
+
+
+/**
+ * Fetch a signed integer argument of the type selected by a length modifier
+ */
+static int64_t sstr_format_signed_arg(
+    char    len_mod,
+    va_list *args
+)
+{
+    int64_t value = 0;
+    if (len_mod == 'H')
+    {
+        value = (signed char) va_arg(*args, int);
+    }
+    else
+    if (len_mod == 'h')
+    {
+        value = (short) va_arg(*args, int);
+    }
+    else
+    if (len_mod == 'l')
+    {
+        value = va_arg(*args, long);
+    }
+    else
+    if (len_mod == 'L')
+    {
+        value = va_arg(*args, long long);
+    }
+    else
+    if (len_mod == 'z')
+    {
+        value = va_arg(*args, ssize_t);
+    }
+    else
+    if (len_mod == 'j')
+    {
+        value = (int64_t) va_arg(*args, intmax_t);
+    }
+    else
+    {
+        value = va_arg(*args, int);
+    }
+
+    return value;
+}
+
+
+/**
+ * Fetch an unsigned integer argument of the type selected by a length modifier
+ */
+static uint64_t sstr_format_unsigned_arg(
+    char    len_mod,
+    va_list *args
+)
+{
+    uint64_t value = 0;
+    if (len_mod == 'H')
+    {
+        value = (unsigned char) va_arg(*args, unsigned int);
+    }
+    else
+    if (len_mod == 'h')
+    {
+        value = (unsigned short) va_arg(*args, unsigned int);
+    }
+    else
+    if (len_mod == 'l')
+    {
+        value = va_arg(*args, unsigned long);
+    }
+    else
+    if (len_mod == 'L')
+    {
+        value = va_arg(*args, unsigned long long);
+    }
+    else
+    if (len_mod == 'z')
+    {
+        value = va_arg(*args, size_t);
+    }
+    else
+    if (len_mod == 'j')
+    {
+        value = (uint64_t) va_arg(*args, uintmax_t);
+    }
+    else
+    {
+        value = va_arg(*args, unsigned int);
+    }
+
+    return value;
+}
+
+
+/**
+ * Append chars, padded with spaces to the field width, to a secureString
+ *
+ * Returns 0 if the destination secureString does not have enough capacity
+ */
+static int sstr_format_chars(
+    const char             *src_chars,
+    size_t                 src_len,
+    const sstr_format_spec *spec,
+    sstring                *dst_str
+)
+{
+    int fmt_ok = 0;
+
+    if (spec->precision < src_len)
+    {
+        src_len = spec->precision;
+    }
+    size_t field_len = spec->width > src_len ? spec->width : src_len;
+
+    if ((dst_str->cap - dst_str->len) >= field_len)
+    {
+        char   *dst_chars = &(dst_str->chars[dst_str->len]);
+        size_t pad_len    = field_len - src_len;
+        if (spec->left)
+        {
+            memcpy(dst_chars, src_chars, src_len);
+            memset(&(dst_chars[src_len]), ' ', pad_len);
+        }
+        else
+        {
+            memset(dst_chars, ' ', pad_len);
+            memcpy(&(dst_chars[pad_len]), src_chars, src_len);
+        }
+        dst_str->len += field_len;
+
+        fmt_ok = 1;
+    }
+
+    return fmt_ok;
+}
+
+
+/**
+ * Append an integer, padded to the field width, to a secureString
+ *
+ * The integer is written in decimal notation if hex_digits is NULL.
+ * Returns 0 if the destination secureString does not have enough capacity
+ */
+static int sstr_format_integer(
+    uint64_t               magnitude,
+    int                    negative,
+    const char             *hex_digits,
+    const sstr_format_spec *spec,
+    sstring                *dst_str
+)
+{
+    int fmt_ok = 0;
+
+    size_t sign_len  = negative ? 1 : 0;
+    size_t value_len = sign_len + (hex_digits == NULL ?
+                                   sstr_u64_digits(magnitude) : sstr_u64_hex_digits(magnitude));
+    size_t field_len = spec->width > value_len ? spec->width : value_len;
+
+    if ((dst_str->cap - dst_str->len) >= field_len)
+    {
+        char   *dst_chars = &(dst_str->chars[dst_str->len]);
+        size_t pad_len    = field_len - value_len;
+        size_t sign_idx   = 0;
+        if (spec->left)
+        {
+            memset(&(dst_chars[value_len]), ' ', pad_len);
+        }
+        else
+        if (spec->zero_pad)
+        {
+            // zeros are inserted between the sign and the digits
+            memset(&(dst_chars[sign_len]), '0', pad_len);
+        }
+        else
+        {
+            memset(dst_chars, ' ', pad_len);
+            sign_idx = pad_len;
+        }
+        if (negative)
+        {
+            dst_chars[sign_idx] = '-';
+        }
+
+        char *digits_end = &(dst_chars[spec->left ? value_len : field_len]);
+        if (hex_digits == NULL)
+        {
+            sstr_write_u64(digits_end, magnitude);
+        }
+        else
+        {
+            sstr_write_hex(digits_end, magnitude, hex_digits);
+        }
+        dst_str->len += field_len;
+
+        fmt_ok = 1;
+    }
+
+    return fmt_ok;
+}
+
+
+/**
+ * Append a double, padded with spaces to the field width, to a secureString
+ *
+ * Returns 0 if the destination secureString does not have enough capacity
+ */
+static int sstr_format_double(
+    double                 src_value,
+    const sstr_format_spec *spec,
+    sstring                *dst_str
+)
+{
+    int fmt_ok = 0;
+
+    size_t value_idx = dst_str->len;
+    if (sstr_appd_double(src_value, dst_str) == SSTR_PASS)
+    {
+        size_t value_len = dst_str->len - value_idx;
+        size_t pad_len   = spec->width > value_len ? spec->width - value_len : 0;
+        if ((dst_str->cap - dst_str->len) >= pad_len)
+        {
+            char *dst_chars = &(dst_str->chars[value_idx]);
+            if (spec->left)
+            {
+                memset(&(dst_chars[value_len]), ' ', pad_len);
+            }
+            else
+            {
+                memmove(&(dst_chars[pad_len]), dst_chars, value_len);
+                memset(dst_chars, ' ', pad_len);
+            }
+            dst_str->len += pad_len;
+
+            fmt_ok = 1;
+        }
+    }
+
+    return fmt_ok;
+}
+
+
+/*
+ * Shortest round-trip conversion of doubles to decimal
+ *
+ * Implementation of the Ryu algorithm by Ulf Adams,
+ * "Ryu: Fast Float-to-String Conversion", PLDI 2018
+ */
+
+#define SSTR_DOUBLE_MANTISSA_BITS  52
+#define SSTR_DOUBLE_BIAS           1023
+#define SSTR_POW5_BITCOUNT         125
+#define SSTR_POW5_INV_BITCOUNT     125
+
+// 5^i, normalized to 125 significant bits, for 0 <= i < 326
+static const uint64_t sstr_pow5_split[326][2] =
+{
+    { 0x0000000000000000ULL, 0x1000000000000000ULL },
+    { 0x0000000000000000ULL, 0x1400000000000000ULL },
+    { 0x0000000000000000ULL, 0x1900000000000000ULL },
+    { 0x0000000000000000ULL, 0x1F40000000000000ULL },
+    { 0x0000000000000000ULL, 0x1388000000000000ULL },
+    { 0x0000000000000000ULL, 0x186A000000000000ULL },
+    { 0x0000000000000000ULL, 0x1E84800000000000ULL },
+    { 0x0000000000000000ULL, 0x1312D00000000000ULL },
+    { 0x0000000000000000ULL, 0x17D7840000000000ULL },
+    { 0x0000000000000000ULL, 0x1DCD650000000000ULL },
+    { 0x0000000000000000ULL, 0x12A05F2000000000ULL },
+    { 0x0000000000000000ULL, 0x174876E800000000ULL },
+    { 0x0000000000000000ULL, 0x1D1A94A200000000ULL },
+    { 0x0000000000000000ULL, 0x12309CE540000000ULL },
+    { 0x0000000000000000ULL, 0x16BCC41E90000000ULL },
+    { 0x0000000000000000ULL, 0x1C6BF52634000000ULL },
+    { 0x0000000000000000ULL, 0x11C37937E0800000ULL },
+    { 0x0000000000000000ULL, 0x16345785D8A00000ULL },
+    { 0x0000000000000000ULL, 0x1BC16D674EC80000ULL },
+    { 0x0000000000000000ULL, 0x1158E460913D0000ULL },
+    { 0x0000000000000000ULL, 0x15AF1D78B58C4000ULL },
+    { 0x0000000000000000ULL, 0x1B1AE4D6E2EF5000ULL },
+    { 0x0000000000000000ULL, 0x10F0CF064DD59200ULL },
+    { 0x0000000000000000ULL, 0x152D02C7E14AF680ULL },
+    { 0x0000000000000000ULL, 0x1A784379D99DB420ULL },
+    { 0x0000000000000000ULL, 0x108B2A2C28029094ULL },
+    { 0x0000000000000000ULL, 0x14ADF4B7320334B9ULL },
+    { 0x4000000000000000ULL, 0x19D971E4FE8401E7ULL },
+    { 0x8800000000000000ULL, 0x1027E72F1F128130ULL },
+    { 0xAA00000000000000ULL, 0x1431E0FAE6D7217CULL },
+    { 0xD480000000000000ULL, 0x193E5939A08CE9DBULL },
+    { 0xC9A0000000000000ULL, 0x1F8DEF8808B02452ULL },
+    { 0xBE04000000000000ULL, 0x13B8B5B5056E16B3ULL },
+    { 0xAD85000000000000ULL, 0x18A6E32246C99C60ULL },
+    { 0xD8E6400000000000ULL, 0x1ED09BEAD87C0378ULL },
+    { 0x878FE80000000000ULL, 0x13426172C74D822BULL },
+    { 0x6973E20000000000ULL, 0x1812F9CF7920E2B6ULL },
+    { 0x03D0DA8000000000ULL, 0x1E17B84357691B64ULL },
+    { 0x8262889000000000ULL, 0x12CED32A16A1B11EULL },
+    { 0x22FB2AB400000000ULL, 0x178287F49C4A1D66ULL },
+    { 0xABB9F56100000000ULL, 0x1D6329F1C35CA4BFULL },
+    { 0xCB54395CA0000000ULL, 0x125DFA371A19E6F7ULL },
+    { 0xBE2947B3C8000000ULL, 0x16F578C4E0A060B5ULL },
+    { 0x2DB399A0BA000000ULL, 0x1CB2D6F618C878E3ULL },
+    { 0xFC90400474400000ULL, 0x11EFC659CF7D4B8DULL },
+    { 0x7BB4500591500000ULL, 0x166BB7F0435C9E71ULL },
+    { 0xDAA16406F5A40000ULL, 0x1C06A5EC5433C60DULL },
+    { 0xA8A4DE8459868000ULL, 0x118427B3B4A05BC8ULL },
+    { 0xD2CE16256FE82000ULL, 0x15E531A0A1C872BAULL },
+    { 0x87819BAECBE22800ULL, 0x1B5E7E08CA3A8F69ULL },
+    { 0xF4B1014D3F6D5900ULL, 0x111B0EC57E6499A1ULL },
+    { 0x71DD41A08F48AF40ULL, 0x1561D276DDFDC00AULL },
+    { 0x0E549208B31ADB10ULL, 0x1ABA4714957D300DULL },
+    { 0x28F4DB456FF0C8EAULL, 0x10B46C6CDD6E3E08ULL },
+    { 0x33321216CBECFB24ULL, 0x14E1878814C9CD8AULL },
+    { 0xBFFE969C7EE839EDULL, 0x1A19E96A19FC40ECULL },
+    { 0xF7FF1E21CF512434ULL, 0x105031E2503DA893ULL },
+    { 0xF5FEE5AA43256D41ULL, 0x14643E5AE44D12B8ULL },
+    { 0x337E9F14D3EEC892ULL, 0x197D4DF19D605767ULL },
+    { 0x005E46DA08EA7AB6ULL, 0x1FDCA16E04B86D41ULL },
+    { 0xA03AEC4845928CB2ULL, 0x13E9E4E4C2F34448ULL },
+    { 0xC849A75A56F72FDEULL, 0x18E45E1DF3B0155AULL },
+    { 0x7A5C1130ECB4FBD6ULL, 0x1F1D75A5709C1AB1ULL },
+    { 0xEC798ABE93F11D65ULL, 0x13726987666190AEULL },
+    { 0xA797ED6E38ED64BFULL, 0x184F03E93FF9F4DAULL },
+    { 0x517DE8C9C728BDEFULL, 0x1E62C4E38FF87211ULL },
+    { 0xD2EEB17E1C7976B5ULL, 0x12FDBB0E39FB474AULL },
+    { 0x87AA5DDDA397D462ULL, 0x17BD29D1C87A191DULL },
+    { 0xE994F5550C7DC97BULL, 0x1DAC74463A989F64ULL },
+    { 0x11FD195527CE9DEDULL, 0x128BC8ABE49F639FULL },
+    { 0xD67C5FAA71C24568ULL, 0x172EBAD6DDC73C86ULL },
+    { 0x8C1B77950E32D6C2ULL, 0x1CFA698C95390BA8ULL },
+    { 0x57912ABD28DFC639ULL, 0x121C81F7DD43A749ULL },
+    { 0xAD75756C7317B7C8ULL, 0x16A3A275D494911BULL },
+    { 0x98D2D2C78FDDA5BAULL, 0x1C4C8B1349B9B562ULL },
+    { 0x9F83C3BCB9EA8794ULL, 0x11AFD6EC0E14115DULL },
+    { 0x0764B4ABE8652979ULL, 0x161BCCA7119915B5ULL },
+    { 0x493DE1D6E27E73D7ULL, 0x1BA2BFD0D5FF5B22ULL },
+    { 0x6DC6AD264D8F0866ULL, 0x1145B7E285BF98F5ULL },
+    { 0xC938586FE0F2CA80ULL, 0x159725DB272F7F32ULL },
+    { 0x7B866E8BD92F7D20ULL, 0x1AFCEF51F0FB5EFFULL },
+    { 0xAD34051767BDAE34ULL, 0x10DE1593369D1B5FULL },
+    { 0x9881065D41AD19C1ULL, 0x15159AF804446237ULL },
+    { 0x7EA147F492186032ULL, 0x1A5B01B605557AC5ULL },
+    { 0x6F24CCF8DB4F3C1FULL, 0x1078E111C3556CBBULL },
+    { 0x4AEE003712230B27ULL, 0x14971956342AC7EAULL },
+    { 0xDDA98044D6ABCDF0ULL, 0x19BCDFABC13579E4ULL },
+    { 0x0A89F02B062B60B6ULL, 0x10160BCB58C16C2FULL },
+    { 0xCD2C6C35C7B638E4ULL, 0x141B8EBE2EF1C73AULL },
+    { 0x8077874339A3C71DULL, 0x1922726DBAAE3909ULL },
+    { 0xE0956914080CB8E4ULL, 0x1F6B0F092959C74BULL },
+    { 0x6C5D61AC8507F38EULL, 0x13A2E965B9D81C8FULL },
+    { 0x4774BA17A649F072ULL, 0x188BA3BF284E23B3ULL },
+    { 0x1951E89D8FDC6C8FULL, 0x1EAE8CAEF261ACA0ULL },
+    { 0x0FD3316279E9C3D9ULL, 0x132D17ED577D0BE4ULL },
+    { 0x13C7FDBB186434CFULL, 0x17F85DE8AD5C4EDDULL },
+    { 0x58B9FD29DE7D4203ULL, 0x1DF67562D8B36294ULL },
+    { 0xB7743E3A2B0E4942ULL, 0x12BA095DC7701D9CULL },
+    { 0xE5514DC8B5D1DB92ULL, 0x17688BB5394C2503ULL },
+    { 0xDEA5A13AE3465277ULL, 0x1D42AEA2879F2E44ULL },
+    { 0x0B2784C4CE0BF38AULL, 0x1249AD2594C37CEBULL },
+    { 0xCDF165F6018EF06DULL, 0x16DC186EF9F45C25ULL },
+    { 0x416DBF7381F2AC88ULL, 0x1C931E8AB871732FULL },
+    { 0x88E497A83137ABD5ULL, 0x11DBF316B346E7FDULL },
+    { 0xEB1DBD923D8596CAULL, 0x1652EFDC6018A1FCULL },
+    { 0x25E52CF6CCE6FC7DULL, 0x1BE7ABD3781ECA7CULL },
+    { 0x97AF3C1A40105DCEULL, 0x1170CB642B133E8DULL },
+    { 0xFD9B0B20D0147542ULL, 0x15CCFE3D35D80E30ULL },
+    { 0x3D01CDE904199292ULL, 0x1B403DCC834E11BDULL },
+    { 0x462120B1A28FFB9BULL, 0x1108269FD210CB16ULL },
+    { 0xD7A968DE0B33FA82ULL, 0x154A3047C694FDDBULL },
+    { 0xCD93C3158E00F923ULL, 0x1A9CBC59B83A3D52ULL },
+    { 0xC07C59ED78C09BB6ULL, 0x10A1F5B813246653ULL },
+    { 0xB09B7068D6F0C2A3ULL, 0x14CA732617ED7FE8ULL },
+    { 0xDCC24C830CACF34CULL, 0x19FD0FEF9DE8DFE2ULL },
+    { 0xC9F96FD1E7EC180FULL, 0x103E29F5C2B18BEDULL },
+    { 0x3C77CBC661E71E13ULL, 0x144DB473335DEEE9ULL },
+    { 0x8B95BEB7FA60E598ULL, 0x1961219000356AA3ULL },
+    { 0x6E7B2E65F8F91EFEULL, 0x1FB969F40042C54CULL },
+    { 0xC50CFCFFBB9BB35FULL, 0x13D3E2388029BB4FULL },
+    { 0xB6503C3FAA82A037ULL, 0x18C8DAC6A0342A23ULL },
+    { 0xA3E44B4F95234844ULL, 0x1EFB1178484134ACULL },
+    { 0xE66EAF11BD360D2BULL, 0x135CEAEB2D28C0EBULL },
+    { 0xE00A5AD62C839075ULL, 0x183425A5F872F126ULL },
+    { 0x980CF18BB7A47493ULL, 0x1E412F0F768FAD70ULL },
+    { 0x5F0816F752C6C8DCULL, 0x12E8BD69AA19CC66ULL },
+    { 0xF6CA1CB527787B13ULL, 0x17A2ECC414A03F7FULL },
+    { 0xF47CA3E2715699D7ULL, 0x1D8BA7F519C84F5FULL },
+    { 0xF8CDE66D86D62026ULL, 0x127748F9301D319BULL },
+    { 0xF7016008E88BA830ULL, 0x17151B377C247E02ULL },
+    { 0xB4C1B80B22AE923CULL, 0x1CDA62055B2D9D83ULL },
+    { 0x50F91306F5AD1B65ULL, 0x12087D4358FC8272ULL },
+    { 0xE53757C8B318623FULL, 0x168A9C942F3BA30EULL },
+    { 0x9E852DBADFDE7ACFULL, 0x1C2D43B93B0A8BD2ULL },
+    { 0xA3133C94CBEB0CC1ULL, 0x119C4A53C4E69763ULL },
+    { 0x8BD80BB9FEE5CFF1ULL, 0x16035CE8B6203D3CULL },
+    { 0xAECE0EA87E9F43EEULL, 0x1B843422E3A84C8BULL },
+    { 0x4D40C9294F238A75ULL, 0x1132A095CE492FD7ULL },
+    { 0x2090FB73A2EC6D12ULL, 0x157F48BB41DB7BCDULL },
+    { 0x68B53A508BA78856ULL, 0x1ADF1AEA12525AC0ULL },
+    { 0x417144725748B536ULL, 0x10CB70D24B7378B8ULL },
+    { 0x51CD958EED1AE283ULL, 0x14FE4D06DE5056E6ULL },
+    { 0xE640FAF2A8619B24ULL, 0x1A3DE04895E46C9FULL },
+    { 0xEFE89CD7A93D00F7ULL, 0x1066AC2D5DAEC3E3ULL },
+    { 0xEBE2C40D938C4134ULL, 0x14805738B51A74DCULL },
+    { 0x26DB7510F86F5181ULL, 0x19A06D06E2611214ULL },
+    { 0x9849292A9B4592F1ULL, 0x100444244D7CAB4CULL },
+    { 0xBE5B73754216F7ADULL, 0x1405552D60DBD61FULL },
+    { 0xADF25052929CB598ULL, 0x1906AA78B912CBA7ULL },
+    { 0x996EE4673743E2FFULL, 0x1F485516E7577E91ULL },
+    { 0xFFE54EC0828A6DDFULL, 0x138D352E5096AF1AULL },
+    { 0xBFDEA270A32D0957ULL, 0x18708279E4BC5AE1ULL },
+    { 0x2FD64B0CCBF84BADULL, 0x1E8CA3185DEB719AULL },
+    { 0x5DE5EEE7FF7B2F4CULL, 0x1317E5EF3AB32700ULL },
+    { 0x755F6AA1FF59FB1FULL, 0x17DDDF6B095FF0C0ULL },
+    { 0x92B7454A7F3079E7ULL, 0x1DD55745CBB7ECF0ULL },
+    { 0x5BB28B4E8F7E4C30ULL, 0x12A5568B9F52F416ULL },
+    { 0xF29F2E22335DDF3CULL, 0x174EAC2E8727B11BULL },
+    { 0xEF46F9AAC035570BULL, 0x1D22573A28F19D62ULL },
+    { 0xD58C5C0AB8215667ULL, 0x123576845997025DULL },
+    { 0x4AEF730D6629AC01ULL, 0x16C2D4256FFCC2F5ULL },
+    { 0x9DAB4FD0BFB41701ULL, 0x1C73892ECBFBF3B2ULL },
+    { 0xA28B11E277D08E60ULL, 0x11C835BD3F7D784FULL },
+    { 0x8B2DD65B15C4B1F9ULL, 0x163A432C8F5CD663ULL },
+    { 0x6DF94BF1DB35DE77ULL, 0x1BC8D3F7B3340BFCULL },
+    { 0xC4BBCF772901AB0AULL, 0x115D847AD000877DULL },
+    { 0x35EAC354F34215CDULL, 0x15B4E5998400A95DULL },
+    { 0x8365742A30129B40ULL, 0x1B221EFFE500D3B4ULL },
+    { 0xD21F689A5E0BA108ULL, 0x10F5535FEF208450ULL },
+    { 0x06A742C0F58E894AULL, 0x1532A837EAE8A565ULL },
+    { 0x4851137132F22B9DULL, 0x1A7F5245E5A2CEBEULL },
+    { 0xED32AC26BFD75B42ULL, 0x108F936BAF85C136ULL },
+    { 0xA87F57306FCD3212ULL, 0x14B378469B673184ULL },
+    { 0xD29F2CFC8BC07E97ULL, 0x19E056584240FDE5ULL },
+    { 0xA3A37C1DD7584F1EULL, 0x102C35F729689EAFULL },
+    { 0x8C8C5B254D2E62E6ULL, 0x14374374F3C2C65BULL },
+    { 0x6FAF71EEA079FB9FULL, 0x1945145230B377F2ULL },
+    { 0x0B9B4E6A48987A87ULL, 0x1F965966BCE055EFULL },
+    { 0x674111026D5F4C94ULL, 0x13BDF7E0360C35B5ULL },
+    { 0xC111554308B71FBAULL, 0x18AD75D8438F4322ULL },
+    { 0x7155AA93CAE4E7A8ULL, 0x1ED8D34E547313EBULL },
+    { 0x26D58A9C5ECF10C9ULL, 0x13478410F4C7EC73ULL },
+    { 0xF08AED437682D4FBULL, 0x1819651531F9E78FULL },
+    { 0xECADA89454238A3AULL, 0x1E1FBE5A7E786173ULL },
+    { 0x73EC895CB4963664ULL, 0x12D3D6F88F0B3CE8ULL },
+    { 0x90E7ABB3E1BBC3FDULL, 0x1788CCB6B2CE0C22ULL },
+    { 0x352196A0DA2AB4FDULL, 0x1D6AFFE45F818F2BULL },
+    { 0x0134FE24885AB11EULL, 0x1262DFEEBBB0F97BULL },
+    { 0xC1823DADAA715D65ULL, 0x16FB97EA6A9D37D9ULL },
+    { 0x31E2CD19150DB4BFULL, 0x1CBA7DE5054485D0ULL },
+    { 0x1F2DC02FAD2890F7ULL, 0x11F48EAF234AD3A2ULL },
+    { 0xA6F9303B9872B535ULL, 0x1671B25AEC1D888AULL },
+    { 0x50B77C4A7E8F6282ULL, 0x1C0E1EF1A724EAADULL },
+    { 0x5272ADAE8F199D91ULL, 0x1188D357087712ACULL },
+    { 0x670F591A32E004F6ULL, 0x15EB082CCA94D757ULL },
+    { 0x40D32F60BF980633ULL, 0x1B65CA37FD3A0D2DULL },
+    { 0x4883FD9C77BF03E0ULL, 0x111F9E62FE44483CULL },
+    { 0x5AA4FD0395AEC4D8ULL, 0x156785FBBDD55A4BULL },
+    { 0x314E3C447B1A760EULL, 0x1AC1677AAD4AB0DEULL },
+    { 0xDED0E5AACCF089C9ULL, 0x10B8E0ACAC4EAE8AULL },
+    { 0x96851F15802CAC3BULL, 0x14E718D7D7625A2DULL },
+    { 0xFC2666DAE037D74AULL, 0x1A20DF0DCD3AF0B8ULL },
+    { 0x9D980048CC22E68EULL, 0x10548B68A044D673ULL },
+    { 0x84FE005AFF2BA032ULL, 0x1469AE42C8560C10ULL },
+    { 0xA63D8071BEF6883EULL, 0x198419D37A6B8F14ULL },
+    { 0xCFCCE08E2EB42A4EULL, 0x1FE52048590672D9ULL },
+    { 0x21E00C58DD309A70ULL, 0x13EF342D37A407C8ULL },
+    { 0x2A580F6F147CC10DULL, 0x18EB0138858D09BAULL },
+    { 0xB4EE134AD99BF150ULL, 0x1F25C186A6F04C28ULL },
+    { 0x7114CC0EC80176D2ULL, 0x137798F428562F99ULL },
+    { 0xCD59FF127A01D486ULL, 0x18557F31326BBB7FULL },
+    { 0xC0B07ED7188249A8ULL, 0x1E6ADEFD7F06AA5FULL },
+    { 0xD86E4F466F516E09ULL, 0x1302CB5E6F642A7BULL },
+    { 0xCE89E3180B25C98BULL, 0x17C37E360B3D351AULL },
+    { 0x822C5BDE0DEF3BEEULL, 0x1DB45DC38E0C8261ULL },
+    { 0xF15BB96AC8B58575ULL, 0x1290BA9A38C7D17CULL },
+    { 0x2DB2A7C57AE2E6D2ULL, 0x1734E940C6F9C5DCULL },
+    { 0x391F51B6D99BA086ULL, 0x1D022390F8B83753ULL },
+    { 0x03B3931248014454ULL, 0x1221563A9B732294ULL },
+    { 0x04A077D6DA019569ULL, 0x16A9ABC9424FEB39ULL },
+    { 0x45C895CC9081FAC3ULL, 0x1C5416BB92E3E607ULL },
+    { 0x8B9D5D9FDA513CBAULL, 0x11B48E353BCE6FC4ULL },
+    { 0xAE84B507D0E58BE8ULL, 0x1621B1C28AC20BB5ULL },
+    { 0x1A25E249C51EEEE3ULL, 0x1BAA1E332D728EA3ULL },
+    { 0xF057AD6E1B33554DULL, 0x114A52DFFC679925ULL },
+    { 0x6C6D98C9A2002AA1ULL, 0x159CE797FB817F6FULL },
+    { 0x4788FEFC0A803549ULL, 0x1B04217DFA61DF4BULL },
+    { 0x0CB59F5D8690214EULL, 0x10E294EEBC7D2B8FULL },
+    { 0xCFE30734E83429A1ULL, 0x151B3A2A6B9C7672ULL },
+    { 0x83DBC9022241340AULL, 0x1A6208B50683940FULL },
+    { 0xB2695DA15568C086ULL, 0x107D457124123C89ULL },
+    { 0x1F03B509AAC2F0A7ULL, 0x149C96CD6D16CBACULL },
+    { 0x26C4A24C1573ACD1ULL, 0x19C3BC80C85C7E97ULL },
+    { 0x783AE56F8D684C03ULL, 0x101A55D07D39CF1EULL },
+    { 0x16499ECB70C25F03ULL, 0x1420EB449C8842E6ULL },
+    { 0x9BDC067E4CF2F6C4ULL, 0x19292615C3AA539FULL },
+    { 0x82D3081DE02FB476ULL, 0x1F736F9B3494E887ULL },
+    { 0xB1C3E512AC1DD0C9ULL, 0x13A825C100DD1154ULL },
+    { 0xDE34DE57572544FCULL, 0x18922F31411455A9ULL },
+    { 0x55C215ED2CEE963BULL, 0x1EB6BAFD91596B14ULL },
+    { 0xB5994DB43C151DE5ULL, 0x133234DE7AD7E2ECULL },
+    { 0xE2FFA1214B1A655EULL, 0x17FEC216198DDBA7ULL },
+    { 0xDBBF89699DE0FEB6ULL, 0x1DFE729B9FF15291ULL },
+    { 0x2957B5E202AC9F31ULL, 0x12BF07A143F6D39BULL },
+    { 0xF3ADA35A8357C6FEULL, 0x176EC98994F48881ULL },
+    { 0x70990C31242DB8BDULL, 0x1D4A7BEBFA31AAA2ULL },
+    { 0x865FA79EB69C9376ULL, 0x124E8D737C5F0AA5ULL },
+    { 0xE7F791866443B854ULL, 0x16E230D05B76CD4EULL },
+    { 0xA1F575E7FD54A669ULL, 0x1C9ABD04725480A2ULL },
+    { 0xA53969B0FE54E801ULL, 0x11E0B622C774D065ULL },
+    { 0x0E87C41D3DEA2202ULL, 0x1658E3AB7952047FULL },
+    { 0xD229B5248D64AA82ULL, 0x1BEF1C9657A6859EULL },
+    { 0x435A1136D85EEA91ULL, 0x117571DDF6C81383ULL },
+    { 0x143095848E76A536ULL, 0x15D2CE55747A1864ULL },
+    { 0x193CBAE5B2144E83ULL, 0x1B4781EAD1989E7DULL },
+    { 0x2FC5F4CF8F4CB112ULL, 0x110CB132C2FF630EULL },
+    { 0xBBB77203731FDD56ULL, 0x154FDD7F73BF3BD1ULL },
+    { 0x2AA54E844FE7D4ACULL, 0x1AA3D4DF50AF0AC6ULL },
+    { 0xDAA75112B1F0E4EBULL, 0x10A6650B926D66BBULL },
+    { 0xD15125575E6D1E26ULL, 0x14CFFE4E7708C06AULL },
+    { 0x85A56EAD360865B0ULL, 0x1A03FDE214CAF085ULL },
+    { 0x7387652C41C53F8EULL, 0x10427EAD4CFED653ULL },
+    { 0x50693E7752368F71ULL, 0x14531E58A03E8BE8ULL },
+    { 0x64838E1526C4334EULL, 0x1967E5EEC84E2EE2ULL },
+    { 0xFDA4719A70754022ULL, 0x1FC1DF6A7A61BA9AULL },
+    { 0xDE86C70086494815ULL, 0x13D92BA28C7D14A0ULL },
+    { 0x162878C0A7DB9A1AULL, 0x18CF768B2F9C59C9ULL },
+    { 0x5BB296F0D1D280A1ULL, 0x1F03542DFB83703BULL },
+    { 0x194F9E5683239064ULL, 0x1362149CBD322625ULL },
+    { 0x5FA385EC23EC747EULL, 0x183A99C3EC7EAFAEULL },
+    { 0xF78C67672CE7919DULL, 0x1E494034E79E5B99ULL },
+    { 0x3AB7C0A07C10BB02ULL, 0x12EDC82110C2F940ULL },
+    { 0x4965B0C89B14E9C3ULL, 0x17A93A2954F3B790ULL },
+    { 0x5BBF1CFAC1DA2433ULL, 0x1D9388B3AA30A574ULL },
+    { 0xB957721CB92856A0ULL, 0x127C35704A5E6768ULL },
+    { 0xE7AD4EA3E7726C48ULL, 0x171B42CC5CF60142ULL },
+    { 0xA198A24CE14F075AULL, 0x1CE2137F74338193ULL },
+    { 0x44FF65700CD16498ULL, 0x120D4C2FA8A030FCULL },
+    { 0x563F3ECC1005BDBEULL, 0x16909F3B92C83D3BULL },
+    { 0x2BCF0E7F14072D2EULL, 0x1C34C70A777A4C8AULL },
+    { 0x5B61690F6C847C3DULL, 0x11A0FC668AAC6FD6ULL },
+    { 0xF239C35347A59B4CULL, 0x16093B802D578BCBULL },
+    { 0xEEC83428198F021FULL, 0x1B8B8A6038AD6EBEULL },
+    { 0x553D20990FF96153ULL, 0x1137367C236C6537ULL },
+    { 0x2A8C68BF53F7B9A8ULL, 0x1585041B2C477E85ULL },
+    { 0x752F82EF28F5A812ULL, 0x1AE64521F7595E26ULL },
+    { 0x093DB1D57999890BULL, 0x10CFEB353A97DAD8ULL },
+    { 0x0B8D1E4AD7FFEB4EULL, 0x1503E602893DD18EULL },
+    { 0x8E7065DD8DFFE622ULL, 0x1A44DF832B8D45F1ULL },
+    { 0xF9063FAA78BFEFD5ULL, 0x106B0BB1FB384BB6ULL },
+    { 0xB747CF9516EFEBCAULL, 0x1485CE9E7A065EA4ULL },
+    { 0xE519C37A5CABE6BDULL, 0x19A742461887F64DULL },
+    { 0xAF301A2C79EB7036ULL, 0x1008896BCF54F9F0ULL },
+    { 0xDAFC20B798664C43ULL, 0x140AABC6C32A386CULL },
+    { 0x11BB28E57E7FDF54ULL, 0x190D56B873F4C688ULL },
+    { 0x1629F31EDE1FD72AULL, 0x1F50AC6690F1F82AULL },
+    { 0x4DDA37F34AD3E67AULL, 0x13926BC01A973B1AULL },
+    { 0xE150C5F01D88E019ULL, 0x187706B0213D09E0ULL },
+    { 0x19A4F76C24EB181FULL, 0x1E94C85C298C4C59ULL },
+    { 0xB0071AA39712EF13ULL, 0x131CFD3999F7AFB7ULL },
+    { 0x9C08E14C7CD7AAD8ULL, 0x17E43C8800759BA5ULL },
+    { 0x030B199F9C0D958EULL, 0x1DDD4BAA0093028FULL },
+    { 0x61E6F003C1887D79ULL, 0x12AA4F4A405BE199ULL },
+    { 0xBA60AC04B1EA9CD7ULL, 0x1754E31CD072D9FFULL },
+    { 0xA8F8D705DE65440DULL, 0x1D2A1BE4048F907FULL },
+    { 0xC99B8663AAFF4A88ULL, 0x123A516E82D9BA4FULL },
+    { 0xBC0267FC95BF1D2AULL, 0x16C8E5CA239028E3ULL },
+    { 0xAB0301FBBB2EE474ULL, 0x1C7B1F3CAC74331CULL },
+    { 0xEAE1E13D54FD4EC9ULL, 0x11CCF385EBC89FF1ULL },
+    { 0x659A598CAA3CA27BULL, 0x1640306766BAC7EEULL },
+    { 0xFF00EFEFD4CBCB1AULL, 0x1BD03C81406979E9ULL },
+    { 0x3F6095F5E4FF5EF0ULL, 0x116225D0C841EC32ULL },
+    { 0xCF38BB735E3F36ACULL, 0x15BAAF44FA52673EULL },
+    { 0x8306EA5035CF0457ULL, 0x1B295B1638E7010EULL },
+    { 0x11E4527221A162B6ULL, 0x10F9D8EDE39060A9ULL },
+    { 0x565D670EAA09BB64ULL, 0x15384F295C7478D3ULL },
+    { 0x2BF4C0D2548C2A3DULL, 0x1A8662F3B3919708ULL },
+    { 0x1B78F88374D79A66ULL, 0x1093FDD8503AFE65ULL },
+    { 0x625736A4520D8100ULL, 0x14B8FD4E6449BDFEULL },
+    { 0xFAED044D6690E140ULL, 0x19E73CA1FD5C2D7DULL },
+    { 0xBCD422B0601A8CC8ULL, 0x103085E53E599C6EULL },
+    { 0x6C092B5C78212FFAULL, 0x143CA75E8DF0038AULL },
+    { 0x070B763396297BF8ULL, 0x194BD136316C046DULL },
+    { 0x48CE53C07BB3DAF6ULL, 0x1F9EC583BDC70588ULL },
+    { 0x2D80F4584D5068DAULL, 0x13C33B72569C6375ULL },
+    { 0x78E1316E60A48310ULL, 0x18B40A4EEC437C52ULL }
+};
+
+// 2^k / 5^i + 1, normalized to 125 significant bits, for 0 <= i < 292
+static const uint64_t sstr_pow5_inv_split[292][2] =
+{
+    { 0x0000000000000001ULL, 0x2000000000000000ULL },
+    { 0x999999999999999AULL, 0x1999999999999999ULL },
+    { 0x47AE147AE147AE15ULL, 0x147AE147AE147AE1ULL },
+    { 0x6C8B4395810624DEULL, 0x10624DD2F1A9FBE7ULL },
+    { 0x7A786C226809D496ULL, 0x1A36E2EB1C432CA5ULL },
+    { 0x61F9F01B866E43ABULL, 0x14F8B588E368F084ULL },
+    { 0xB4C7F34938583622ULL, 0x10C6F7A0B5ED8D36ULL },
+    { 0x87A6520EC08D236AULL, 0x1AD7F29ABCAF4857ULL },
+    { 0x9FB841A566D74F88ULL, 0x15798EE2308C39DFULL },
+    { 0xE62D01511F12A607ULL, 0x112E0BE826D694B2ULL },
+    { 0xD6AE6881CB5109A4ULL, 0x1B7CDFD9D7BDBAB7ULL },
+    { 0xDEF1ED34A2A73AEAULL, 0x15FD7FE17964955FULL },
+    { 0x7F27F0F6E885C8BBULL, 0x119799812DEA1119ULL },
+    { 0x650CB4BE40D60DF8ULL, 0x1C25C268497681C2ULL },
+    { 0xEA70909833DE7193ULL, 0x16849B86A12B9B01ULL },
+    { 0x21F3A6E0297EC143ULL, 0x1203AF9EE756159BULL },
+    { 0x6985D7CD0F313537ULL, 0x1CD2B297D889BC2BULL },
+    { 0x2137DFD73F5A90F9ULL, 0x170EF54646D49689ULL },
+    { 0xE75FE645CC4873FAULL, 0x12725DD1D243ABA0ULL },
+    { 0xA5663D3C7A0D865DULL, 0x1D83C94FB6D2AC34ULL },
+    { 0x511E976394D79EB1ULL, 0x179CA10C9242235DULL },
+    { 0xDA7EDF82DD794BC1ULL, 0x12E3B40A0E9B4F7DULL },
+    { 0x2A6498D1625BAC68ULL, 0x1E392010175EE596ULL },
+    { 0xEEB6E0A781E2F053ULL, 0x182DB34012B25144ULL },
+    { 0x58924D52CE4F26A9ULL, 0x1357C299A88EA76AULL },
+    { 0x27507BB7B07EA441ULL, 0x1EF2D0F5DA7DD8AAULL },
+    { 0x52A6C95FC0655034ULL, 0x18C240C4AECB13BBULL },
+    { 0x0EEBD44C99EAA690ULL, 0x13CE9A36F23C0FC9ULL },
+    { 0xB17953ADC3110A80ULL, 0x1FB0F6BE50601941ULL },
+    { 0xC12DDC8B02740867ULL, 0x195A5EFEA6B34767ULL },
+    { 0x3424B06F3529A052ULL, 0x14484BFEEBC29F86ULL },
+    { 0x901D59F290EE19DBULL, 0x1039D66589687F9EULL },
+    { 0x4CFBC31DB4B0295FULL, 0x19F623D5A8A73297ULL },
+    { 0x3D9635B15D59BAB2ULL, 0x14C4E977BA1F5BACULL },
+    { 0x97AB5E277DE16228ULL, 0x109D8792FB4C4956ULL },
+    { 0xF2ABC9D8C9689D0DULL, 0x1A95A5B7F87A0EF0ULL },
+    { 0x5BBCA17A3ABA173EULL, 0x154484932D2E725AULL },
+    { 0xAFCA1AC82EFB45CBULL, 0x11039D428A8B8EAEULL },
+    { 0xB2DCF7A6B1920945ULL, 0x1B38FB9DAA78E44AULL },
+    { 0xF57D92EBC141A104ULL, 0x15C72FB1552D836EULL },
+    { 0xC46475896767B403ULL, 0x116C262777579C58ULL },
+    { 0x6D6D88DBD8A5ECD2ULL, 0x1BE03D0BF225C6F4ULL },
+    { 0x8ABE071646EB23DBULL, 0x164CFDA3281E38C3ULL },
+    { 0x6EFE6C11D255B649ULL, 0x11D7314F534B609CULL },
+    { 0xB197134FB6EF8A0EULL, 0x1C8B821885456760ULL },
+    { 0x27AC0F72F8BFA1A5ULL, 0x16D601AD376AB91AULL },
+    { 0xB95672C260994E1EULL, 0x1244CE242C5560E1ULL },
+    { 0xF5571E03CDC21695ULL, 0x1D3AE36D13BBCE35ULL },
+    { 0x2AAC18030B01ABABULL, 0x17624F8A762FD82BULL },
+    { 0xBBBCE0026F348956ULL, 0x12B50C6EC4F31355ULL },
+    { 0x92C7CCD0B1EDA889ULL, 0x1DEE7A4AD4B81EEFULL },
+    { 0xDBD30A408E57BA07ULL, 0x17F1FB6F10934BF2ULL },
+    { 0x7CA8D50071DFC806ULL, 0x1327FC58DA0F6FF5ULL },
+    { 0xFAA7BB33E9660CD6ULL, 0x1EA6608E29B24CBBULL },
+    { 0x9552FC298784D711ULL, 0x18851A0B548EA3C9ULL },
+    { 0xAAA8C9BAD2D0AC0EULL, 0x139DAE6F76D88307ULL },
+    { 0xDDDADC5E1E1AACE3ULL, 0x1F62B0B257C0D1A5ULL },
+    { 0x7E48B04B4B488A4FULL, 0x191BC08EAC9A4151ULL },
+    { 0xCB6D59D5D5D3A1D9ULL, 0x141633A556E1CDDAULL },
+    { 0x3C577B1177DC817BULL, 0x1011C2EAABE7D7E2ULL },
+    { 0xC6F25E825960CF2AULL, 0x19B604AAACA62636ULL },
+    { 0x6BF518684780A5BBULL, 0x14919D5556EB51C5ULL },
+    { 0x232A79ED06008496ULL, 0x10747DDDDF22A7D1ULL },
+    { 0xD1DD8FE1A3340756ULL, 0x1A53FC9631D10C81ULL },
+    { 0xA7E4731AE8F66C45ULL, 0x150FFD44F4A73D34ULL },
+    { 0x531D28E253F8569EULL, 0x10D9976A5D52975DULL },
+    { 0xEB61DB03B98D5762ULL, 0x1AF5BF109550F22EULL },
+    { 0xBC4E48CFC7A445E8ULL, 0x159165A6DDDA5B58ULL },
+    { 0x6371D3D96C836B20ULL, 0x11411E1F17E1E2ADULL },
+    { 0x9F1C8628AD9F11CDULL, 0x1B9B6364F3030448ULL },
+    { 0xE5B06B53BE18DB0BULL, 0x1615E91D8F359D06ULL },
+    { 0xEAF3890FCB4715A2ULL, 0x11AB20E472914A6BULL },
+    { 0x44B8DB4C7871BC37ULL, 0x1C45016D841BAA46ULL },
+    { 0x03C715D6C6C1635FULL, 0x169D9ABE03495505ULL },
+    { 0x3638DE456BCDE919ULL, 0x1217AEFE69077737ULL },
+    { 0x56C163A2461641C1ULL, 0x1CF2B1970E725858ULL },
+    { 0xDF011C81D1AB67CEULL, 0x17288E1271F51379ULL },
+    { 0x7F3416CE4155ECA5ULL, 0x1286D80EC190DC61ULL },
+    { 0x6520247D3556476EULL, 0x1DA48CE468E7C702ULL },
+    { 0xEA801D30F7783925ULL, 0x17B6D71D20B96C01ULL },
+    { 0xBB99B0F3F92CFA84ULL, 0x12F8AC174D612334ULL },
+    { 0x5F5C4E532847F739ULL, 0x1E5AACF215683854ULL },
+    { 0x7F7D0B75B9D32C2EULL, 0x18488A5B44536043ULL },
+    { 0x9930D5F7C7DC2358ULL, 0x136D3B7C36A919CFULL },
+    { 0x8EB4898C72F9D226ULL, 0x1F152BF9F10E8FB2ULL },
+    { 0x722A07A38F2E41B8ULL, 0x18DDBCC7F40BA628ULL },
+    { 0xC1BB394FA5BE9AFAULL, 0x13E497065CD61E86ULL },
+    { 0x9C5EC2190930F7F6ULL, 0x1FD424D6FAF030D7ULL },
+    { 0x49E56814075A5FF8ULL, 0x197683DF2F268D79ULL },
+    { 0x6E51201005E1E660ULL, 0x145ECFE5BF520AC7ULL },
+    { 0xF1DA800CD181851AULL, 0x104BD984990E6F05ULL },
+    { 0x4FC400148268D4F5ULL, 0x1A12F5A0F4E3E4D6ULL },
+    { 0xD96999AA01ED772BULL, 0x14DBF7B3F71CB711ULL },
+    { 0xADEE1488018AC5BCULL, 0x10AFF95CC5B09274ULL },
+    { 0x497CEDA668DE092CULL, 0x1AB328946F80EA54ULL },
+    { 0x3ACA57B853E4D424ULL, 0x155C2076BF9A5510ULL },
+    { 0x623B7960431D7683ULL, 0x1116805EFFAEAA73ULL },
+    { 0x9D2BF566D1C8BD9EULL, 0x1B5733CB32B110B8ULL },
+    { 0x7DBCC452416D647FULL, 0x15DF5CA28EF40D60ULL },
+    { 0xCAFD69DB678AB6CCULL, 0x117F7D4ED8C33DE6ULL },
+    { 0xAB2F0FC572778ADFULL, 0x1BFF2EE48E052FD7ULL },
+    { 0x88F273045B92D580ULL, 0x1665BF1D3E6A8CACULL },
+    { 0xD3F528D049424466ULL, 0x11EAFF4A98553D56ULL },
+    { 0xB988414D4203A0A3ULL, 0x1CAB3210F3BB9557ULL },
+    { 0x6139CDD76802E6E9ULL, 0x16EF5B40C2FC7779ULL },
+    { 0xE761717920025254ULL, 0x125915CD68C9F92DULL },
+    { 0xA568B58E999D5086ULL, 0x1D5B561574765B7CULL },
+    { 0x5120913EE14AA6D2ULL, 0x177C44DDF6C515FDULL },
+    { 0xA74D40FF1AA21F0EULL, 0x12C9D0B1923744CAULL },
+    { 0x0BAECE64F769CB4AULL, 0x1E0FB44F50586E11ULL },
+    { 0x3C8BD850C5EE3C3BULL, 0x180C903F7379F1A7ULL },
+    { 0xCA0979DA37F1C9C9ULL, 0x133D4032C2C7F485ULL },
+    { 0xA9A8C2F6BFE942DBULL, 0x1EC866B79E0CBA6FULL },
+    { 0x2153CF2BCCBA9BE3ULL, 0x18A0522C7E709526ULL },
+    { 0x1AA9728970954982ULL, 0x13B374F06526DDB8ULL },
+    { 0xF775840F1A88759DULL, 0x1F8587E7083E2F8CULL },
+    { 0x5F9136727BA05E17ULL, 0x19379FEC0698260AULL },
+    { 0x1940F85B9619E4DFULL, 0x142C7FF0054684D5ULL },
+    { 0xE100C6AFAB47EA4CULL, 0x1023998CD1053710ULL },
+    { 0xCE67A44C453FDD47ULL, 0x19D28F47B4D524E7ULL },
+    { 0xD852E9D69DCCB106ULL, 0x14A8729FC3DDB71FULL },
+    { 0x79DBEE454B0A2738ULL, 0x1086C219697E2C19ULL },
+    { 0x295FE3A211A9D859ULL, 0x1A71368F0F30468FULL },
+    { 0xBAB31C81A7BB137AULL, 0x15275ED8D8F36BA5ULL },
+    { 0x6228E39AEC95A92FULL, 0x10EC4BE0AD8F8951ULL },
+    { 0x9D0E38F7E0EF7517ULL, 0x1B13AC9AAF4C0EE8ULL },
+    { 0xB0D82D931A592A79ULL, 0x15A956E225D67253ULL },
+    { 0x8D79BE0F4847552EULL, 0x11544581B7DEC1DCULL },
+    { 0x158F967EDA0BBB7CULL, 0x1BBA08CF8C979C94ULL },
+    { 0x77A611FF14D62F97ULL, 0x162E6D72D6DFB076ULL },
+    { 0xF951A7FF43DE8C79ULL, 0x11BEBDF578B2F391ULL },
+    { 0xC21C3FFED2FDAD8EULL, 0x1C6463225AB7EC1CULL },
+    { 0x01B0333242648AD8ULL, 0x16B6B5B5155FF017ULL },
+    { 0x0159C28E9B83A246ULL, 0x122BC490DDE659ACULL },
+    { 0xCEF604175F3903A3ULL, 0x1D12D41AFCA3C2ACULL },
+    { 0x725E69AC4C2D9C83ULL, 0x17424348CA1C9BBDULL },
+    { 0xF5185489D68AE39CULL, 0x129B69070816E2FDULL },
+    { 0xEE8D540FBDAB05C6ULL, 0x1DC574D80CF16B2FULL },
+    { 0xBED77672FE226B05ULL, 0x17D12A4670C1228CULL },
+    { 0xFF12C528CB4EBC04ULL, 0x130DBB6B8D674ED6ULL },
+    { 0xCB513B74787DF9A0ULL, 0x1E7C5F127BD87E24ULL },
+    { 0x090DC929F9FE614DULL, 0x18637F41FCAD31B7ULL },
+    { 0xA0D7D42194CB810AULL, 0x1382CC34CA2427C5ULL },
+    { 0x67BFB9CF5478CE77ULL, 0x1F37AD21436D0C6FULL },
+    { 0x1FCC94A5DD2D71F9ULL, 0x18F9574DCF8A7059ULL },
+    { 0x7FD6DD517DBDF4C7ULL, 0x13FAAC3E3FA1F37AULL },
+    { 0xFFBE2EE8C92FEE0BULL, 0x1FF779FD329CB8C3ULL },
+    { 0x6631BF20A0F324D6ULL, 0x1992C7FDC216FA36ULL },
+    { 0xB827CC1A1A5C1D78ULL, 0x14756CCB01ABFB5EULL },
+    { 0x935309AE7B7CE460ULL, 0x105DF0A267BCC918ULL },
+    { 0x1EEB42B0C594A099ULL, 0x1A2FE76A3F9474F4ULL },
+    { 0xE58902270476E6E1ULL, 0x14F31F8832DD2A5CULL },
+    { 0xB7A0CE859D2BEBE7ULL, 0x10C27FA028B0EEB0ULL },
+    { 0x59014A6F61DFDFD8ULL, 0x1AD0CC33744E4AB4ULL },
+    { 0xE0CDD525E7E64CADULL, 0x1573D68F903EA229ULL },
+    { 0x4D7177518651D6F1ULL, 0x11297872D9CBB4EEULL },
+    { 0x7BE8BEE8D6E957E8ULL, 0x1B758D848FAC54B0ULL },
+    { 0xFCBA3253DF211320ULL, 0x15F7A46A0C89DD59ULL },
+    { 0x63C8284318E74280ULL, 0x1192E9EE706E4AAEULL },
+    { 0x060D0D3827D86A66ULL, 0x1C1E43171A4A1117ULL },
+    { 0x6B3DA42CECAD21EBULL, 0x167E9C127B6E7412ULL },
+    { 0x88FE1CF0BD574E56ULL, 0x11FEE341FC585CDBULL },
+    { 0x419694B462254A23ULL, 0x1CCB0536608D615FULL },
+    { 0x67ABAA29E81DD4E9ULL, 0x1708D0F84D3DE77FULL },
+    { 0xB95621BB2017DD87ULL, 0x126D73F9D764B932ULL },
+    { 0xC223692B668C95A5ULL, 0x1D7BECC2F23AC1EAULL },
+    { 0xCE82BA891ED6DE1DULL, 0x179657025B6234BBULL },
+    { 0xA53562074BDF1818ULL, 0x12DEAC01E2B4F6FCULL },
+    { 0x3B889CD87964F359ULL, 0x1E3113363787F194ULL },
+    { 0xFC6D4A46C783F5E1ULL, 0x18274291C6065ADCULL },
+    { 0x30576E9F06032B1AULL, 0x13529BA7D19EAF17ULL },
+    { 0x1A257DCB3CD1DE90ULL, 0x1EEA92A61C311825ULL },
+    { 0x481DFE3C30A7E540ULL, 0x18BBA884E35A79B7ULL },
+    { 0xD34B31C9C0865100ULL, 0x13C9539D82AEC7C5ULL },
+    { 0x5211E942CDA3B4CDULL, 0x1FA885C8D117A609ULL },
+    { 0x74DB21023E1C90A4ULL, 0x19539E3A40DFB807ULL },
+    { 0xF715B401CB4A0D50ULL, 0x1442E4FB67196005ULL },
+    { 0xF8DE299B09080AA7ULL, 0x103583FC527AB337ULL },
+    { 0x8E304291A80CDDD7ULL, 0x19EF3993B72AB859ULL },
+    { 0x3E8D020E200A4B13ULL, 0x14BF6142F8EEF9E1ULL },
+    { 0x653D9B3E80083C0FULL, 0x10991A9BFA58C7E7ULL },
+    { 0x6EC8F864000D2CE4ULL, 0x1A8E90F9908E0CA5ULL },
+    { 0x8BD3F9E999A423EAULL, 0x153EDA614071A3B7ULL },
+    { 0x3CA994BAE1501CBBULL, 0x10FF151A99F482F9ULL },
+    { 0xC775BAC49BB3612BULL, 0x1B31BB5DC320D18EULL },
+    { 0xD2C4956A16291A89ULL, 0x15C162B168E70E0BULL },
+    { 0xDBD0778811BA7BA1ULL, 0x11678227871F3E6FULL },
+    { 0x2C80BF401C5D929BULL, 0x1BD8D03F3E9863E6ULL },
+    { 0xBD33CC3349E47549ULL, 0x16470CFF6546B651ULL },
+    { 0xCA8FD68F6E505DD4ULL, 0x11D270CC51055EA7ULL },
+    { 0x4419574BE3B3C953ULL, 0x1C83E7AD4E6EFDD9ULL },
+    { 0x0347790982F63AA9ULL, 0x16CFEC8AA52597E1ULL },
+    { 0xCF6C60D468C4FBBAULL, 0x123FF06EEA847980ULL },
+    { 0xE57A34870E07F92AULL, 0x1D331A4B10D3F59AULL },
+    { 0x512E906C0B399422ULL, 0x175C1508DA432AE2ULL },
+    { 0xDA8BA6BCD5C7A9B5ULL, 0x12B010D3E1CF5581ULL },
+    { 0x90DF712E22D90F87ULL, 0x1DE6815302E5559CULL },
+    { 0xDA4C5A8B4F140C6CULL, 0x17EB9AA8CF1DDE16ULL },
+    { 0xAEA37BA2A5A9A38AULL, 0x1322E220A5B17E78ULL },
+    { 0x7DD25F6AA2A905A9ULL, 0x1E9E369AA2B59727ULL },
+    { 0x97DB7F888220D154ULL, 0x187E92154EF7AC1FULL },
+    { 0x797C6606CE80A777ULL, 0x139874DDD8C6234CULL },
+    { 0x8F2D700AE4010BF1ULL, 0x1F5A549627A36BADULL },
+    { 0x0C2459A25000D65AULL, 0x191510781FB5EFBEULL },
+    { 0x701D1481D99A4515ULL, 0x1410D9F9B2F7F2FEULL },
+    { 0xC017439B147B6A77ULL, 0x100D7B2E28C65BFEULL },
+    { 0xCCF205C4ED9243F2ULL, 0x19AF2B7D0E0A2CCAULL },
+    { 0x0A5B37D0BE0E9CC2ULL, 0x148C22CA71A1BD6FULL },
+    { 0x0848F973CB3EE3CEULL, 0x10701BD527B4978CULL },
+    { 0xDA0E5BEC78649FB0ULL, 0x1A4CF9550C5425ACULL },
+    { 0x7B3EAFF060507FC0ULL, 0x150A6110D6A9B7BDULL },
+    { 0x95CBBFF380406633ULL, 0x10D51A73DEEE2C97ULL },
+    { 0xEFAC665266CD7052ULL, 0x1AEE90B964B04758ULL },
+    { 0x2623850EB8A459DBULL, 0x158BA6FAB6F36C47ULL },
+    { 0x1E82D0D893B6AE49ULL, 0x113C85955F29236CULL },
+    { 0xFD9E1AF41F8AB075ULL, 0x1B9408EEFEA838ACULL },
+    { 0x97B1AF29B2D559F7ULL, 0x16100725988693BDULL },
+    { 0xAC8E25BAF5777B2CULL, 0x11A66C1E139EDC97ULL },
+    { 0x7A7D092B2258C513ULL, 0x1C3D79C9B8FE2DBFULL },
+    { 0x61FDA0EF4EAD6A76ULL, 0x169794A160CB57CCULL },
+    { 0xE7FE1A590BBDEEC5ULL, 0x1212DD4DE7091309ULL },
+    { 0xA6635D5B45FCB13AULL, 0x1CEAFBAFD80E84DCULL },
+    { 0x851C4AAF6B308DC8ULL, 0x172262F3133ED0B0ULL },
+    { 0xD0E36EF2BC26D7D4ULL, 0x1281E8C275CBDA26ULL },
+    { 0xB49F17EAC6A48C86ULL, 0x1D9CA79D894629D7ULL },
+    { 0x2A18DFEF0550706BULL, 0x17B08617A104EE46ULL },
+    { 0x54E0B3259DD9F389ULL, 0x12F39E794D9D8B6BULL },
+    { 0x87CDEB6F62F65274ULL, 0x1E5297287C2F4578ULL },
+    { 0xD30B22BF825EA85DULL, 0x18421286C9BF6AC6ULL },
+    { 0x0F3C1BCC684BB9E4ULL, 0x13680ED23AFF889FULL },
+    { 0x18602C7A4079296DULL, 0x1F0CE4839198DA98ULL },
+    { 0x46B356C833942124ULL, 0x18D71D360E13E213ULL },
+    { 0x388F78A029434DB6ULL, 0x13DF4A91A4DCB4DCULL },
+    { 0x5A7F2766A86BAF8AULL, 0x1FCBAA82A1612160ULL },
+    { 0x153285EBB9EFBFA2ULL, 0x196FBB9BB44DB44DULL },
+    { 0xAA8ED189618C994EULL, 0x145962E2F6A4903DULL },
+    { 0xEED8A7A11AD6E10CULL, 0x1047824F2BB6D9CAULL },
+    { 0x7E27729B5E249B45ULL, 0x1A0C03B1DF8AF611ULL },
+    { 0xFE85F549181D4904ULL, 0x14D6695B193BF80DULL },
+    { 0xCB9E5DD4134AA0D0ULL, 0x10AB877C142FF9A4ULL },
+    { 0xDF63C9535211014DULL, 0x1AAC0BF9B9E65C3AULL },
+    { 0x191CA10F74DA6771ULL, 0x15566FFAFB1EB02FULL },
+    { 0xADB080D92A4852C1ULL, 0x1111F32F2F4BC025ULL },
+    { 0x15E7348EAA0D5134ULL, 0x1B4FEB7EB212CD09ULL },
+    { 0xAB1F5D3EEE710DC4ULL, 0x15D98932280F0A6DULL },
+    { 0xBC1917658B8DA49DULL, 0x117AD428200C0857ULL },
+    { 0x2CF4F23C127C3A94ULL, 0x1BF7B9D9CCE00D59ULL },
+    { 0xF0C3F4FCDB969543ULL, 0x165FC7E170B33DE0ULL },
+    { 0x5A365D9716121103ULL, 0x11E6398126F5CB1AULL },
+    { 0x9056FC24F01CE804ULL, 0x1CA38F350B22DE90ULL },
+    { 0xD9DF301D8CE3ECD0ULL, 0x16E93F5DA2824BA6ULL },
+    { 0xE17F59B13D8323DAULL, 0x125432B14ECEA2EBULL },
+    { 0x68CBC2B52F38395CULL, 0x1D53844EE47DD179ULL },
+    { 0x53D6355DBF602DE3ULL, 0x177603725064A794ULL },
+    { 0xA9782AB165E68B1CULL, 0x12C4CF8EA6B6EC76ULL },
+    { 0x0F26AAB56FD744FAULL, 0x1E07B27DD78B13F1ULL },
+    { 0x3F52222ABFDF6A62ULL, 0x18062864AC6F4327ULL },
+    { 0x65DB4E88997F884EULL, 0x1338205089F29C1FULL },
+    { 0x6FC54A7428CC0D4AULL, 0x1EC033B40FEA9365ULL },
+    { 0x596AA1F68709A43BULL, 0x1899C2F673220F84ULL },
+    { 0xADEEE7F86C07B696ULL, 0x13AE3591F5B4D936ULL },
+    { 0x497E3FF3E00C5756ULL, 0x1F7D228322BAF524ULL },
+    { 0xD464FFF64CD6AC45ULL, 0x1930E868E89590E9ULL },
+    { 0x4383FFF83D7889D1ULL, 0x14272053ED4473EEULL },
+    { 0xCF9CCCC69793A174ULL, 0x101F4D0FF1038FF1ULL },
+    { 0x7F6147A425B90252ULL, 0x19CBAE7FE805B31CULL },
+    { 0xCC4DD2E9B7C7350FULL, 0x14A2F1FFECD15C16ULL },
+    { 0x3D0B0F215FD290D9ULL, 0x10825B3323DAB012ULL },
+    { 0x61AB4B689950E7C1ULL, 0x1A6A2B85062AB350ULL },
+    { 0x4E22A2BA1440B967ULL, 0x1521BC6A6B555C40ULL },
+    { 0x0B4EE894DD009453ULL, 0x10E7C9EEBC4449CDULL },
+    { 0x1217DA87C800ED51ULL, 0x1B0C764AC6D3A948ULL },
+    { 0xDB46486CA000BDDAULL, 0x15A391D56BDC876CULL },
+    { 0x490506BD4CCD64AFULL, 0x114FA7DDEFE39F8AULL },
+    { 0xA8080AC87AE23AB1ULL, 0x1BB2A62FE638FF43ULL },
+    { 0x5339A239FBE82EF4ULL, 0x162884F31E93FF69ULL },
+    { 0x75C7B4FB2FECF25DULL, 0x11BA03F5B20FFF87ULL },
+    { 0x22D92191E647EA2EULL, 0x1C5CD322B67FFF3FULL },
+    { 0xB57A8141850654F2ULL, 0x16B0A8E891FFFF65ULL },
+    { 0xC4620101373843F5ULL, 0x1226ED86DB3332B7ULL },
+    { 0x3A366801F1F39FEEULL, 0x1D0B15A491EB8459ULL },
+    { 0xFB5EB99B27F6198BULL, 0x173C115074BC69E0ULL },
+    { 0x2F7EFAE2865E7AD6ULL, 0x129674405D6387E7ULL },
+    { 0xE597F7D0D6FD9156ULL, 0x1DBD86CD6238D971ULL },
+    { 0x8479930D78CADAABULL, 0x17CAD23DE82D7AC1ULL },
+    { 0xD06142712D6F1556ULL, 0x1308A831868AC89AULL },
+    { 0x4D686A4EAF182222ULL, 0x1E74404F3DAADA91ULL },
+    { 0xA453883EF279B4E8ULL, 0x185D003F6488AEDAULL },
+    { 0xE9DC6CFF28615D87ULL, 0x137D99CC506D58AEULL },
+    { 0xA960AE650D6895A4ULL, 0x1F2F5C7A1A488DE4ULL },
+    { 0xBAB3BEB73DED4483ULL, 0x18F2B061AEA07183ULL },
+    { 0x2EF6322C318A9D36ULL, 0x13F559E7BEE6C136ULL }
+};
+
+static uint32_t sstr_pow5bits(
+    int32_t exp
+)
+{
+    // ceil(log2(5^exp)) for 0 <= exp <= 3528
+    return (uint32_t) (((exp * 1217359) >> 19) + 1);
+}
+
+
+static uint32_t sstr_log10pow2(
+    int32_t exp
+)
+{
+    // floor(log10(2^exp)) for 0 <= exp <= 1650
+    return (uint32_t) ((exp * 78913) >> 18);
+}
+
+
+static uint32_t sstr_log10pow5(
+    int32_t exp
+)
+{
+    // floor(log10(5^exp)) for 0 <= exp <= 2620
+    return (uint32_t) ((exp * 732923) >> 20);
+}
+
+
+static int sstr_multiple_of_pow5(
+    uint64_t value,
+    uint32_t pow5
+)
+{
+    // value is never zero
+    uint32_t count = 0;
+    while (value % 5 == 0)
+    {
+        value /= 5;
+        ++count;
+    }
+
+    return count >= pow5;
+}
+
+
+static int sstr_multiple_of_pow2(
+    uint64_t value,
+    uint32_t pow2
+)
+{
+    return (value & ((((uint64_t) 1) << pow2) - 1)) == 0;
+}
+
+
+#if defined(__SIZEOF_INT128__)
+__extension__ typedef unsigned __int128 sstr_uint128;
+
+/**
+ * 64 x 64 -> 128 bit multiplication
+ */
+static uint64_t sstr_umul128(
+    uint64_t factor_a,
+    uint64_t factor_b,
+    uint64_t *prod_high
+)
+{
+    sstr_uint128 product = (sstr_uint128) factor_a * factor_b;
+    (*prod_high) = (uint64_t) (product >> 64);
+    return (uint64_t) product;
+}
+
+
+/**
+ * (value * mul) >> shift, where mul is a 128 bit number and 64 < shift
+ */
+static uint64_t sstr_mulshift64(
+    uint64_t       value,
+    const uint64_t *mul,
+    int32_t        shift
+)
+{
+    sstr_uint128 prod_low  = (sstr_uint128) value * mul[0];
+    sstr_uint128 prod_high = (sstr_uint128) value * mul[1];
+    return (uint64_t) (((prod_low >> 64) + prod_high) >> (shift - 64));
+}
+#else
+/**
+ * 64 x 64 -> 128 bit multiplication
+ */
+static uint64_t sstr_umul128(
+    uint64_t factor_a,
+    uint64_t factor_b,
+    uint64_t *prod_high
+)
+{
+    uint64_t a_low  = (uint32_t) factor_a;
+    uint64_t a_high = factor_a >> 32;
+    uint64_t b_low  = (uint32_t) factor_b;
+    uint64_t b_high = factor_b >> 32;
+
+    uint64_t b00 = a_low  * b_low;
+    uint64_t b01 = a_low  * b_high;
+    uint64_t b10 = a_high * b_low;
+    uint64_t b11 = a_high * b_high;
+
+    uint64_t mid1 = b10 + (b00 >> 32);
+    uint64_t mid2 = b01 + (uint32_t) mid1;
+
+    (*prod_high) = b11 + (mid1 >> 32) + (mid2 >> 32);
+    return (mid2 << 32) | (uint32_t) b00;
+}
+
+
+/**
+ * (value * mul) >> shift, where mul is a 128 bit number and 64 < shift
+ */
+static uint64_t sstr_mulshift64(
+    uint64_t       value,
+    const uint64_t *mul,
+    int32_t        shift
+)
+{
+    uint64_t high0;
+    uint64_t high1;
+    sstr_umul128(value, mul[0], &high0);
+    uint64_t low1 = sstr_umul128(value, mul[1], &high1);
+
+    uint64_t sum = high0 + low1;
+    if (sum < high0)
+    {
+        ++high1;
+    }
+
+    unsigned int dist = (unsigned int) (shift - 64);
+    return (high1 << (64 - dist)) | (sum >> dist);
+}
+#endif /* __SIZEOF_INT128__ */
+
+
+/**
+ * Convert a finite, non-zero double given as its IEEE 754 mantissa and
+ * exponent fields into the shortest decimal digits and a power of 10
+ */
+static void sstr_ryu_d2d(
+    uint64_t ieee_mantissa,
+    uint32_t ieee_exponent,
+    uint64_t *dst_digits,
+    int32_t  *dst_exp10
+)
+{
+    int32_t  e2;
+    uint64_t m2;
+    if (ieee_exponent == 0)
+    {
+        e2 = 1 - SSTR_DOUBLE_BIAS - SSTR_DOUBLE_MANTISSA_BITS - 2;
+        m2 = ieee_mantissa;
+    }
+    else
+    {
+        e2 = (int32_t) ieee_exponent - SSTR_DOUBLE_BIAS - SSTR_DOUBLE_MANTISSA_BITS - 2;
+        m2 = (((uint64_t) 1) << SSTR_DOUBLE_MANTISSA_BITS) | ieee_mantissa;
+    }
+    int accept_bounds = (m2 & 1) == 0;
+
+    // the interval of decimal values that round to the double
+    // is (mm * 2^e2, mp * 2^e2), with mv * 2^e2 being the double
+    uint64_t mv       = 4 * m2;
+    uint32_t mm_shift = (ieee_mantissa != 0 || ieee_exponent <= 1) ? 1 : 0;
+
+    uint64_t vr;
+    uint64_t vp;
+    uint64_t vm;
+    int32_t  e10;
+    int      vm_trailing_zeros = 0;
+    int      vr_trailing_zeros = 0;
+
+    if (e2 >= 0)
+    {
+        uint32_t q = sstr_log10pow2(e2) - (e2 > 3 ? 1 : 0);
+        e10 = (int32_t) q;
+        int32_t k = SSTR_POW5_INV_BITCOUNT + (int32_t) sstr_pow5bits((int32_t) q) - 1;
+        int32_t i = -e2 + (int32_t) q + k;
+
+        vr = sstr_mulshift64(4 * m2, sstr_pow5_inv_split[q], i);
+        vp = sstr_mulshift64(4 * m2 + 2, sstr_pow5_inv_split[q], i);
+        vm = sstr_mulshift64(4 * m2 - 1 - mm_shift, sstr_pow5_inv_split[q], i);
+
+        if (q <= 21)
+        {
+            // only one of mp, mv and mm can be a multiple of 5, if any
+            if (mv % 5 == 0)
+            {
+                vr_trailing_zeros = sstr_multiple_of_pow5(mv, q);
+            }
+            else
+            if (accept_bounds)
+            {
+                vm_trailing_zeros = sstr_multiple_of_pow5(mv - 1 - mm_shift, q);
+            }
+            else
+            {
+                vp -= (uint64_t) sstr_multiple_of_pow5(mv + 2, q);
+            }
+        }
+    }
+    else
+    {
+        uint32_t q = sstr_log10pow5(-e2) - (-e2 > 1 ? 1 : 0);
+        e10 = (int32_t) q + e2;
+        int32_t i = -e2 - (int32_t) q;
+        int32_t k = (int32_t) sstr_pow5bits(i) - SSTR_POW5_BITCOUNT;
+        int32_t j = (int32_t) q - k;
+
+        vr = sstr_mulshift64(4 * m2, sstr_pow5_split[i], j);
+        vp = sstr_mulshift64(4 * m2 + 2, sstr_pow5_split[i], j);
+        vm = sstr_mulshift64(4 * m2 - 1 - mm_shift, sstr_pow5_split[i], j);
+
+        if (q <= 1)
+        {
+            // mv has at least q trailing zero bits
+            vr_trailing_zeros = 1;
+            if (accept_bounds)
+            {
+                vm_trailing_zeros = mm_shift == 1;
+            }
+            else
+            {
+                --vp;
+            }
+        }
+        else
+        if (q < 63)
+        {
+            vr_trailing_zeros = sstr_multiple_of_pow2(mv, q);
+        }
+    }
+
+    // remove digits while the interval still contains a shorter number
+    int32_t  removed         = 0;
+    uint32_t last_removed    = 0;
+    uint64_t output;
+
+    if (vm_trailing_zeros || vr_trailing_zeros)
+    {
+        while (vp / 10 > vm / 10)
+        {
+            vm_trailing_zeros &= vm % 10 == 0;
+            vr_trailing_zeros &= last_removed == 0;
+            last_removed = (uint32_t) (vr % 10);
+            vr /= 10;
+            vp /= 10;
+            vm /= 10;
+            ++removed;
+        }
+        if (vm_trailing_zeros)
+        {
+            while (vm % 10 == 0)
+            {
+                vr_trailing_zeros &= last_removed == 0;
+                last_removed = (uint32_t) (vr % 10);
+                vr /= 10;
+                vp /= 10;
+                vm /= 10;
+                ++removed;
+            }
+        }
+        if (vr_trailing_zeros && last_removed == 5 && vr % 2 == 0)
+        {
+            // exactly halfway: round to even
+            last_removed = 4;
+        }
+        output = vr + (((vr == vm && (!accept_bounds || !vm_trailing_zeros)) ||
+                        last_removed >= 5) ? 1 : 0);
+    }
+    else
+    {
+        // common case: no trailing zeros to track
+        int round_up = 0;
+        while (vp / 10 > vm / 10)
+        {
+            round_up = vr % 10 >= 5;
+            vr /= 10;
+            vp /= 10;
+            vm /= 10;
+            ++removed;
+        }
+        output = vr + ((vr == vm || round_up) ? 1 : 0);
+    }
+
+    (*dst_digits) = output;
+    (*dst_exp10)  = e10 + removed;
+}
+
+
+/*
+ * Number parsing
+ *
+ * Digits are converted 16 at a time with SSE2 and 8 at a time with
+ * SWAR arithmetic on a 64 bit word, the remainder one at a time.
+ */
+
+#if defined(__BYTE_ORDER__) && defined(__ORDER_LITTLE_ENDIAN__)
+    #if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+        #define SSTR_SWAR_DIGITS
+    #endif
+#endif
+
+#ifdef __SSE2__
+/**
+ * Convert 16 decimal digits
+ *
+ * Returns 0 if any of the 16 chars is not a digit
+ */
+static int sstr_parse_16digits(
+    const char *src_chars,
+    uint64_t   *dst_value
+)
+{
+    int digits_ok = 0;
+
+    __m128i digits = _mm_sub_epi8(_mm_loadu_si128((const __m128i *) src_chars),
+                                  _mm_set1_epi8('0'));
+    // chars other than '0' to '9' are negative or above 9 after
+    // the subtraction when interpreted as signed bytes
+    __m128i invalid = _mm_or_si128(_mm_cmplt_epi8(digits, _mm_setzero_si128()),
+                                   _mm_cmpgt_epi8(digits, _mm_set1_epi8(9)));
+    if (_mm_movemask_epi8(invalid) == 0)
+    {
+        // combine neighbours: 16 digits -> 8 x 2 digits -> 4 x 4 digits
+        // -> 2 x 8 digits; the first char is the most significant digit
+        __m128i zero  = _mm_setzero_si128();
+        __m128i mul10 = _mm_set_epi16(1, 10, 1, 10, 1, 10, 1, 10);
+        __m128i pairs = _mm_packs_epi32(
+            _mm_madd_epi16(_mm_unpacklo_epi8(digits, zero), mul10),
+            _mm_madd_epi16(_mm_unpackhi_epi8(digits, zero), mul10)
+        );
+        __m128i quads = _mm_madd_epi16(pairs, _mm_set_epi16(1, 100, 1, 100, 1, 100, 1, 100));
+        quads = _mm_packs_epi32(quads, quads);
+        __m128i octets = _mm_madd_epi16(quads, _mm_set_epi16(1, 10000, 1, 10000, 1, 10000, 1, 10000));
+
+        uint64_t high = (uint32_t) _mm_cvtsi128_si32(octets);
+        uint64_t low  = (uint32_t) _mm_cvtsi128_si32(_mm_srli_si128(octets, 4));
+        (*dst_value) = high * 100000000 + low;
+        digits_ok = 1;
+    }
+
+    return digits_ok;
+}
+#endif /* __SSE2__ */
+
+
+#ifdef SSTR_SWAR_DIGITS
+/**
+ * Check whether all 8 chars in a little endian word are decimal digits
+ */
+static int sstr_is_8digits(
+    uint64_t word
+)
+{
+    // the high nibble of each byte must be 3, and adding 6 to the
+    // low nibble must not carry into the high nibble
+    return (((word & 0xF0F0F0F0F0F0F0F0ULL) |
+             (((word + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4)) ==
+            0x3333333333333333ULL);
+}
+
+
+/**
+ * Convert 8 decimal digits in a little endian word
+ */
+static uint64_t sstr_parse_8digits(
+    uint64_t word
+)
+{
+    word -= 0x3030303030303030ULL;
+    // combine neighbouring digits, then pairs, then groups of four
+    word = (word * 10) + (word >> 8);
+    word = (((word & 0x000000FF000000FFULL) * (100 + (1000000ULL << 32))) +
+            (((word >> 16) & 0x000000FF000000FFULL) * (1 + (10000ULL << 32)))) >> 32;
+    return word;
+}
+#endif /* SSTR_SWAR_DIGITS */
+
+
+/**
+ * Convert a run of decimal digits starting at (*src_idx)
+ *
+ * The digits are accumulated into (*dst_value), which wraps around if
+ * more than 19 digits are converted. (*src_idx) is advanced to the first
+ * char that is not a digit. Returns the number of digits.
+ */
+static size_t sstr_scan_digits(
+    const char *src_chars,
+    size_t     src_len,
+    size_t     *src_idx,
+    uint64_t   *dst_value
+)
+{
+    size_t   scan_idx = (*src_idx);
+    uint64_t value    = (*dst_value);
+
+    #ifdef __SSE2__
+    while (src_len - scan_idx >= 16)
+    {
+        uint64_t chunk;
+        if (sstr_parse_16digits(&(src_chars[scan_idx]), &chunk) == 0)
+        {
+            break;
+        }
+        value = value * 10000000000000000ULL + chunk;
+        scan_idx += 16;
+    }
+    #endif /* __SSE2__ */
+
+    #ifdef SSTR_SWAR_DIGITS
+    while (src_len - scan_idx >= 8)
+    {
+        uint64_t word;
+        memcpy(&word, &(src_chars[scan_idx]), sizeof (word));
+        if (sstr_is_8digits(word) == 0)
+        {
+            break;
+        }
+        value = value * 100000000 + sstr_parse_8digits(word);
+        scan_idx += 8;
+    }
+    #endif /* SSTR_SWAR_DIGITS */
+
+    while (scan_idx < src_len && src_chars[scan_idx] >= '0' && src_chars[scan_idx] <= '9')
+    {
+        value = value * 10 + (uint64_t) (src_chars[scan_idx] - '0');
+        ++scan_idx;
+    }
+
+    size_t digits_len = scan_idx - (*src_idx);
+    (*src_idx)  = scan_idx;
+    (*dst_value) = value;
+
+    return digits_len;
+}
+
+
+/**
+ * Convert the decimal digits from src_idx to the end of a string
+ * to an unsigned integer
+ */
+static sstr_rc sstr_parse_u64(
+    const char *src_chars,
+    size_t     src_len,
+    size_t     src_idx,
+    uint64_t   *dst_value
+)
+{
+    sstr_rc sstr_status = SSTR_FAIL;
+
+    size_t digits_idx = src_idx;
+    while (src_idx < src_len && src_chars[src_idx] == '0')
+    {
+        ++src_idx;
+    }
+
+    size_t   first_idx  = src_idx;
+    uint64_t value      = 0;
+    size_t   digits_len = sstr_scan_digits(src_chars, src_len, &src_idx, &value);
+
+    if (src_idx == src_len && src_idx > digits_idx)
+    {
+        if (digits_len < 20)
+        {
+            (*dst_value) = value;
+            sstr_status  = SSTR_PASS;
+        }
+        else
+        if (digits_len == 20 && src_chars[first_idx] == '1' &&
+            value >= 10000000000000000000ULL)
+        {
+            // values from 1e19 to 2e19 wrap around to below 1e19
+            // if they do not fit
+            (*dst_value) = value;
+            sstr_status  = SSTR_PASS;
+        }
+        else
+        {
+            sstr_status = SSTR_RANGE;
+        }
+    }
+
+    return sstr_status;
+}
+
+
+/*
+ * Conversion of decimal numbers to doubles
+ *
+ * Numbers with up to 19 significant digits are converted exactly by
+ * Clinger's fast path or by the Eisel-Lemire algorithm (Daniel Lemire,
+ * "Number Parsing at a Gigabyte per Second", 2021). Longer numbers are
+ * converted from their first 19 digits; if rounding is ambiguous, all
+ * digits are compared with the halfway point between the two candidates
+ * using big integer arithmetic.
+ */
+
+#define SSTR_DOUBLE_INF_BITS       (((uint64_t) 0x7FF) << 52)
+#define SSTR_DOUBLE_NAN_BITS       (((uint64_t) 0xFFF) << 51)
+#define SSTR_POW10_MIN             (-342)
+#define SSTR_POW10_MAX             308
+
+// number of significant digits considered by the exact rounding fallback;
+// halfway points between doubles have at most 767 significant digits
+#define SSTR_DECIMAL_DIGITS_MAX    780
+// 4096 bits, enough for any comparison of up to 780 digits
+#define SSTR_BIGNUM_LIMBS          128
+
+// decimal number as found in a string
+typedef struct
+{
+    const char *int_chars;
+    size_t     int_len;
+    const char *frac_chars;
+    size_t     frac_len;
+    // number of significant digits
+    size_t     digits_len;
+    // explicit exponent
+    int64_t    exp_value;
+}
+sstr_decimal;
+
+// big unsigned integer in 32 bit limbs, least significant limb first
+typedef struct
+{
+    uint32_t limbs[SSTR_BIGNUM_LIMBS];
+    size_t   count;
+}
+sstr_bignum;
+
+// powers of 10 that are exactly representable as doubles
+static const double sstr_pow10_exact[23] =
+{
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+// 5^q for -342 <= q <= 308, normalized to 128 bits and truncated,
+// stored as { high, low }; negative powers are rounded up
+static const uint64_t sstr_pow5_128[651][2] =
+{
+    { 0xEEF453D6923BD65AULL, 0x113FAA2906A13B3FULL },
+    { 0x9558B4661B6565F8ULL, 0x4AC7CA59A424C507ULL },
+    { 0xBAAEE17FA23EBF76ULL, 0x5D79BCF00D2DF649ULL },
+    { 0xE95A99DF8ACE6F53ULL, 0xF4D82C2C107973DCULL },
+    { 0x91D8A02BB6C10594ULL, 0x79071B9B8A4BE869ULL },
+    { 0xB64EC836A47146F9ULL, 0x9748E2826CDEE284ULL },
+    { 0xE3E27A444D8D98B7ULL, 0xFD1B1B2308169B25ULL },
+    { 0x8E6D8C6AB0787F72ULL, 0xFE30F0F5E50E20F7ULL },
+    { 0xB208EF855C969F4FULL, 0xBDBD2D335E51A935ULL },
+    { 0xDE8B2B66B3BC4723ULL, 0xAD2C788035E61382ULL },
+    { 0x8B16FB203055AC76ULL, 0x4C3BCB5021AFCC31ULL },
+    { 0xADDCB9E83C6B1793ULL, 0xDF4ABE242A1BBF3DULL },
+    { 0xD953E8624B85DD78ULL, 0xD71D6DAD34A2AF0DULL },
+    { 0x87D4713D6F33AA6BULL, 0x8672648C40E5AD68ULL },
+    { 0xA9C98D8CCB009506ULL, 0x680EFDAF511F18C2ULL },
+    { 0xD43BF0EFFDC0BA48ULL, 0x0212BD1B2566DEF2ULL },
+    { 0x84A57695FE98746DULL, 0x014BB630F7604B57ULL },
+    { 0xA5CED43B7E3E9188ULL, 0x419EA3BD35385E2DULL },
+    { 0xCF42894A5DCE35EAULL, 0x52064CAC828675B9ULL },
+    { 0x818995CE7AA0E1B2ULL, 0x7343EFEBD1940993ULL },
+    { 0xA1EBFB4219491A1FULL, 0x1014EBE6C5F90BF8ULL },
+    { 0xCA66FA129F9B60A6ULL, 0xD41A26E077774EF6ULL },
+    { 0xFD00B897478238D0ULL, 0x8920B098955522B4ULL },
+    { 0x9E20735E8CB16382ULL, 0x55B46E5F5D5535B0ULL },
+    { 0xC5A890362FDDBC62ULL, 0xEB2189F734AA831DULL },
+    { 0xF712B443BBD52B7BULL, 0xA5E9EC7501D523E4ULL },
+    { 0x9A6BB0AA55653B2DULL, 0x47B233C92125366EULL },
+    { 0xC1069CD4EABE89F8ULL, 0x999EC0BB696E840AULL },
+    { 0xF148440A256E2C76ULL, 0xC00670EA43CA250DULL },
+    { 0x96CD2A865764DBCAULL, 0x380406926A5E5728ULL },
+    { 0xBC807527ED3E12BCULL, 0xC605083704F5ECF2ULL },
+    { 0xEBA09271E88D976BULL, 0xF7864A44C633682EULL },
+    { 0x93445B8731587EA3ULL, 0x7AB3EE6AFBE0211DULL },
+    { 0xB8157268FDAE9E4CULL, 0x5960EA05BAD82964ULL },
+    { 0xE61ACF033D1A45DFULL, 0x6FB92487298E33BDULL },
+    { 0x8FD0C16206306BABULL, 0xA5D3B6D479F8E056ULL },
+    { 0xB3C4F1BA87BC8696ULL, 0x8F48A4899877186CULL },
+    { 0xE0B62E2929ABA83CULL, 0x331ACDABFE94DE87ULL },
+    { 0x8C71DCD9BA0B4925ULL, 0x9FF0C08B7F1D0B14ULL },
+    { 0xAF8E5410288E1B6FULL, 0x07ECF0AE5EE44DD9ULL },
+    { 0xDB71E91432B1A24AULL, 0xC9E82CD9F69D6150ULL },
+    { 0x892731AC9FAF056EULL, 0xBE311C083A225CD2ULL },
+    { 0xAB70FE17C79AC6CAULL, 0x6DBD630A48AAF406ULL },
+    { 0xD64D3D9DB981787DULL, 0x092CBBCCDAD5B108ULL },
+    { 0x85F0468293F0EB4EULL, 0x25BBF56008C58EA5ULL },
+    { 0xA76C582338ED2621ULL, 0xAF2AF2B80AF6F24EULL },
+    { 0xD1476E2C07286FAAULL, 0x1AF5AF660DB4AEE1ULL },
+    { 0x82CCA4DB847945CAULL, 0x50D98D9FC890ED4DULL },
+    { 0xA37FCE126597973CULL, 0xE50FF107BAB528A0ULL },
+    { 0xCC5FC196FEFD7D0CULL, 0x1E53ED49A96272C8ULL },
+    { 0xFF77B1FCBEBCDC4FULL, 0x25E8E89C13BB0F7AULL },
+    { 0x9FAACF3DF73609B1ULL, 0x77B191618C54E9ACULL },
+    { 0xC795830D75038C1DULL, 0xD59DF5B9EF6A2417ULL },
+    { 0xF97AE3D0D2446F25ULL, 0x4B0573286B44AD1DULL },
+    { 0x9BECCE62836AC577ULL, 0x4EE367F9430AEC32ULL },
+    { 0xC2E801FB244576D5ULL, 0x229C41F793CDA73FULL },
+    { 0xF3A20279ED56D48AULL, 0x6B43527578C1110FULL },
+    { 0x9845418C345644D6ULL, 0x830A13896B78AAA9ULL },
+    { 0xBE5691EF416BD60CULL, 0x23CC986BC656D553ULL },
+    { 0xEDEC366B11C6CB8FULL, 0x2CBFBE86B7EC8AA8ULL },
+    { 0x94B3A202EB1C3F39ULL, 0x7BF7D71432F3D6A9ULL },
+    { 0xB9E08A83A5E34F07ULL, 0xDAF5CCD93FB0CC53ULL },
+    { 0xE858AD248F5C22C9ULL, 0xD1B3400F8F9CFF68ULL },
+    { 0x91376C36D99995BEULL, 0x23100809B9C21FA1ULL },
+    { 0xB58547448FFFFB2DULL, 0xABD40A0C2832A78AULL },
+    { 0xE2E69915B3FFF9F9ULL, 0x16C90C8F323F516CULL },
+    { 0x8DD01FAD907FFC3BULL, 0xAE3DA7D97F6792E3ULL },
+    { 0xB1442798F49FFB4AULL, 0x99CD11CFDF41779CULL },
+    { 0xDD95317F31C7FA1DULL, 0x40405643D711D583ULL },
+    { 0x8A7D3EEF7F1CFC52ULL, 0x482835EA666B2572ULL },
+    { 0xAD1C8EAB5EE43B66ULL, 0xDA3243650005EECFULL },
+    { 0xD863B256369D4A40ULL, 0x90BED43E40076A82ULL },
+    { 0x873E4F75E2224E68ULL, 0x5A7744A6E804A291ULL },
+    { 0xA90DE3535AAAE202ULL, 0x711515D0A205CB36ULL },
+    { 0xD3515C2831559A83ULL, 0x0D5A5B44CA873E03ULL },
+    { 0x8412D9991ED58091ULL, 0xE858790AFE9486C2ULL },
+    { 0xA5178FFF668AE0B6ULL, 0x626E974DBE39A872ULL },
+    { 0xCE5D73FF402D98E3ULL, 0xFB0A3D212DC8128FULL },
+    { 0x80FA687F881C7F8EULL, 0x7CE66634BC9D0B99ULL },
+    { 0xA139029F6A239F72ULL, 0x1C1FFFC1EBC44E80ULL },
+    { 0xC987434744AC874EULL, 0xA327FFB266B56220ULL },
+    { 0xFBE9141915D7A922ULL, 0x4BF1FF9F0062BAA8ULL },
+    { 0x9D71AC8FADA6C9B5ULL, 0x6F773FC3603DB4A9ULL },
+    { 0xC4CE17B399107C22ULL, 0xCB550FB4384D21D3ULL },
+    { 0xF6019DA07F549B2BULL, 0x7E2A53A146606A48ULL },
+    { 0x99C102844F94E0FBULL, 0x2EDA7444CBFC426DULL },
+    { 0xC0314325637A1939ULL, 0xFA911155FEFB5308ULL },
+    { 0xF03D93EEBC589F88ULL, 0x793555AB7EBA27CAULL },
+    { 0x96267C7535B763B5ULL, 0x4BC1558B2F3458DEULL },
+    { 0xBBB01B9283253CA2ULL, 0x9EB1AAEDFB016F16ULL },
+    { 0xEA9C227723EE8BCBULL, 0x465E15A979C1CADCULL },
+    { 0x92A1958A7675175FULL, 0x0BFACD89EC191EC9ULL },
+    { 0xB749FAED14125D36ULL, 0xCEF980EC671F667BULL },
+    { 0xE51C79A85916F484ULL, 0x82B7E12780E7401AULL },
+    { 0x8F31CC0937AE58D2ULL, 0xD1B2ECB8B0908810ULL },
+    { 0xB2FE3F0B8599EF07ULL, 0x861FA7E6DCB4AA15ULL },
+    { 0xDFBDCECE67006AC9ULL, 0x67A791E093E1D49AULL },
+    { 0x8BD6A141006042BDULL, 0xE0C8BB2C5C6D24E0ULL },
+    { 0xAECC49914078536DULL, 0x58FAE9F773886E18ULL },
+    { 0xDA7F5BF590966848ULL, 0xAF39A475506A899EULL },
+    { 0x888F99797A5E012DULL, 0x6D8406C952429603ULL },
+    { 0xAAB37FD7D8F58178ULL, 0xC8E5087BA6D33B83ULL },
+    { 0xD5605FCDCF32E1D6ULL, 0xFB1E4A9A90880A64ULL },
+    { 0x855C3BE0A17FCD26ULL, 0x5CF2EEA09A55067FULL },
+    { 0xA6B34AD8C9DFC06FULL, 0xF42FAA48C0EA481EULL },
+    { 0xD0601D8EFC57B08BULL, 0xF13B94DAF124DA26ULL },
+    { 0x823C12795DB6CE57ULL, 0x76C53D08D6B70858ULL },
+    { 0xA2CB1717B52481EDULL, 0x54768C4B0C64CA6EULL },
+    { 0xCB7DDCDDA26DA268ULL, 0xA9942F5DCF7DFD09ULL },
+    { 0xFE5D54150B090B02ULL, 0xD3F93B35435D7C4CULL },
+    { 0x9EFA548D26E5A6E1ULL, 0xC47BC5014A1A6DAFULL },
+    { 0xC6B8E9B0709F109AULL, 0x359AB6419CA1091BULL },
+    { 0xF867241C8CC6D4C0ULL, 0xC30163D203C94B62ULL },
+    { 0x9B407691D7FC44F8ULL, 0x79E0DE63425DCF1DULL },
+    { 0xC21094364DFB5636ULL, 0x985915FC12F542E4ULL },
+    { 0xF294B943E17A2BC4ULL, 0x3E6F5B7B17B2939DULL },
+    { 0x979CF3CA6CEC5B5AULL, 0xA705992CEECF9C42ULL },
+    { 0xBD8430BD08277231ULL, 0x50C6FF782A838353ULL },
+    { 0xECE53CEC4A314EBDULL, 0xA4F8BF5635246428ULL },
+    { 0x940F4613AE5ED136ULL, 0x871B7795E136BE99ULL },
+    { 0xB913179899F68584ULL, 0x28E2557B59846E3FULL },
+    { 0xE757DD7EC07426E5ULL, 0x331AEADA2FE589CFULL },
+    { 0x9096EA6F3848984FULL, 0x3FF0D2C85DEF7621ULL },
+    { 0xB4BCA50B065ABE63ULL, 0x0FED077A756B53A9ULL },
+    { 0xE1EBCE4DC7F16DFBULL, 0xD3E8495912C62894ULL },
+    { 0x8D3360F09CF6E4BDULL, 0x64712DD7ABBBD95CULL },
+    { 0xB080392CC4349DECULL, 0xBD8D794D96AACFB3ULL },
+    { 0xDCA04777F541C567ULL, 0xECF0D7A0FC5583A0ULL },
+    { 0x89E42CAAF9491B60ULL, 0xF41686C49DB57244ULL },
+    { 0xAC5D37D5B79B6239ULL, 0x311C2875C522CED5ULL },
+    { 0xD77485CB25823AC7ULL, 0x7D633293366B828BULL },
+    { 0x86A8D39EF77164BCULL, 0xAE5DFF9C02033197ULL },
+    { 0xA8530886B54DBDEBULL, 0xD9F57F830283FDFCULL },
+    { 0xD267CAA862A12D66ULL, 0xD072DF63C324FD7BULL },
+    { 0x8380DEA93DA4BC60ULL, 0x4247CB9E59F71E6DULL },
+    { 0xA46116538D0DEB78ULL, 0x52D9BE85F074E608ULL },
+    { 0xCD795BE870516656ULL, 0x67902E276C921F8BULL },
+    { 0x806BD9714632DFF6ULL, 0x00BA1CD8A3DB53B6ULL },
+    { 0xA086CFCD97BF97F3ULL, 0x80E8A40ECCD228A4ULL },
+    { 0xC8A883C0FDAF7DF0ULL, 0x6122CD128006B2CDULL },
+    { 0xFAD2A4B13D1B5D6CULL, 0x796B805720085F81ULL },
+    { 0x9CC3A6EEC6311A63ULL, 0xCBE3303674053BB0ULL },
+    { 0xC3F490AA77BD60FCULL, 0xBEDBFC4411068A9CULL },
+    { 0xF4F1B4D515ACB93BULL, 0xEE92FB5515482D44ULL },
+    { 0x991711052D8BF3C5ULL, 0x751BDD152D4D1C4AULL },
+    { 0xBF5CD54678EEF0B6ULL, 0xD262D45A78A0635DULL },
+    { 0xEF340A98172AACE4ULL, 0x86FB897116C87C34ULL },
+    { 0x9580869F0E7AAC0EULL, 0xD45D35E6AE3D4DA0ULL },
+    { 0xBAE0A846D2195712ULL, 0x8974836059CCA109ULL },
+    { 0xE998D258869FACD7ULL, 0x2BD1A438703FC94BULL },
+    { 0x91FF83775423CC06ULL, 0x7B6306A34627DDCFULL },
+    { 0xB67F6455292CBF08ULL, 0x1A3BC84C17B1D542ULL },
+    { 0xE41F3D6A7377EECAULL, 0x20CABA5F1D9E4A93ULL },
+    { 0x8E938662882AF53EULL, 0x547EB47B7282EE9CULL },
+    { 0xB23867FB2A35B28DULL, 0xE99E619A4F23AA43ULL },
+    { 0xDEC681F9F4C31F31ULL, 0x6405FA00E2EC94D4ULL },
+    { 0x8B3C113C38F9F37EULL, 0xDE83BC408DD3DD04ULL },
+    { 0xAE0B158B4738705EULL, 0x9624AB50B148D445ULL },
+    { 0xD98DDAEE19068C76ULL, 0x3BADD624DD9B0957ULL },
+    { 0x87F8A8D4CFA417C9ULL, 0xE54CA5D70A80E5D6ULL },
+    { 0xA9F6D30A038D1DBCULL, 0x5E9FCF4CCD211F4CULL },
+    { 0xD47487CC8470652BULL, 0x7647C3200069671FULL },
+    { 0x84C8D4DFD2C63F3BULL, 0x29ECD9F40041E073ULL },
+    { 0xA5FB0A17C777CF09ULL, 0xF468107100525890ULL },
+    { 0xCF79CC9DB955C2CCULL, 0x7182148D4066EEB4ULL },
+    { 0x81AC1FE293D599BFULL, 0xC6F14CD848405530ULL },
+    { 0xA21727DB38CB002FULL, 0xB8ADA00E5A506A7CULL },
+    { 0xCA9CF1D206FDC03BULL, 0xA6D90811F0E4851CULL },
+    { 0xFD442E4688BD304AULL, 0x908F4A166D1DA663ULL },
+    { 0x9E4A9CEC15763E2EULL, 0x9A598E4E043287FEULL },
+    { 0xC5DD44271AD3CDBAULL, 0x40EFF1E1853F29FDULL },
+    { 0xF7549530E188C128ULL, 0xD12BEE59E68EF47CULL },
+    { 0x9A94DD3E8CF578B9ULL, 0x82BB74F8301958CEULL },
+    { 0xC13A148E3032D6E7ULL, 0xE36A52363C1FAF01ULL },
+    { 0xF18899B1BC3F8CA1ULL, 0xDC44E6C3CB279AC1ULL },
+    { 0x96F5600F15A7B7E5ULL, 0x29AB103A5EF8C0B9ULL },
+    { 0xBCB2B812DB11A5DEULL, 0x7415D448F6B6F0E7ULL },
+    { 0xEBDF661791D60F56ULL, 0x111B495B3464AD21ULL },
+    { 0x936B9FCEBB25C995ULL, 0xCAB10DD900BEEC34ULL },
+    { 0xB84687C269EF3BFBULL, 0x3D5D514F40EEA742ULL },
+    { 0xE65829B3046B0AFAULL, 0x0CB4A5A3112A5112ULL },
+    { 0x8FF71A0FE2C2E6DCULL, 0x47F0E785EABA72ABULL },
+    { 0xB3F4E093DB73A093ULL, 0x59ED216765690F56ULL },
+    { 0xE0F218B8D25088B8ULL, 0x306869C13EC3532CULL },
+    { 0x8C974F7383725573ULL, 0x1E414218C73A13FBULL },
+    { 0xAFBD2350644EEACFULL, 0xE5D1929EF90898FAULL },
+    { 0xDBAC6C247D62A583ULL, 0xDF45F746B74ABF39ULL },
+    { 0x894BC396CE5DA772ULL, 0x6B8BBA8C328EB783ULL },
+    { 0xAB9EB47C81F5114FULL, 0x066EA92F3F326564ULL },
+    { 0xD686619BA27255A2ULL, 0xC80A537B0EFEFEBDULL },
+    { 0x8613FD0145877585ULL, 0xBD06742CE95F5F36ULL },
+    { 0xA798FC4196E952E7ULL, 0x2C48113823B73704ULL },
+    { 0xD17F3B51FCA3A7A0ULL, 0xF75A15862CA504C5ULL },
+    { 0x82EF85133DE648C4ULL, 0x9A984D73DBE722FBULL },
+    { 0xA3AB66580D5FDAF5ULL, 0xC13E60D0D2E0EBBAULL },
+    { 0xCC963FEE10B7D1B3ULL, 0x318DF905079926A8ULL },
+    { 0xFFBBCFE994E5C61FULL, 0xFDF17746497F7052ULL },
+    { 0x9FD561F1FD0F9BD3ULL, 0xFEB6EA8BEDEFA633ULL },
+    { 0xC7CABA6E7C5382C8ULL, 0xFE64A52EE96B8FC0ULL },
+    { 0xF9BD690A1B68637BULL, 0x3DFDCE7AA3C673B0ULL },
+    { 0x9C1661A651213E2DULL, 0x06BEA10CA65C084EULL },
+    { 0xC31BFA0FE5698DB8ULL, 0x486E494FCFF30A62ULL },
+    { 0xF3E2F893DEC3F126ULL, 0x5A89DBA3C3EFCCFAULL },
+    { 0x986DDB5C6B3A76B7ULL, 0xF89629465A75E01CULL },
+    { 0xBE89523386091465ULL, 0xF6BBB397F1135823ULL },
+    { 0xEE2BA6C0678B597FULL, 0x746AA07DED582E2CULL },
+    { 0x94DB483840B717EFULL, 0xA8C2A44EB4571CDCULL },
+    { 0xBA121A4650E4DDEBULL, 0x92F34D62616CE413ULL },
+    { 0xE896A0D7E51E1566ULL, 0x77B020BAF9C81D17ULL },
+    { 0x915E2486EF32CD60ULL, 0x0ACE1474DC1D122EULL },
+    { 0xB5B5ADA8AAFF80B8ULL, 0x0D819992132456BAULL },
+    { 0xE3231912D5BF60E6ULL, 0x10E1FFF697ED6C69ULL },
+    { 0x8DF5EFABC5979C8FULL, 0xCA8D3FFA1EF463C1ULL },
+    { 0xB1736B96B6FD83B3ULL, 0xBD308FF8A6B17CB2ULL },
+    { 0xDDD0467C64BCE4A0ULL, 0xAC7CB3F6D05DDBDEULL },
+    { 0x8AA22C0DBEF60EE4ULL, 0x6BCDF07A423AA96BULL },
+    { 0xAD4AB7112EB3929DULL, 0x86C16C98D2C953C6ULL },
+    { 0xD89D64D57A607744ULL, 0xE871C7BF077BA8B7ULL },
+    { 0x87625F056C7C4A8BULL, 0x11471CD764AD4972ULL },
+    { 0xA93AF6C6C79B5D2DULL, 0xD598E40D3DD89BCFULL },
+    { 0xD389B47879823479ULL, 0x4AFF1D108D4EC2C3ULL },
+    { 0x843610CB4BF160CBULL, 0xCEDF722A585139BAULL },
+    { 0xA54394FE1EEDB8FEULL, 0xC2974EB4EE658828ULL },
+    { 0xCE947A3DA6A9273EULL, 0x733D226229FEEA32ULL },
+    { 0x811CCC668829B887ULL, 0x0806357D5A3F525FULL },
+    { 0xA163FF802A3426A8ULL, 0xCA07C2DCB0CF26F7ULL },
+    { 0xC9BCFF6034C13052ULL, 0xFC89B393DD02F0B5ULL },
+    { 0xFC2C3F3841F17C67ULL, 0xBBAC2078D443ACE2ULL },
+    { 0x9D9BA7832936EDC0ULL, 0xD54B944B84AA4C0DULL },
+    { 0xC5029163F384A931ULL, 0x0A9E795E65D4DF11ULL },
+    { 0xF64335BCF065D37DULL, 0x4D4617B5FF4A16D5ULL },
+    { 0x99EA0196163FA42EULL, 0x504BCED1BF8E4E45ULL },
+    { 0xC06481FB9BCF8D39ULL, 0xE45EC2862F71E1D6ULL },
+    { 0xF07DA27A82C37088ULL, 0x5D767327BB4E5A4CULL },
+    { 0x964E858C91BA2655ULL, 0x3A6A07F8D510F86FULL },
+    { 0xBBE226EFB628AFEAULL, 0x890489F70A55368BULL },
+    { 0xEADAB0ABA3B2DBE5ULL, 0x2B45AC74CCEA842EULL },
+    { 0x92C8AE6B464FC96FULL, 0x3B0B8BC90012929DULL },
+    { 0xB77ADA0617E3BBCBULL, 0x09CE6EBB40173744ULL },
+    { 0xE55990879DDCAABDULL, 0xCC420A6A101D0515ULL },
+    { 0x8F57FA54C2A9EAB6ULL, 0x9FA946824A12232DULL },
+    { 0xB32DF8E9F3546564ULL, 0x47939822DC96ABF9ULL },
+    { 0xDFF9772470297EBDULL, 0x59787E2B93BC56F7ULL },
+    { 0x8BFBEA76C619EF36ULL, 0x57EB4EDB3C55B65AULL },
+    { 0xAEFAE51477A06B03ULL, 0xEDE622920B6B23F1ULL },
+    { 0xDAB99E59958885C4ULL, 0xE95FAB368E45ECEDULL },
+    { 0x88B402F7FD75539BULL, 0x11DBCB0218EBB414ULL },
+    { 0xAAE103B5FCD2A881ULL, 0xD652BDC29F26A119ULL },
+    { 0xD59944A37C0752A2ULL, 0x4BE76D3346F0495FULL },
+    { 0x857FCAE62D8493A5ULL, 0x6F70A4400C562DDBULL },
+    { 0xA6DFBD9FB8E5B88EULL, 0xCB4CCD500F6BB952ULL },
+    { 0xD097AD07A71F26B2ULL, 0x7E2000A41346A7A7ULL },
+    { 0x825ECC24C873782FULL, 0x8ED400668C0C28C8ULL },
+    { 0xA2F67F2DFA90563BULL, 0x728900802F0F32FAULL },
+    { 0xCBB41EF979346BCAULL, 0x4F2B40A03AD2FFB9ULL },
+    { 0xFEA126B7D78186BCULL, 0xE2F610C84987BFA8ULL },
+    { 0x9F24B832E6B0F436ULL, 0x0DD9CA7D2DF4D7C9ULL },
+    { 0xC6EDE63FA05D3143ULL, 0x91503D1C79720DBBULL },
+    { 0xF8A95FCF88747D94ULL, 0x75A44C6397CE912AULL },
+    { 0x9B69DBE1B548CE7CULL, 0xC986AFBE3EE11ABAULL },
+    { 0xC24452DA229B021BULL, 0xFBE85BADCE996168ULL },
+    { 0xF2D56790AB41C2A2ULL, 0xFAE27299423FB9C3ULL },
+    { 0x97C560BA6B0919A5ULL, 0xDCCD879FC967D41AULL },
+    { 0xBDB6B8E905CB600FULL, 0x5400E987BBC1C920ULL },
+    { 0xED246723473E3813ULL, 0x290123E9AAB23B68ULL },
+    { 0x9436C0760C86E30BULL, 0xF9A0B6720AAF6521ULL },
+    { 0xB94470938FA89BCEULL, 0xF808E40E8D5B3E69ULL },
+    { 0xE7958CB87392C2C2ULL, 0xB60B1D1230B20E04ULL },
+    { 0x90BD77F3483BB9B9ULL, 0xB1C6F22B5E6F48C2ULL },
+    { 0xB4ECD5F01A4AA828ULL, 0x1E38AEB6360B1AF3ULL },
+    { 0xE2280B6C20DD5232ULL, 0x25C6DA63C38DE1B0ULL },
+    { 0x8D590723948A535FULL, 0x579C487E5A38AD0EULL },
+    { 0xB0AF48EC79ACE837ULL, 0x2D835A9DF0C6D851ULL },
+    { 0xDCDB1B2798182244ULL, 0xF8E431456CF88E65ULL },
+    { 0x8A08F0F8BF0F156BULL, 0x1B8E9ECB641B58FFULL },
+    { 0xAC8B2D36EED2DAC5ULL, 0xE272467E3D222F3FULL },
+    { 0xD7ADF884AA879177ULL, 0x5B0ED81DCC6ABB0FULL },
+    { 0x86CCBB52EA94BAEAULL, 0x98E947129FC2B4E9ULL },
+    { 0xA87FEA27A539E9A5ULL, 0x3F2398D747B36224ULL },
+    { 0xD29FE4B18E88640EULL, 0x8EEC7F0D19A03AADULL },
+    { 0x83A3EEEEF9153E89ULL, 0x1953CF68300424ACULL },
+    { 0xA48CEAAAB75A8E2BULL, 0x5FA8C3423C052DD7ULL },
+    { 0xCDB02555653131B6ULL, 0x3792F412CB06794DULL },
+    { 0x808E17555F3EBF11ULL, 0xE2BBD88BBEE40BD0ULL },
+    { 0xA0B19D2AB70E6ED6ULL, 0x5B6ACEAEAE9D0EC4ULL },
+    { 0xC8DE047564D20A8BULL, 0xF245825A5A445275ULL },
+    { 0xFB158592BE068D2EULL, 0xEED6E2F0F0D56712ULL },
+    { 0x9CED737BB6C4183DULL, 0x55464DD69685606BULL },
+    { 0xC428D05AA4751E4CULL, 0xAA97E14C3C26B886ULL },
+    { 0xF53304714D9265DFULL, 0xD53DD99F4B3066A8ULL },
+    { 0x993FE2C6D07B7FABULL, 0xE546A8038EFE4029ULL },
+    { 0xBF8FDB78849A5F96ULL, 0xDE98520472BDD033ULL },
+    { 0xEF73D256A5C0F77CULL, 0x963E66858F6D4440ULL },
+    { 0x95A8637627989AADULL, 0xDDE7001379A44AA8ULL },
+    { 0xBB127C53B17EC159ULL, 0x5560C018580D5D52ULL },
+    { 0xE9D71B689DDE71AFULL, 0xAAB8F01E6E10B4A6ULL },
+    { 0x9226712162AB070DULL, 0xCAB3961304CA70E8ULL },
+    { 0xB6B00D69BB55C8D1ULL, 0x3D607B97C5FD0D22ULL },
+    { 0xE45C10C42A2B3B05ULL, 0x8CB89A7DB77C506AULL },
+    { 0x8EB98A7A9A5B04E3ULL, 0x77F3608E92ADB242ULL },
+    { 0xB267ED1940F1C61CULL, 0x55F038B237591ED3ULL },
+    { 0xDF01E85F912E37A3ULL, 0x6B6C46DEC52F6688ULL },
+    { 0x8B61313BBABCE2C6ULL, 0x2323AC4B3B3DA015ULL },
+    { 0xAE397D8AA96C1B77ULL, 0xABEC975E0A0D081AULL },
+    { 0xD9C7DCED53C72255ULL, 0x96E7BD358C904A21ULL },
+    { 0x881CEA14545C7575ULL, 0x7E50D64177DA2E54ULL },
+    { 0xAA242499697392D2ULL, 0xDDE50BD1D5D0B9E9ULL },
+    { 0xD4AD2DBFC3D07787ULL, 0x955E4EC64B44E864ULL },
+    { 0x84EC3C97DA624AB4ULL, 0xBD5AF13BEF0B113EULL },
+    { 0xA6274BBDD0FADD61ULL, 0xECB1AD8AEACDD58EULL },
+    { 0xCFB11EAD453994BAULL, 0x67DE18EDA5814AF2ULL },
+    { 0x81CEB32C4B43FCF4ULL, 0x80EACF948770CED7ULL },
+    { 0xA2425FF75E14FC31ULL, 0xA1258379A94D028DULL },
+    { 0xCAD2F7F5359A3B3EULL, 0x096EE45813A04330ULL },
+    { 0xFD87B5F28300CA0DULL, 0x8BCA9D6E188853FCULL },
+    { 0x9E74D1B791E07E48ULL, 0x775EA264CF55347EULL },
+    { 0xC612062576589DDAULL, 0x95364AFE032A819EULL },
+    { 0xF79687AED3EEC551ULL, 0x3A83DDBD83F52205ULL },
+    { 0x9ABE14CD44753B52ULL, 0xC4926A9672793543ULL },
+    { 0xC16D9A0095928A27ULL, 0x75B7053C0F178294ULL },
+    { 0xF1C90080BAF72CB1ULL, 0x5324C68B12DD6339ULL },
+    { 0x971DA05074DA7BEEULL, 0xD3F6FC16EBCA5E04ULL },
+    { 0xBCE5086492111AEAULL, 0x88F4BB1CA6BCF585ULL },
+    { 0xEC1E4A7DB69561A5ULL, 0x2B31E9E3D06C32E6ULL },
+    { 0x9392EE8E921D5D07ULL, 0x3AFF322E62439FD0ULL },
+    { 0xB877AA3236A4B449ULL, 0x09BEFEB9FAD487C3ULL },
+    { 0xE69594BEC44DE15BULL, 0x4C2EBE687989A9B4ULL },
+    { 0x901D7CF73AB0ACD9ULL, 0x0F9D37014BF60A11ULL },
+    { 0xB424DC35095CD80FULL, 0x538484C19EF38C95ULL },
+    { 0xE12E13424BB40E13ULL, 0x2865A5F206B06FBAULL },
+    { 0x8CBCCC096F5088CBULL, 0xF93F87B7442E45D4ULL },
+    { 0xAFEBFF0BCB24AAFEULL, 0xF78F69A51539D749ULL },
+    { 0xDBE6FECEBDEDD5BEULL, 0xB573440E5A884D1CULL },
+    { 0x89705F4136B4A597ULL, 0x31680A88F8953031ULL },
+    { 0xABCC77118461CEFCULL, 0xFDC20D2B36BA7C3EULL },
+    { 0xD6BF94D5E57A42BCULL, 0x3D32907604691B4DULL },
+    { 0x8637BD05AF6C69B5ULL, 0xA63F9A49C2C1B110ULL },
+    { 0xA7C5AC471B478423ULL, 0x0FCF80DC33721D54ULL },
+    { 0xD1B71758E219652BULL, 0xD3C36113404EA4A9ULL },
+    { 0x83126E978D4FDF3BULL, 0x645A1CAC083126EAULL },
+    { 0xA3D70A3D70A3D70AULL, 0x3D70A3D70A3D70A4ULL },
+    { 0xCCCCCCCCCCCCCCCCULL, 0xCCCCCCCCCCCCCCCDULL },
+    { 0x8000000000000000ULL, 0x0000000000000000ULL },
+    { 0xA000000000000000ULL, 0x0000000000000000ULL },
+    { 0xC800000000000000ULL, 0x0000000000000000ULL },
+    { 0xFA00000000000000ULL, 0x0000000000000000ULL },
+    { 0x9C40000000000000ULL, 0x0000000000000000ULL },
+    { 0xC350000000000000ULL, 0x0000000000000000ULL },
+    { 0xF424000000000000ULL, 0x0000000000000000ULL },
+    { 0x9896800000000000ULL, 0x0000000000000000ULL },
+    { 0xBEBC200000000000ULL, 0x0000000000000000ULL },
+    { 0xEE6B280000000000ULL, 0x0000000000000000ULL },
+    { 0x9502F90000000000ULL, 0x0000000000000000ULL },
+    { 0xBA43B74000000000ULL, 0x0000000000000000ULL },
+    { 0xE8D4A51000000000ULL, 0x0000000000000000ULL },
+    { 0x9184E72A00000000ULL, 0x0000000000000000ULL },
+    { 0xB5E620F480000000ULL, 0x0000000000000000ULL },
+    { 0xE35FA931A0000000ULL, 0x0000000000000000ULL },
+    { 0x8E1BC9BF04000000ULL, 0x0000000000000000ULL },
+    { 0xB1A2BC2EC5000000ULL, 0x0000000000000000ULL },
+    { 0xDE0B6B3A76400000ULL, 0x0000000000000000ULL },
+    { 0x8AC7230489E80000ULL, 0x0000000000000000ULL },
+    { 0xAD78EBC5AC620000ULL, 0x0000000000000000ULL },
+    { 0xD8D726B7177A8000ULL, 0x0000000000000000ULL },
+    { 0x878678326EAC9000ULL, 0x0000000000000000ULL },
+    { 0xA968163F0A57B400ULL, 0x0000000000000000ULL },
+    { 0xD3C21BCECCEDA100ULL, 0x0000000000000000ULL },
+    { 0x84595161401484A0ULL, 0x0000000000000000ULL },
+    { 0xA56FA5B99019A5C8ULL, 0x0000000000000000ULL },
+    { 0xCECB8F27F4200F3AULL, 0x0000000000000000ULL },
+    { 0x813F3978F8940984ULL, 0x4000000000000000ULL },
+    { 0xA18F07D736B90BE5ULL, 0x5000000000000000ULL },
+    { 0xC9F2C9CD04674EDEULL, 0xA400000000000000ULL },
+    { 0xFC6F7C4045812296ULL, 0x4D00000000000000ULL },
+    { 0x9DC5ADA82B70B59DULL, 0xF020000000000000ULL },
+    { 0xC5371912364CE305ULL, 0x6C28000000000000ULL },
+    { 0xF684DF56C3E01BC6ULL, 0xC732000000000000ULL },
+    { 0x9A130B963A6C115CULL, 0x3C7F400000000000ULL },
+    { 0xC097CE7BC90715B3ULL, 0x4B9F100000000000ULL },
+    { 0xF0BDC21ABB48DB20ULL, 0x1E86D40000000000ULL },
+    { 0x96769950B50D88F4ULL, 0x1314448000000000ULL },
+    { 0xBC143FA4E250EB31ULL, 0x17D955A000000000ULL },
+    { 0xEB194F8E1AE525FDULL, 0x5DCFAB0800000000ULL },
+    { 0x92EFD1B8D0CF37BEULL, 0x5AA1CAE500000000ULL },
+    { 0xB7ABC627050305ADULL, 0xF14A3D9E40000000ULL },
+    { 0xE596B7B0C643C719ULL, 0x6D9CCD05D0000000ULL },
+    { 0x8F7E32CE7BEA5C6FULL, 0xE4820023A2000000ULL },
+    { 0xB35DBF821AE4F38BULL, 0xDDA2802C8A800000ULL },
+    { 0xE0352F62A19E306EULL, 0xD50B2037AD200000ULL },
+    { 0x8C213D9DA502DE45ULL, 0x4526F422CC340000ULL },
+    { 0xAF298D050E4395D6ULL, 0x9670B12B7F410000ULL },
+    { 0xDAF3F04651D47B4CULL, 0x3C0CDD765F114000ULL },
+    { 0x88D8762BF324CD0FULL, 0xA5880A69FB6AC800ULL },
+    { 0xAB0E93B6EFEE0053ULL, 0x8EEA0D047A457A00ULL },
+    { 0xD5D238A4ABE98068ULL, 0x72A4904598D6D880ULL },
+    { 0x85A36366EB71F041ULL, 0x47A6DA2B7F864750ULL },
+    { 0xA70C3C40A64E6C51ULL, 0x999090B65F67D924ULL },
+    { 0xD0CF4B50CFE20765ULL, 0xFFF4B4E3F741CF6DULL },
+    { 0x82818F1281ED449FULL, 0xBFF8F10E7A8921A4ULL },
+    { 0xA321F2D7226895C7ULL, 0xAFF72D52192B6A0DULL },
+    { 0xCBEA6F8CEB02BB39ULL, 0x9BF4F8A69F764490ULL },
+    { 0xFEE50B7025C36A08ULL, 0x02F236D04753D5B4ULL },
+    { 0x9F4F2726179A2245ULL, 0x01D762422C946590ULL },
+    { 0xC722F0EF9D80AAD6ULL, 0x424D3AD2B7B97EF5ULL },
+    { 0xF8EBAD2B84E0D58BULL, 0xD2E0898765A7DEB2ULL },
+    { 0x9B934C3B330C8577ULL, 0x63CC55F49F88EB2FULL },
+    { 0xC2781F49FFCFA6D5ULL, 0x3CBF6B71C76B25FBULL },
+    { 0xF316271C7FC3908AULL, 0x8BEF464E3945EF7AULL },
+    { 0x97EDD871CFDA3A56ULL, 0x97758BF0E3CBB5ACULL },
+    { 0xBDE94E8E43D0C8ECULL, 0x3D52EEED1CBEA317ULL },
+    { 0xED63A231D4C4FB27ULL, 0x4CA7AAA863EE4BDDULL },
+    { 0x945E455F24FB1CF8ULL, 0x8FE8CAA93E74EF6AULL },
+    { 0xB975D6B6EE39E436ULL, 0xB3E2FD538E122B44ULL },
+    { 0xE7D34C64A9C85D44ULL, 0x60DBBCA87196B616ULL },
+    { 0x90E40FBEEA1D3A4AULL, 0xBC8955E946FE31CDULL },
+    { 0xB51D13AEA4A488DDULL, 0x6BABAB6398BDBE41ULL },
+    { 0xE264589A4DCDAB14ULL, 0xC696963C7EED2DD1ULL },
+    { 0x8D7EB76070A08AECULL, 0xFC1E1DE5CF543CA2ULL },
+    { 0xB0DE65388CC8ADA8ULL, 0x3B25A55F43294BCBULL },
+    { 0xDD15FE86AFFAD912ULL, 0x49EF0EB713F39EBEULL },
+    { 0x8A2DBF142DFCC7ABULL, 0x6E3569326C784337ULL },
+    { 0xACB92ED9397BF996ULL, 0x49C2C37F07965404ULL },
+    { 0xD7E77A8F87DAF7FBULL, 0xDC33745EC97BE906ULL },
+    { 0x86F0AC99B4E8DAFDULL, 0x69A028BB3DED71A3ULL },
+    { 0xA8ACD7C0222311BCULL, 0xC40832EA0D68CE0CULL },
+    { 0xD2D80DB02AABD62BULL, 0xF50A3FA490C30190ULL },
+    { 0x83C7088E1AAB65DBULL, 0x792667C6DA79E0FAULL },
+    { 0xA4B8CAB1A1563F52ULL, 0x577001B891185938ULL },
+    { 0xCDE6FD5E09ABCF26ULL, 0xED4C0226B55E6F86ULL },
+    { 0x80B05E5AC60B6178ULL, 0x544F8158315B05B4ULL },
+    { 0xA0DC75F1778E39D6ULL, 0x696361AE3DB1C721ULL },
+    { 0xC913936DD571C84CULL, 0x03BC3A19CD1E38E9ULL },
+    { 0xFB5878494ACE3A5FULL, 0x04AB48A04065C723ULL },
+    { 0x9D174B2DCEC0E47BULL, 0x62EB0D64283F9C76ULL },
+    { 0xC45D1DF942711D9AULL, 0x3BA5D0BD324F8394ULL },
+    { 0xF5746577930D6500ULL, 0xCA8F44EC7EE36479ULL },
+    { 0x9968BF6ABBE85F20ULL, 0x7E998B13CF4E1ECBULL },
+    { 0xBFC2EF456AE276E8ULL, 0x9E3FEDD8C321A67EULL },
+    { 0xEFB3AB16C59B14A2ULL, 0xC5CFE94EF3EA101EULL },
+    { 0x95D04AEE3B80ECE5ULL, 0xBBA1F1D158724A12ULL },
+    { 0xBB445DA9CA61281FULL, 0x2A8A6E45AE8EDC97ULL },
+    { 0xEA1575143CF97226ULL, 0xF52D09D71A3293BDULL },
+    { 0x924D692CA61BE758ULL, 0x593C2626705F9C56ULL },
+    { 0xB6E0C377CFA2E12EULL, 0x6F8B2FB00C77836CULL },
+    { 0xE498F455C38B997AULL, 0x0B6DFB9C0F956447ULL },
+    { 0x8EDF98B59A373FECULL, 0x4724BD4189BD5EACULL },
+    { 0xB2977EE300C50FE7ULL, 0x58EDEC91EC2CB657ULL },
+    { 0xDF3D5E9BC0F653E1ULL, 0x2F2967B66737E3EDULL },
+    { 0x8B865B215899F46CULL, 0xBD79E0D20082EE74ULL },
+    { 0xAE67F1E9AEC07187ULL, 0xECD8590680A3AA11ULL },
+    { 0xDA01EE641A708DE9ULL, 0xE80E6F4820CC9495ULL },
+    { 0x884134FE908658B2ULL, 0x3109058D147FDCDDULL },
+    { 0xAA51823E34A7EEDEULL, 0xBD4B46F0599FD415ULL },
+    { 0xD4E5E2CDC1D1EA96ULL, 0x6C9E18AC7007C91AULL },
+    { 0x850FADC09923329EULL, 0x03E2CF6BC604DDB0ULL },
+    { 0xA6539930BF6BFF45ULL, 0x84DB8346B786151CULL },
+    { 0xCFE87F7CEF46FF16ULL, 0xE612641865679A63ULL },
+    { 0x81F14FAE158C5F6EULL, 0x4FCB7E8F3F60C07EULL },
+    { 0xA26DA3999AEF7749ULL, 0xE3BE5E330F38F09DULL },
+    { 0xCB090C8001AB551CULL, 0x5CADF5BFD3072CC5ULL },
+    { 0xFDCB4FA002162A63ULL, 0x73D9732FC7C8F7F6ULL },
+    { 0x9E9F11C4014DDA7EULL, 0x2867E7FDDCDD9AFAULL },
+    { 0xC646D63501A1511DULL, 0xB281E1FD541501B8ULL },
+    { 0xF7D88BC24209A565ULL, 0x1F225A7CA91A4226ULL },
+    { 0x9AE757596946075FULL, 0x3375788DE9B06958ULL },
+    { 0xC1A12D2FC3978937ULL, 0x0052D6B1641C83AEULL },
+    { 0xF209787BB47D6B84ULL, 0xC0678C5DBD23A49AULL },
+    { 0x9745EB4D50CE6332ULL, 0xF840B7BA963646E0ULL },
+    { 0xBD176620A501FBFFULL, 0xB650E5A93BC3D898ULL },
+    { 0xEC5D3FA8CE427AFFULL, 0xA3E51F138AB4CEBEULL },
+    { 0x93BA47C980E98CDFULL, 0xC66F336C36B10137ULL },
+    { 0xB8A8D9BBE123F017ULL, 0xB80B0047445D4184ULL },
+    { 0xE6D3102AD96CEC1DULL, 0xA60DC059157491E5ULL },
+    { 0x9043EA1AC7E41392ULL, 0x87C89837AD68DB2FULL },
+    { 0xB454E4A179DD1877ULL, 0x29BABE4598C311FBULL },
+    { 0xE16A1DC9D8545E94ULL, 0xF4296DD6FEF3D67AULL },
+    { 0x8CE2529E2734BB1DULL, 0x1899E4A65F58660CULL },
+    { 0xB01AE745B101E9E4ULL, 0x5EC05DCFF72E7F8FULL },
+    { 0xDC21A1171D42645DULL, 0x76707543F4FA1F73ULL },
+    { 0x899504AE72497EBAULL, 0x6A06494A791C53A8ULL },
+    { 0xABFA45DA0EDBDE69ULL, 0x0487DB9D17636892ULL },
+    { 0xD6F8D7509292D603ULL, 0x45A9D2845D3C42B6ULL },
+    { 0x865B86925B9BC5C2ULL, 0x0B8A2392BA45A9B2ULL },
+    { 0xA7F26836F282B732ULL, 0x8E6CAC7768D7141EULL },
+    { 0xD1EF0244AF2364FFULL, 0x3207D795430CD926ULL },
+    { 0x8335616AED761F1FULL, 0x7F44E6BD49E807B8ULL },
+    { 0xA402B9C5A8D3A6E7ULL, 0x5F16206C9C6209A6ULL },
+    { 0xCD036837130890A1ULL, 0x36DBA887C37A8C0FULL },
+    { 0x802221226BE55A64ULL, 0xC2494954DA2C9789ULL },
+    { 0xA02AA96B06DEB0FDULL, 0xF2DB9BAA10B7BD6CULL },
+    { 0xC83553C5C8965D3DULL, 0x6F92829494E5ACC7ULL },
+    { 0xFA42A8B73ABBF48CULL, 0xCB772339BA1F17F9ULL },
+    { 0x9C69A97284B578D7ULL, 0xFF2A760414536EFBULL },
+    { 0xC38413CF25E2D70DULL, 0xFEF5138519684ABAULL },
+    { 0xF46518C2EF5B8CD1ULL, 0x7EB258665FC25D69ULL },
+    { 0x98BF2F79D5993802ULL, 0xEF2F773FFBD97A61ULL },
+    { 0xBEEEFB584AFF8603ULL, 0xAAFB550FFACFD8FAULL },
+    { 0xEEAABA2E5DBF6784ULL, 0x95BA2A53F983CF38ULL },
+    { 0x952AB45CFA97A0B2ULL, 0xDD945A747BF26183ULL },
+    { 0xBA756174393D88DFULL, 0x94F971119AEEF9E4ULL },
+    { 0xE912B9D1478CEB17ULL, 0x7A37CD5601AAB85DULL },
+    { 0x91ABB422CCB812EEULL, 0xAC62E055C10AB33AULL },
+    { 0xB616A12B7FE617AAULL, 0x577B986B314D6009ULL },
+    { 0xE39C49765FDF9D94ULL, 0xED5A7E85FDA0B80BULL },
+    { 0x8E41ADE9FBEBC27DULL, 0x14588F13BE847307ULL },
+    { 0xB1D219647AE6B31CULL, 0x596EB2D8AE258FC8ULL },
+    { 0xDE469FBD99A05FE3ULL, 0x6FCA5F8ED9AEF3BBULL },
+    { 0x8AEC23D680043BEEULL, 0x25DE7BB9480D5854ULL },
+    { 0xADA72CCC20054AE9ULL, 0xAF561AA79A10AE6AULL },
+    { 0xD910F7FF28069DA4ULL, 0x1B2BA1518094DA04ULL },
+    { 0x87AA9AFF79042286ULL, 0x90FB44D2F05D0842ULL },
+    { 0xA99541BF57452B28ULL, 0x353A1607AC744A53ULL },
+    { 0xD3FA922F2D1675F2ULL, 0x42889B8997915CE8ULL },
+    { 0x847C9B5D7C2E09B7ULL, 0x69956135FEBADA11ULL },
+    { 0xA59BC234DB398C25ULL, 0x43FAB9837E699095ULL },
+    { 0xCF02B2C21207EF2EULL, 0x94F967E45E03F4BBULL },
+    { 0x8161AFB94B44F57DULL, 0x1D1BE0EEBAC278F5ULL },
+    { 0xA1BA1BA79E1632DCULL, 0x6462D92A69731732ULL },
+    { 0xCA28A291859BBF93ULL, 0x7D7B8F7503CFDCFEULL },
+    { 0xFCB2CB35E702AF78ULL, 0x5CDA735244C3D43EULL },
+    { 0x9DEFBF01B061ADABULL, 0x3A0888136AFA64A7ULL },
+    { 0xC56BAEC21C7A1916ULL, 0x088AAA1845B8FDD0ULL },
+    { 0xF6C69A72A3989F5BULL, 0x8AAD549E57273D45ULL },
+    { 0x9A3C2087A63F6399ULL, 0x36AC54E2F678864BULL },
+    { 0xC0CB28A98FCF3C7FULL, 0x84576A1BB416A7DDULL },
+    { 0xF0FDF2D3F3C30B9FULL, 0x656D44A2A11C51D5ULL },
+    { 0x969EB7C47859E743ULL, 0x9F644AE5A4B1B325ULL },
+    { 0xBC4665B596706114ULL, 0x873D5D9F0DDE1FEEULL },
+    { 0xEB57FF22FC0C7959ULL, 0xA90CB506D155A7EAULL },
+    { 0x9316FF75DD87CBD8ULL, 0x09A7F12442D588F2ULL },
+    { 0xB7DCBF5354E9BECEULL, 0x0C11ED6D538AEB2FULL },
+    { 0xE5D3EF282A242E81ULL, 0x8F1668C8A86DA5FAULL },
+    { 0x8FA475791A569D10ULL, 0xF96E017D694487BCULL },
+    { 0xB38D92D760EC4455ULL, 0x37C981DCC395A9ACULL },
+    { 0xE070F78D3927556AULL, 0x85BBE253F47B1417ULL },
+    { 0x8C469AB843B89562ULL, 0x93956D7478CCEC8EULL },
+    { 0xAF58416654A6BABBULL, 0x387AC8D1970027B2ULL },
+    { 0xDB2E51BFE9D0696AULL, 0x06997B05FCC0319EULL },
+    { 0x88FCF317F22241E2ULL, 0x441FECE3BDF81F03ULL },
+    { 0xAB3C2FDDEEAAD25AULL, 0xD527E81CAD7626C3ULL },
+    { 0xD60B3BD56A5586F1ULL, 0x8A71E223D8D3B074ULL },
+    { 0x85C7056562757456ULL, 0xF6872D5667844E49ULL },
+    { 0xA738C6BEBB12D16CULL, 0xB428F8AC016561DBULL },
+    { 0xD106F86E69D785C7ULL, 0xE13336D701BEBA52ULL },
+    { 0x82A45B450226B39CULL, 0xECC0024661173473ULL },
+    { 0xA34D721642B06084ULL, 0x27F002D7F95D0190ULL },
+    { 0xCC20CE9BD35C78A5ULL, 0x31EC038DF7B441F4ULL },
+    { 0xFF290242C83396CEULL, 0x7E67047175A15271ULL },
+    { 0x9F79A169BD203E41ULL, 0x0F0062C6E984D386ULL },
+    { 0xC75809C42C684DD1ULL, 0x52C07B78A3E60868ULL },
+    { 0xF92E0C3537826145ULL, 0xA7709A56CCDF8A82ULL },
+    { 0x9BBCC7A142B17CCBULL, 0x88A66076400BB691ULL },
+    { 0xC2ABF989935DDBFEULL, 0x6ACFF893D00EA435ULL },
+    { 0xF356F7EBF83552FEULL, 0x0583F6B8C4124D43ULL },
+    { 0x98165AF37B2153DEULL, 0xC3727A337A8B704AULL },
+    { 0xBE1BF1B059E9A8D6ULL, 0x744F18C0592E4C5CULL },
+    { 0xEDA2EE1C7064130CULL, 0x1162DEF06F79DF73ULL },
+    { 0x9485D4D1C63E8BE7ULL, 0x8ADDCB5645AC2BA8ULL },
+    { 0xB9A74A0637CE2EE1ULL, 0x6D953E2BD7173692ULL },
+    { 0xE8111C87C5C1BA99ULL, 0xC8FA8DB6CCDD0437ULL },
+    { 0x910AB1D4DB9914A0ULL, 0x1D9C9892400A22A2ULL },
+    { 0xB54D5E4A127F59C8ULL, 0x2503BEB6D00CAB4BULL },
+    { 0xE2A0B5DC971F303AULL, 0x2E44AE64840FD61DULL },
+    { 0x8DA471A9DE737E24ULL, 0x5CEAECFED289E5D2ULL },
+    { 0xB10D8E1456105DADULL, 0x7425A83E872C5F47ULL },
+    { 0xDD50F1996B947518ULL, 0xD12F124E28F77719ULL },
+    { 0x8A5296FFE33CC92FULL, 0x82BD6B70D99AAA6FULL },
+    { 0xACE73CBFDC0BFB7BULL, 0x636CC64D1001550BULL },
+    { 0xD8210BEFD30EFA5AULL, 0x3C47F7E05401AA4EULL },
+    { 0x8714A775E3E95C78ULL, 0x65ACFAEC34810A71ULL },
+    { 0xA8D9D1535CE3B396ULL, 0x7F1839A741A14D0DULL },
+    { 0xD31045A8341CA07CULL, 0x1EDE48111209A050ULL },
+    { 0x83EA2B892091E44DULL, 0x934AED0AAB460432ULL },
+    { 0xA4E4B66B68B65D60ULL, 0xF81DA84D5617853FULL },
+    { 0xCE1DE40642E3F4B9ULL, 0x36251260AB9D668EULL },
+    { 0x80D2AE83E9CE78F3ULL, 0xC1D72B7C6B426019ULL },
+    { 0xA1075A24E4421730ULL, 0xB24CF65B8612F81FULL },
+    { 0xC94930AE1D529CFCULL, 0xDEE033F26797B627ULL },
+    { 0xFB9B7CD9A4A7443CULL, 0x169840EF017DA3B1ULL },
+    { 0x9D412E0806E88AA5ULL, 0x8E1F289560EE864EULL },
+    { 0xC491798A08A2AD4EULL, 0xF1A6F2BAB92A27E2ULL },
+    { 0xF5B5D7EC8ACB58A2ULL, 0xAE10AF696774B1DBULL },
+    { 0x9991A6F3D6BF1765ULL, 0xACCA6DA1E0A8EF29ULL },
+    { 0xBFF610B0CC6EDD3FULL, 0x17FD090A58D32AF3ULL },
+    { 0xEFF394DCFF8A948EULL, 0xDDFC4B4CEF07F5B0ULL },
+    { 0x95F83D0A1FB69CD9ULL, 0x4ABDAF101564F98EULL },
+    { 0xBB764C4CA7A4440FULL, 0x9D6D1AD41ABE37F1ULL },
+    { 0xEA53DF5FD18D5513ULL, 0x84C86189216DC5EDULL },
+    { 0x92746B9BE2F8552CULL, 0x32FD3CF5B4E49BB4ULL },
+    { 0xB7118682DBB66A77ULL, 0x3FBC8C33221DC2A1ULL },
+    { 0xE4D5E82392A40515ULL, 0x0FABAF3FEAA5334AULL },
+    { 0x8F05B1163BA6832DULL, 0x29CB4D87F2A7400EULL },
+    { 0xB2C71D5BCA9023F8ULL, 0x743E20E9EF511012ULL },
+    { 0xDF78E4B2BD342CF6ULL, 0x914DA9246B255416ULL },
+    { 0x8BAB8EEFB6409C1AULL, 0x1AD089B6C2F7548EULL },
+    { 0xAE9672ABA3D0C320ULL, 0xA184AC2473B529B1ULL },
+    { 0xDA3C0F568CC4F3E8ULL, 0xC9E5D72D90A2741EULL },
+    { 0x8865899617FB1871ULL, 0x7E2FA67C7A658892ULL },
+    { 0xAA7EEBFB9DF9DE8DULL, 0xDDBB901B98FEEAB7ULL },
+    { 0xD51EA6FA85785631ULL, 0x552A74227F3EA565ULL },
+    { 0x8533285C936B35DEULL, 0xD53A88958F87275FULL },
+    { 0xA67FF273B8460356ULL, 0x8A892ABAF368F137ULL },
+    { 0xD01FEF10A657842CULL, 0x2D2B7569B0432D85ULL },
+    { 0x8213F56A67F6B29BULL, 0x9C3B29620E29FC73ULL },
+    { 0xA298F2C501F45F42ULL, 0x8349F3BA91B47B8FULL },
+    { 0xCB3F2F7642717713ULL, 0x241C70A936219A73ULL },
+    { 0xFE0EFB53D30DD4D7ULL, 0xED238CD383AA0110ULL },
+    { 0x9EC95D1463E8A506ULL, 0xF4363804324A40AAULL },
+    { 0xC67BB4597CE2CE48ULL, 0xB143C6053EDCD0D5ULL },
+    { 0xF81AA16FDC1B81DAULL, 0xDD94B7868E94050AULL },
+    { 0x9B10A4E5E9913128ULL, 0xCA7CF2B4191C8326ULL },
+    { 0xC1D4CE1F63F57D72ULL, 0xFD1C2F611F63A3F0ULL },
+    { 0xF24A01A73CF2DCCFULL, 0xBC633B39673C8CECULL },
+    { 0x976E41088617CA01ULL, 0xD5BE0503E085D813ULL },
+    { 0xBD49D14AA79DBC82ULL, 0x4B2D8644D8A74E18ULL },
+    { 0xEC9C459D51852BA2ULL, 0xDDF8E7D60ED1219EULL },
+    { 0x93E1AB8252F33B45ULL, 0xCABB90E5C942B503ULL },
+    { 0xB8DA1662E7B00A17ULL, 0x3D6A751F3B936243ULL },
+    { 0xE7109BFBA19C0C9DULL, 0x0CC512670A783AD4ULL },
+    { 0x906A617D450187E2ULL, 0x27FB2B80668B24C5ULL },
+    { 0xB484F9DC9641E9DAULL, 0xB1F9F660802DEDF6ULL },
+    { 0xE1A63853BBD26451ULL, 0x5E7873F8A0396973ULL },
+    { 0x8D07E33455637EB2ULL, 0xDB0B487B6423E1E8ULL },
+    { 0xB049DC016ABC5E5FULL, 0x91CE1A9A3D2CDA62ULL },
+    { 0xDC5C5301C56B75F7ULL, 0x7641A140CC7810FBULL },
+    { 0x89B9B3E11B6329BAULL, 0xA9E904C87FCB0A9DULL },
+    { 0xAC2820D9623BF429ULL, 0x546345FA9FBDCD44ULL },
+    { 0xD732290FBACAF133ULL, 0xA97C177947AD4095ULL },
+    { 0x867F59A9D4BED6C0ULL, 0x49ED8EABCCCC485DULL },
+    { 0xA81F301449EE8C70ULL, 0x5C68F256BFFF5A74ULL },
+    { 0xD226FC195C6A2F8CULL, 0x73832EEC6FFF3111ULL },
+    { 0x83585D8FD9C25DB7ULL, 0xC831FD53C5FF7EABULL },
+    { 0xA42E74F3D032F525ULL, 0xBA3E7CA8B77F5E55ULL },
+    { 0xCD3A1230C43FB26FULL, 0x28CE1BD2E55F35EBULL },
+    { 0x80444B5E7AA7CF85ULL, 0x7980D163CF5B81B3ULL },
+    { 0xA0555E361951C366ULL, 0xD7E105BCC332621FULL },
+    { 0xC86AB5C39FA63440ULL, 0x8DD9472BF3FEFAA7ULL },
+    { 0xFA856334878FC150ULL, 0xB14F98F6F0FEB951ULL },
+    { 0x9C935E00D4B9D8D2ULL, 0x6ED1BF9A569F33D3ULL },
+    { 0xC3B8358109E84F07ULL, 0x0A862F80EC4700C8ULL },
+    { 0xF4A642E14C6262C8ULL, 0xCD27BB612758C0FAULL },
+    { 0x98E7E9CCCFBD7DBDULL, 0x8038D51CB897789CULL },
+    { 0xBF21E44003ACDD2CULL, 0xE0470A63E6BD56C3ULL },
+    { 0xEEEA5D5004981478ULL, 0x1858CCFCE06CAC74ULL },
+    { 0x95527A5202DF0CCBULL, 0x0F37801E0C43EBC8ULL },
+    { 0xBAA718E68396CFFDULL, 0xD30560258F54E6BAULL },
+    { 0xE950DF20247C83FDULL, 0x47C6B82EF32A2069ULL },
+    { 0x91D28B7416CDD27EULL, 0x4CDC331D57FA5441ULL },
+    { 0xB6472E511C81471DULL, 0xE0133FE4ADF8E952ULL },
+    { 0xE3D8F9E563A198E5ULL, 0x58180FDDD97723A6ULL },
+    { 0x8E679C2F5E44FF8FULL, 0x570F09EAA7EA7648ULL }
+};
+
+
+/**
+ * Convert w * 10^q to the bits of the nearest double using the
+ * Eisel-Lemire algorithm
+ *
+ * w must not be zero
+ */
+static uint64_t sstr_eisel_lemire(
+    uint64_t w,
+    int64_t  q
+)
+{
+    uint64_t ieee_bits;
+
+    if (q < SSTR_POW10_MIN)
+    {
+        ieee_bits = 0;
+    }
+    else
+    if (q > SSTR_POW10_MAX)
+    {
+        ieee_bits = SSTR_DOUBLE_INF_BITS;
+    }
+    else
+    {
+        int32_t leading_zeros = 0;
+        while ((w & (((uint64_t) 1) << 63)) == 0)
+        {
+            w <<= 1;
+            ++leading_zeros;
+        }
+
+        // 128 bit approximation of w * 5^q; the second half of the power
+        // of 5 only matters if the bits below the result's 55 bits
+        // might carry into them
+        const uint64_t *pow5 = sstr_pow5_128[q - SSTR_POW10_MIN];
+        uint64_t prod_high;
+        uint64_t prod_low = sstr_umul128(w, pow5[0], &prod_high);
+        if ((prod_high & 0x1FF) == 0x1FF)
+        {
+            uint64_t second_high;
+            sstr_umul128(w, pow5[1], &second_high);
+            prod_low += second_high;
+            if (second_high > prod_low)
+            {
+                ++prod_high;
+            }
+        }
+
+        int32_t  upper_bit = (int32_t) (prod_high >> 63);
+        int32_t  shift     = upper_bit + 64 - SSTR_DOUBLE_MANTISSA_BITS - 3;
+        uint64_t mantissa  = prod_high >> shift;
+        // floor(log2(10^q)) + 63 + the normalization shifts + bias
+        int32_t  power2    = (int32_t) ((((152170 + 65536) * q) >> 16) + 63) +
+                             upper_bit - leading_zeros + SSTR_DOUBLE_BIAS;
+
+        if (power2 <= 0)
+        {
+            // subnormal or zero
+            if (-power2 + 1 >= 64)
+            {
+                ieee_bits = 0;
+            }
+            else
+            {
+                mantissa >>= -power2 + 1;
+                mantissa += mantissa & 1;
+                mantissa >>= 1;
+                // rounding up may produce the smallest normal number,
+                // whose exponent field is 1 and carried in by the mantissa
+                ieee_bits = mantissa;
+            }
+        }
+        else
+        {
+            // exactly halfway between two doubles, which is only possible
+            // for small q: round to even instead of up
+            if (prod_low <= 1 && q >= -4 && q <= 23 && (mantissa & 3) == 1 &&
+                (mantissa << shift) == prod_high)
+            {
+                mantissa &= ~((uint64_t) 1);
+            }
+
+            mantissa += mantissa & 1;
+            mantissa >>= 1;
+            if (mantissa >= (((uint64_t) 2) << SSTR_DOUBLE_MANTISSA_BITS))
+            {
+                mantissa = ((uint64_t) 1) << SSTR_DOUBLE_MANTISSA_BITS;
+                ++power2;
+            }
+            mantissa &= ~(((uint64_t) 1) << SSTR_DOUBLE_MANTISSA_BITS);
+
+            if (power2 >= 0x7FF)
+            {
+                ieee_bits = SSTR_DOUBLE_INF_BITS;
+            }
+            else
+            {
+                ieee_bits = (((uint64_t) power2) << SSTR_DOUBLE_MANTISSA_BITS) | mantissa;
+            }
+        }
+    }
+
+    return ieee_bits;
+}
+
+
+/**
+ * num = num * factor + addend
+ */
+static void sstr_bignum_mul_add(
+    sstr_bignum *num,
+    uint32_t    factor,
+    uint32_t    addend
+)
+{
+    uint64_t carry = addend;
+    for (size_t limb_idx = 0; limb_idx < num->count; ++limb_idx)
+    {
+        uint64_t product = (uint64_t) num->limbs[limb_idx] * factor + carry;
+        num->limbs[limb_idx] = (uint32_t) product;
+        carry = product >> 32;
+    }
+    if (carry != 0 && num->count < SSTR_BIGNUM_LIMBS)
+    {
+        num->limbs[num->count] = (uint32_t) carry;
+        ++num->count;
+    }
+}
+
+
+/**
+ * num = num * 5^exp
+ */
+static void sstr_bignum_mul_pow5(
+    sstr_bignum *num,
+    int64_t     exp
+)
+{
+    // 5^13 is the largest power of 5 that fits into a limb
+    static const uint32_t pow5[14] =
+    {
+        1, 5, 25, 125, 625, 3125, 15625, 78125, 390625, 1953125, 9765625,
+        48828125, 244140625, 1220703125
+    };
+
+    while (exp >= 13)
+    {
+        sstr_bignum_mul_add(num, pow5[13], 0);
+        exp -= 13;
+    }
+    if (exp > 0)
+    {
+        sstr_bignum_mul_add(num, pow5[exp], 0);
+    }
+}
+
+
+/**
+ * num = num * 2^exp
+ */
+static void sstr_bignum_shl(
+    sstr_bignum *num,
+    int64_t     exp
+)
+{
+    size_t   limb_shift = (size_t) (exp / 32);
+    unsigned bit_shift  = (unsigned) (exp % 32);
+
+    if (num->count > 0 && num->count + limb_shift + 1 <= SSTR_BIGNUM_LIMBS)
+    {
+        num->limbs[num->count] = 0;
+        for (size_t limb_idx = num->count + 1; limb_idx > 0; --limb_idx)
+        {
+            uint32_t limb = num->limbs[limb_idx - 1] << bit_shift;
+            if (bit_shift > 0 && limb_idx >= 2)
+            {
+                limb |= num->limbs[limb_idx - 2] >> (32 - bit_shift);
+            }
+            num->limbs[limb_idx - 1 + limb_shift] = limb;
+        }
+        for (size_t limb_idx = 0; limb_idx < limb_shift; ++limb_idx)
+        {
+            num->limbs[limb_idx] = 0;
+        }
+
+        num->count += limb_shift + 1;
+        while (num->count > 0 && num->limbs[num->count - 1] == 0)
+        {
+            --num->count;
+        }
+    }
+}
+
+
+/**
+ * Three-way comparison of two big integers
+ */
+static int sstr_bignum_cmp(
+    const sstr_bignum *num_a,
+    const sstr_bignum *num_b
+)
+{
+    int order = 0;
+
+    if (num_a->count != num_b->count)
+    {
+        order = num_a->count < num_b->count ? -1 : 1;
+    }
+    else
+    {
+        for (size_t limb_idx = num_a->count; limb_idx > 0 && order == 0; --limb_idx)
+        {
+            if (num_a->limbs[limb_idx - 1] != num_b->limbs[limb_idx - 1])
+            {
+                order = num_a->limbs[limb_idx - 1] < num_b->limbs[limb_idx - 1] ? -1 : 1;
+            }
+        }
+    }
+
+    return order;
+}
+
+
+/**
+ * Decide between the double lower_bits and the next larger double
+ * by comparing all digits of the decimal number with the halfway point
+ * between them
+ */
+static uint64_t sstr_decimal_round(
+    const sstr_decimal *decimal,
+    uint64_t           lower_bits
+)
+{
+    // the halfway point is (2 * mantissa + 1) * 2^(bin_exp - 1)
+    uint64_t mantissa  = lower_bits & ((((uint64_t) 1) << SSTR_DOUBLE_MANTISSA_BITS) - 1);
+    int64_t  exp_field = (int64_t) (lower_bits >> SSTR_DOUBLE_MANTISSA_BITS);
+    int64_t  bin_exp   = 1 - SSTR_DOUBLE_BIAS - SSTR_DOUBLE_MANTISSA_BITS;
+    if (exp_field != 0)
+    {
+        mantissa |= ((uint64_t) 1) << SSTR_DOUBLE_MANTISSA_BITS;
+        bin_exp   = exp_field - SSTR_DOUBLE_BIAS - SSTR_DOUBLE_MANTISSA_BITS;
+    }
+
+    sstr_bignum halfway;
+    uint64_t    halfway_value = 2 * mantissa + 1;
+    halfway.limbs[0] = (uint32_t) halfway_value;
+    halfway.limbs[1] = (uint32_t) (halfway_value >> 32);
+    halfway.count    = halfway.limbs[1] != 0 ? 2 : 1;
+
+    // the digits as an integer, 9 digits per multiplication; digits beyond
+    // SSTR_DECIMAL_DIGITS_MAX only decide whether the number is exactly
+    // halfway, so they are replaced by a single non-zero digit
+    sstr_bignum digits;
+    digits.count = 0;
+    size_t   used_len    = 0;
+    int      truncated   = 0;
+    uint32_t chunk       = 0;
+    uint32_t chunk_scale = 1;
+    for (size_t char_idx = 0; char_idx < decimal->int_len + decimal->frac_len; ++char_idx)
+    {
+        char digit = char_idx < decimal->int_len ?
+                     decimal->int_chars[char_idx] :
+                     decimal->frac_chars[char_idx - decimal->int_len];
+        if (used_len == 0 && digit == '0')
+        {
+            // leading zero
+        }
+        else
+        if (used_len < SSTR_DECIMAL_DIGITS_MAX)
+        {
+            chunk = chunk * 10 + (uint32_t) (digit - '0');
+            chunk_scale *= 10;
+            ++used_len;
+            if (chunk_scale == 1000000000)
+            {
+                sstr_bignum_mul_add(&digits, chunk_scale, chunk);
+                chunk       = 0;
+                chunk_scale = 1;
+            }
+        }
+        else
+        if (digit != '0')
+        {
+            truncated = 1;
+        }
+    }
+    if (truncated != 0)
+    {
+        chunk = chunk * 10 + 1;
+        chunk_scale *= 10;
+    }
+    if (chunk_scale > 1)
+    {
+        sstr_bignum_mul_add(&digits, chunk_scale, chunk);
+    }
+
+    int64_t dec_exp = decimal->exp_value - (int64_t) decimal->frac_len +
+                      (int64_t) (decimal->digits_len - used_len) - (truncated != 0 ? 1 : 0);
+
+    // compare digits * 5^dec_exp * 2^dec_exp with halfway * 2^(bin_exp - 1)
+    if (dec_exp >= 0)
+    {
+        sstr_bignum_mul_pow5(&digits, dec_exp);
+    }
+    else
+    {
+        sstr_bignum_mul_pow5(&halfway, -dec_exp);
+    }
+    int64_t shift = dec_exp - (bin_exp - 1);
+    if (shift >= 0)
+    {
+        sstr_bignum_shl(&digits, shift);
+    }
+    else
+    {
+        sstr_bignum_shl(&halfway, -shift);
+    }
+
+    int order = sstr_bignum_cmp(&digits, &halfway);
+    if (order > 0 || (order == 0 && (mantissa & 1) != 0))
+    {
+        // the next double, possibly infinity
+        ++lower_bits;
+    }
+
+    return lower_bits;
+}
+
+
+/**
+ * Check whether a string matches a lowercase word, ignoring case
+ */
+static int sstr_match_nocase(
+    const char *src_chars,
+    size_t     src_len,
+    const char *word
+)
+{
+    int    is_match = src_len == strlen(word);
+    size_t char_idx = 0;
+    while (is_match != 0 && char_idx < src_len)
+    {
+        is_match = (src_chars[char_idx] | 0x20) == word[char_idx];
+        ++char_idx;
+    }
+
+    return is_match;
+}
+
+
+/**
+ * Convert a string to a double
+ */
+static sstr_rc sstr_parse_double(
+    const char *src_chars,
+    size_t     src_len,
+    double     *dst_value
+)
+{
+    sstr_rc  sstr_status = SSTR_FAIL;
+    uint64_t ieee_bits   = 0;
+
+    size_t src_idx  = 0;
+    int    negative = 0;
+    if (src_idx < src_len && (src_chars[src_idx] == '-' || src_chars[src_idx] == '+'))
+    {
+        negative = src_chars[src_idx] == '-';
+        ++src_idx;
+    }
+
+    if (src_idx < src_len && src_chars[src_idx] != '.' &&
+        (src_chars[src_idx] < '0' || src_chars[src_idx] > '9'))
+    {
+        // special values
+        if (sstr_match_nocase(&(src_chars[src_idx]), src_len - src_idx, "inf") ||
+            sstr_match_nocase(&(src_chars[src_idx]), src_len - src_idx, "infinity"))
+        {
+            ieee_bits   = SSTR_DOUBLE_INF_BITS;
+            sstr_status = SSTR_PASS;
+        }
+        else
+        if (sstr_match_nocase(&(src_chars[src_idx]), src_len - src_idx, "nan"))
+        {
+            ieee_bits   = SSTR_DOUBLE_NAN_BITS;
+            sstr_status = SSTR_PASS;
+        }
+    }
+    else
+    {
+        sstr_decimal decimal;
+        uint64_t     w = 0;
+
+        decimal.int_chars = &(src_chars[src_idx]);
+        decimal.int_len   = sstr_scan_digits(src_chars, src_len, &src_idx, &w);
+        decimal.frac_chars = &(src_chars[src_idx]);
+        decimal.frac_len   = 0;
+        if (src_idx < src_len && src_chars[src_idx] == '.')
+        {
+            ++src_idx;
+            decimal.frac_chars = &(src_chars[src_idx]);
+            decimal.frac_len   = sstr_scan_digits(src_chars, src_len, &src_idx, &w);
+        }
+        int syntax_ok = decimal.int_len + decimal.frac_len > 0;
+
+        decimal.exp_value = 0;
+        if (syntax_ok && src_idx < src_len && (src_chars[src_idx] | 0x20) == 'e')
+        {
+            ++src_idx;
+            int exp_negative = 0;
+            if (src_idx < src_len && (src_chars[src_idx] == '-' || src_chars[src_idx] == '+'))
+            {
+                exp_negative = src_chars[src_idx] == '-';
+                ++src_idx;
+            }
+            size_t exp_idx = src_idx;
+            while (src_idx < src_len && src_chars[src_idx] >= '0' && src_chars[src_idx] <= '9')
+            {
+                // saturate far beyond the range of doubles
+                if (decimal.exp_value < 0x10000000)
+                {
+                    decimal.exp_value = decimal.exp_value * 10 + (src_chars[src_idx] - '0');
+                }
+                ++src_idx;
+            }
+            syntax_ok = src_idx > exp_idx;
+            if (exp_negative)
+            {
+                decimal.exp_value = -decimal.exp_value;
+            }
+        }
+
+        if (syntax_ok && src_idx == src_len)
+        {
+            // leading zeros are not significant
+            size_t zeros_len = 0;
+            while (zeros_len < decimal.int_len && decimal.int_chars[zeros_len] == '0')
+            {
+                ++zeros_len;
+            }
+            if (zeros_len == decimal.int_len)
+            {
+                while (zeros_len < decimal.int_len + decimal.frac_len &&
+                       decimal.frac_chars[zeros_len - decimal.int_len] == '0')
+                {
+                    ++zeros_len;
+                }
+            }
+            decimal.digits_len = decimal.int_len + decimal.frac_len - zeros_len;
+
+            int64_t q = decimal.exp_value - (int64_t) decimal.frac_len;
+            if (decimal.digits_len == 0)
+            {
+                ieee_bits = 0;
+            }
+            else
+            if (decimal.digits_len <= 19)
+            {
+                int fast_path = 0;
+                #if defined(FLT_EVAL_METHOD) && FLT_EVAL_METHOD == 0
+                // both w and 10^q are exact, so a single rounding occurs
+                if (q >= -22 && q <= 22 && w <= (((uint64_t) 1) << 53))
+                {
+                    double value = (double) w;
+                    value = q < 0 ? value / sstr_pow10_exact[-q] : value * sstr_pow10_exact[q];
+                    memcpy(&ieee_bits, &value, sizeof (ieee_bits));
+                    fast_path = 1;
+                }
+                #endif /* FLT_EVAL_METHOD == 0 */
+                if (fast_path == 0)
+                {
+                    ieee_bits = sstr_eisel_lemire(w, q);
+                }
+            }
+            else
+            {
+                // the first 19 significant digits bound the number
+                // from below, and plus one from above
+                w = 0;
+                size_t used_len = 0;
+                for (size_t char_idx = zeros_len; used_len < 19; ++char_idx)
+                {
+                    char digit = char_idx < decimal.int_len ?
+                                 decimal.int_chars[char_idx] :
+                                 decimal.frac_chars[char_idx - decimal.int_len];
+                    w = w * 10 + (uint64_t) (digit - '0');
+                    ++used_len;
+                }
+                q += (int64_t) (decimal.digits_len - used_len);
+
+                ieee_bits = sstr_eisel_lemire(w, q);
+                if (ieee_bits != sstr_eisel_lemire(w + 1, q))
+                {
+                    ieee_bits = sstr_decimal_round(&decimal, ieee_bits);
+                }
+            }
+
+            sstr_status = ieee_bits == SSTR_DOUBLE_INF_BITS ? SSTR_RANGE : SSTR_PASS;
+        }
+    }
+
+    if (sstr_status == SSTR_PASS)
+    {
+        if (negative)
+        {
+            ieee_bits |= ((uint64_t) 1) << 63;
+        }
+        memcpy(dst_value, &ieee_bits, sizeof (ieee_bits));
+    }
+
+    return sstr_status;
+}
+
+
+/*
+ * Hexadecimal and Base64 encoding
+ *
+ * The SIMD kernels validate and translate characters with range compares
+ * (SSE2, AVX2); Base64 additionally uses byte shuffles (SSSE3, AVX2) to
+ * regroup 6 bit values (Wojciech Mula, Daniel Lemire, "Faster Base64
+ * Encoding and Decoding Using AVX2 Instructions", 2018).
+ */
+
+#ifdef __SSE2__
+/**
+ * Convert nibbles to lowercase hexadecimal digits
+ */
+static __m128i sstr_hex_digits_sse2(
+    __m128i nibbles
+)
+{
+    // '0' + n, plus the distance from '9' + 1 to 'a' for n > 9
+    __m128i above9 = _mm_cmpgt_epi8(nibbles, _mm_set1_epi8(9));
+    return _mm_add_epi8(_mm_add_epi8(nibbles, _mm_set1_epi8('0')),
+                        _mm_and_si128(above9, _mm_set1_epi8('a' - '0' - 10)));
+}
+
+
+/**
+ * Convert hexadecimal digits to nibbles
+ *
+ * Chars that are not hexadecimal digits are converted to 0xFF
+ */
+static __m128i sstr_hex_nibbles_sse2(
+    __m128i chars
+)
+{
+    // bytes above 0x7F are negative and therefore outside both ranges
+    __m128i lower  = _mm_or_si128(chars, _mm_set1_epi8(0x20));
+    __m128i digit  = _mm_and_si128(_mm_cmpgt_epi8(chars, _mm_set1_epi8('0' - 1)),
+                                   _mm_cmplt_epi8(chars, _mm_set1_epi8('9' + 1)));
+    __m128i letter = _mm_and_si128(_mm_cmpgt_epi8(lower, _mm_set1_epi8('a' - 1)),
+                                   _mm_cmplt_epi8(lower, _mm_set1_epi8('f' + 1)));
+
+    __m128i nibbles = _mm_or_si128(
+        _mm_and_si128(digit, _mm_sub_epi8(chars, _mm_set1_epi8('0'))),
+        _mm_and_si128(letter, _mm_sub_epi8(lower, _mm_set1_epi8('a' - 10)))
+    );
+    __m128i invalid = _mm_cmpeq_epi8(_mm_or_si128(digit, letter), _mm_setzero_si128());
+    return _mm_or_si128(nibbles, invalid);
+}
+
+
+/**
+ * Convert Base64 characters to 6 bit values
+ *
+ * Chars that are not part of the alphabet are converted to 0xFF
+ */
+static __m128i sstr_b64_values_sse2(
+    __m128i    chars,
+    const char *alphabet
+)
+{
+    __m128i upper = _mm_and_si128(_mm_cmpgt_epi8(chars, _mm_set1_epi8('A' - 1)),
+                                  _mm_cmplt_epi8(chars, _mm_set1_epi8('Z' + 1)));
+    __m128i lower = _mm_and_si128(_mm_cmpgt_epi8(chars, _mm_set1_epi8('a' - 1)),
+                                  _mm_cmplt_epi8(chars, _mm_set1_epi8('z' + 1)));
+    __m128i digit = _mm_and_si128(_mm_cmpgt_epi8(chars, _mm_set1_epi8('0' - 1)),
+                                  _mm_cmplt_epi8(chars, _mm_set1_epi8('9' + 1)));
+    __m128i is62  = _mm_cmpeq_epi8(chars, _mm_set1_epi8(alphabet[62]));
+    __m128i is63  = _mm_cmpeq_epi8(chars, _mm_set1_epi8(alphabet[63]));
+
+    __m128i values = _mm_and_si128(upper, _mm_sub_epi8(chars, _mm_set1_epi8('A')));
+    values = _mm_or_si128(values, _mm_and_si128(lower, _mm_sub_epi8(chars, _mm_set1_epi8('a' - 26))));
+    values = _mm_or_si128(values, _mm_and_si128(digit, _mm_add_epi8(chars, _mm_set1_epi8(52 - '0'))));
+    values = _mm_or_si128(values, _mm_and_si128(is62, _mm_set1_epi8(62)));
+    values = _mm_or_si128(values, _mm_and_si128(is63, _mm_set1_epi8(63)));
+
+    __m128i valid = _mm_or_si128(_mm_or_si128(upper, lower),
+                                 _mm_or_si128(digit, _mm_or_si128(is62, is63)));
+    return _mm_or_si128(values, _mm_cmpeq_epi8(valid, _mm_setzero_si128()));
+}
+#endif /* __SSE2__ */
+
+
+#ifdef __AVX2__
+/**
+ * Convert nibbles to lowercase hexadecimal digits
+ */
+static __m256i sstr_hex_digits_avx2(
+    __m256i nibbles
+)
+{
+    __m256i above9 = _mm256_cmpgt_epi8(nibbles, _mm256_set1_epi8(9));
+    return _mm256_add_epi8(_mm256_add_epi8(nibbles, _mm256_set1_epi8('0')),
+                           _mm256_and_si256(above9, _mm256_set1_epi8('a' - '0' - 10)));
+}
+
+
+/**
+ * Convert hexadecimal digits to nibbles
+ *
+ * Chars that are not hexadecimal digits are converted to 0xFF
+ */
+static __m256i sstr_hex_nibbles_avx2(
+    __m256i chars
+)
+{
+    __m256i lower  = _mm256_or_si256(chars, _mm256_set1_epi8(0x20));
+    __m256i digit  = _mm256_and_si256(_mm256_cmpgt_epi8(chars, _mm256_set1_epi8('0' - 1)),
+                                      _mm256_cmpgt_epi8(_mm256_set1_epi8('9' + 1), chars));
+    __m256i letter = _mm256_and_si256(_mm256_cmpgt_epi8(lower, _mm256_set1_epi8('a' - 1)),
+                                      _mm256_cmpgt_epi8(_mm256_set1_epi8('f' + 1), lower));
+
+    __m256i nibbles = _mm256_or_si256(
+        _mm256_and_si256(digit, _mm256_sub_epi8(chars, _mm256_set1_epi8('0'))),
+        _mm256_and_si256(letter, _mm256_sub_epi8(lower, _mm256_set1_epi8('a' - 10)))
+    );
+    __m256i invalid = _mm256_cmpeq_epi8(_mm256_or_si256(digit, letter), _mm256_setzero_si256());
+    return _mm256_or_si256(nibbles, invalid);
+}
+
+
+/**
+ * Convert Base64 characters to 6 bit values
+ *
+ * Chars that are not part of the alphabet are converted to 0xFF
+ */
+static __m256i sstr_b64_values_avx2(
+    __m256i    chars,
+    const char *alphabet
+)
+{
+    __m256i upper = _mm256_and_si256(_mm256_cmpgt_epi8(chars, _mm256_set1_epi8('A' - 1)),
+                                     _mm256_cmpgt_epi8(_mm256_set1_epi8('Z' + 1), chars));
+    __m256i lower = _mm256_and_si256(_mm256_cmpgt_epi8(chars, _mm256_set1_epi8('a' - 1)),
+                                     _mm256_cmpgt_epi8(_mm256_set1_epi8('z' + 1), chars));
+    __m256i digit = _mm256_and_si256(_mm256_cmpgt_epi8(chars, _mm256_set1_epi8('0' - 1)),
+                                     _mm256_cmpgt_epi8(_mm256_set1_epi8('9' + 1), chars));
+    __m256i is62  = _mm256_cmpeq_epi8(chars, _mm256_set1_epi8(alphabet[62]));
+    __m256i is63  = _mm256_cmpeq_epi8(chars, _mm256_set1_epi8(alphabet[63]));
+
+    __m256i values = _mm256_and_si256(upper, _mm256_sub_epi8(chars, _mm256_set1_epi8('A')));
+    values = _mm256_or_si256(values, _mm256_and_si256(lower, _mm256_sub_epi8(chars, _mm256_set1_epi8('a' - 26))));
+    values = _mm256_or_si256(values, _mm256_and_si256(digit, _mm256_add_epi8(chars, _mm256_set1_epi8(52 - '0'))));
+    values = _mm256_or_si256(values, _mm256_and_si256(is62, _mm256_set1_epi8(62)));
+    values = _mm256_or_si256(values, _mm256_and_si256(is63, _mm256_set1_epi8(63)));
+
+    __m256i valid = _mm256_or_si256(_mm256_or_si256(upper, lower),
+                                    _mm256_or_si256(digit, _mm256_or_si256(is62, is63)));
+    return _mm256_or_si256(values, _mm256_cmpeq_epi8(valid, _mm256_setzero_si256()));
+}
+#endif /* __AVX2__ */
+
+
+#ifdef __SSSE3__
+/**
+ * Encode 12 bytes as 16 Base64 characters (Mula's algorithm)
+ */
+static __m128i sstr_b64_encode_ssse3(
+    __m128i    bytes,
+    const char *alphabet
+)
+{
+    // spread each 3 byte group over 4 bytes, then move the 6 bit
+    // values into the low bits of each byte
+    bytes = _mm_shuffle_epi8(bytes, _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+    __m128i values = _mm_or_si128(
+        _mm_mulhi_epu16(_mm_and_si128(bytes, _mm_set1_epi32(0x0FC0FC00)), _mm_set1_epi32(0x04000040)),
+        _mm_mullo_epi16(_mm_and_si128(bytes, _mm_set1_epi32(0x003F03F0)), _mm_set1_epi32(0x01000010))
+    );
+
+    // map the ranges 0-25, 26-51, 52-61, 62 and 63 to the offset
+    // that turns the value into its character
+    __m128i offset_idx = _mm_subs_epu8(values, _mm_set1_epi8(51));
+    offset_idx = _mm_or_si128(offset_idx, _mm_and_si128(_mm_cmpgt_epi8(_mm_set1_epi8(26), values),
+                                                        _mm_set1_epi8(13)));
+    __m128i offsets = _mm_setr_epi8(
+        'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+        '0' - 52, '0' - 52, '0' - 52, (char) (alphabet[62] - 62), (char) (alphabet[63] - 63),
+        'A', 0, 0
+    );
+    return _mm_add_epi8(values, _mm_shuffle_epi8(offsets, offset_idx));
+}
+#endif /* __SSSE3__ */
+
+
+#ifdef __SSE2__
+/**
+ * Store 16 6 bit values as 12 bytes
+ *
+ * Writes 16 bytes; the last 4 are overwritten by subsequent output
+ */
+static void sstr_b64_store_sse2(
+    __m128i values,
+    char    *dst_chars
+)
+{
+    #ifdef __SSSE3__
+    // combine pairs of values into 12 bits, then pairs of those into 24 bits
+    __m128i pairs  = _mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140));
+    __m128i groups = _mm_madd_epi16(pairs, _mm_set1_epi32(0x00011000));
+    _mm_storeu_si128((__m128i *) dst_chars,
+                     _mm_shuffle_epi8(groups, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12,
+                                                            -1, -1, -1, -1)));
+    #else
+    // each 32 bit lane holds the values a, b, c, d in its bytes from
+    // low to high; combine them into the three bytes of the group in
+    // output order
+    __m128i mask6 = _mm_set1_epi32(0x3F);
+    __m128i value_a = _mm_and_si128(values, mask6);
+    __m128i value_b = _mm_and_si128(_mm_srli_epi32(values, 8), mask6);
+    __m128i value_c = _mm_and_si128(_mm_srli_epi32(values, 16), mask6);
+    __m128i value_d = _mm_srli_epi32(values, 24);
+
+    __m128i byte0 = _mm_or_si128(_mm_slli_epi32(value_a, 2), _mm_srli_epi32(value_b, 4));
+    __m128i byte1 = _mm_and_si128(_mm_or_si128(_mm_slli_epi32(value_b, 4), _mm_srli_epi32(value_c, 2)),
+                                  _mm_set1_epi32(0xFF));
+    __m128i byte2 = _mm_and_si128(_mm_or_si128(_mm_slli_epi32(value_c, 6), value_d),
+                                  _mm_set1_epi32(0xFF));
+    __m128i groups = _mm_or_si128(byte0, _mm_or_si128(_mm_slli_epi32(byte1, 8),
+                                                      _mm_slli_epi32(byte2, 16)));
+
+    for (size_t group_idx = 0; group_idx < 4; ++group_idx)
+    {
+        uint32_t group = (uint32_t) _mm_cvtsi128_si32(groups);
+        memcpy(&(dst_chars[group_idx * 3]), &group, sizeof (group));
+        groups = _mm_srli_si128(groups, 4);
+    }
+    #endif /* __SSSE3__ */
+}
+#endif /* __SSE2__ */
+
+
+#ifdef __AVX2__
+/**
+ * Encode 2 x 12 bytes, one group in each 128 bit lane,
+ * as 32 Base64 characters
+ */
+static __m256i sstr_b64_encode_avx2(
+    __m256i    bytes,
+    const char *alphabet
+)
+{
+    bytes = _mm256_shuffle_epi8(bytes, _mm256_set_epi8(
+        10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1,
+        10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1
+    ));
+    __m256i values = _mm256_or_si256(
+        _mm256_mulhi_epu16(_mm256_and_si256(bytes, _mm256_set1_epi32(0x0FC0FC00)),
+                           _mm256_set1_epi32(0x04000040)),
+        _mm256_mullo_epi16(_mm256_and_si256(bytes, _mm256_set1_epi32(0x003F03F0)),
+                           _mm256_set1_epi32(0x01000010))
+    );
+
+    __m256i offset_idx = _mm256_subs_epu8(values, _mm256_set1_epi8(51));
+    offset_idx = _mm256_or_si256(offset_idx,
+                                 _mm256_and_si256(_mm256_cmpgt_epi8(_mm256_set1_epi8(26), values),
+                                                  _mm256_set1_epi8(13)));
+    __m256i offsets = _mm256_setr_epi8(
+        'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+        '0' - 52, '0' - 52, '0' - 52, (char) (alphabet[62] - 62), (char) (alphabet[63] - 63),
+        'A', 0, 0,
+        'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+        '0' - 52, '0' - 52, '0' - 52, (char) (alphabet[62] - 62), (char) (alphabet[63] - 63),
+        'A', 0, 0
+    );
+    return _mm256_add_epi8(values, _mm256_shuffle_epi8(offsets, offset_idx));
+}
+
+
+/**
+ * Pack 32 6 bit values into 24 bytes at the start of the vector
+ */
+static __m256i sstr_b64_pack_avx2(
+    __m256i values
+)
+{
+    __m256i pairs  = _mm256_maddubs_epi16(values, _mm256_set1_epi32(0x01400140));
+    __m256i groups = _mm256_madd_epi16(pairs, _mm256_set1_epi32(0x00011000));
+    groups = _mm256_shuffle_epi8(groups, _mm256_setr_epi8(
+        2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+        2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1
+    ));
+    // join the 12 bytes of both lanes
+    return _mm256_permutevar8x32_epi32(groups, _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7));
+}
+#endif /* __AVX2__ */
+
+
+/**
+ * Value of a hexadecimal digit, or -1
+ */
+static int sstr_hex_value(
+    char hex_char
+)
+{
+    int value = -1;
+    if (hex_char >= '0' && hex_char <= '9')
+    {
+        value = hex_char - '0';
+    }
+    else
+    if ((hex_char | 0x20) >= 'a' && (hex_char | 0x20) <= 'f')
+    {
+        value = (hex_char | 0x20) - 'a' + 10;
+    }
+
+    return value;
+}
+
+
+/**
+ * Value of a Base64 character, or -1
+ */
+static int sstr_b64_value(
+    char       b64_char,
+    const char *alphabet
+)
+{
+    int value = -1;
+    if (b64_char >= 'A' && b64_char <= 'Z')
+    {
+        value = b64_char - 'A';
+    }
+    else
+    if (b64_char >= 'a' && b64_char <= 'z')
+    {
+        value = b64_char - 'a' + 26;
+    }
+    else
+    if (b64_char >= '0' && b64_char <= '9')
+    {
+        value = b64_char - '0' + 52;
+    }
+    else
+    if (b64_char == alphabet[62])
+    {
+        value = 62;
+    }
+    else
+    if (b64_char == alphabet[63])
+    {
+        value = 63;
+    }
+
+    return value;
+}
+
+
+/**
+ * Encode src_len bytes as 2 * src_len hexadecimal digits
+ */
+static void sstr_hex_encode_chars(
+    const char *src_chars,
+    size_t     src_len,
+    char       *dst_chars
+)
+{
+    size_t src_idx = 0;
+
+    #ifdef __AVX2__
+    for (; src_len - src_idx >= 32; src_idx += 32)
+    {
+        __m256i bytes = _mm256_loadu_si256((const __m256i *) &(src_chars[src_idx]));
+        __m256i high  = _mm256_and_si256(_mm256_srli_epi16(bytes, 4), _mm256_set1_epi8(0x0F));
+        __m256i low   = _mm256_and_si256(bytes, _mm256_set1_epi8(0x0F));
+        // interleaving works within 128 bit lanes, so the lanes of
+        // both halves are swapped into place
+        __m256i first  = _mm256_unpacklo_epi8(high, low);
+        __m256i second = _mm256_unpackhi_epi8(high, low);
+        _mm256_storeu_si256((__m256i *) &(dst_chars[src_idx * 2]),
+                            sstr_hex_digits_avx2(_mm256_permute2x128_si256(first, second, 0x20)));
+        _mm256_storeu_si256((__m256i *) &(dst_chars[src_idx * 2 + 32]),
+                            sstr_hex_digits_avx2(_mm256_permute2x128_si256(first, second, 0x31)));
+    }
+    #endif /* __AVX2__ */
+
+    #ifdef __SSE2__
+    for (; src_len - src_idx >= 16; src_idx += 16)
+    {
+        __m128i bytes = _mm_loadu_si128((const __m128i *) &(src_chars[src_idx]));
+        __m128i high  = _mm_and_si128(_mm_srli_epi16(bytes, 4), _mm_set1_epi8(0x0F));
+        __m128i low   = _mm_and_si128(bytes, _mm_set1_epi8(0x0F));
+        _mm_storeu_si128((__m128i *) &(dst_chars[src_idx * 2]),
+                         sstr_hex_digits_sse2(_mm_unpacklo_epi8(high, low)));
+        _mm_storeu_si128((__m128i *) &(dst_chars[src_idx * 2 + 16]),
+                         sstr_hex_digits_sse2(_mm_unpackhi_epi8(high, low)));
+    }
+    #endif /* __SSE2__ */
+
+    for (; src_idx < src_len; ++src_idx)
+    {
+        unsigned char src_byte = (unsigned char) src_chars[src_idx];
+        dst_chars[src_idx * 2]     = sstr_hex_digits[src_byte >> 4];
+        dst_chars[src_idx * 2 + 1] = sstr_hex_digits[src_byte & 0x0F];
+    }
+}
+
+
+/**
+ * Decode an even number of hexadecimal digits
+ *
+ * Returns 0 if a char is not a hexadecimal digit
+ */
+static int sstr_hex_decode_chars(
+    const char *src_chars,
+    size_t     src_len,
+    char       *dst_chars
+)
+{
+    int    valid   = 1;
+    size_t src_idx = 0;
+
+    #ifdef __AVX2__
+    for (; valid && src_len - src_idx >= 32; src_idx += 32)
+    {
+        __m256i nibbles = sstr_hex_nibbles_avx2(
+                              _mm256_loadu_si256((const __m256i *) &(src_chars[src_idx])));
+        valid = _mm256_movemask_epi8(nibbles) == 0;
+        // each 16 bit lane holds the high nibble in its low byte
+        __m256i bytes = _mm256_or_si256(
+            _mm256_slli_epi16(_mm256_and_si256(nibbles, _mm256_set1_epi16(0x00FF)), 4),
+            _mm256_srli_epi16(nibbles, 8)
+        );
+        // packing works within 128 bit lanes; move the low halves of
+        // both lanes together
+        bytes = _mm256_permute4x64_epi64(_mm256_packus_epi16(bytes, bytes), 0x08);
+        _mm_storeu_si128((__m128i *) &(dst_chars[src_idx / 2]), _mm256_castsi256_si128(bytes));
+    }
+    #endif /* __AVX2__ */
+
+    #ifdef __SSE2__
+    for (; valid && src_len - src_idx >= 16; src_idx += 16)
+    {
+        __m128i nibbles = sstr_hex_nibbles_sse2(
+                              _mm_loadu_si128((const __m128i *) &(src_chars[src_idx])));
+        valid = _mm_movemask_epi8(nibbles) == 0;
+        __m128i bytes = _mm_or_si128(
+            _mm_slli_epi16(_mm_and_si128(nibbles, _mm_set1_epi16(0x00FF)), 4),
+            _mm_srli_epi16(nibbles, 8)
+        );
+        _mm_storel_epi64((__m128i *) &(dst_chars[src_idx / 2]), _mm_packus_epi16(bytes, bytes));
+    }
+    #endif /* __SSE2__ */
+
+    for (; valid && src_idx < src_len; src_idx += 2)
+    {
+        int high = sstr_hex_value(src_chars[src_idx]);
+        int low  = sstr_hex_value(src_chars[src_idx + 1]);
+        valid = high >= 0 && low >= 0;
+        dst_chars[src_idx / 2] = (char) (((high & 0x0F) << 4) | (low & 0x0F));
+    }
+
+    return valid;
+}
+
+
+/**
+ * Encode a secureString in Base64 with the specified alphabet
+ */
+static sstr_rc sstr_b64_encode_impl(
+    const sstring *src_str,
+    sstring       *dst_str,
+    const char    *alphabet,
+    int           padded
+)
+{
+    sstr_rc sstr_status = SSTR_FAIL;
+
+    if (src_str != NULL && dst_str != NULL && src_str != dst_str)
+    {
+        size_t groups_len = src_str->len / 3;
+        size_t tail_len   = src_str->len % 3;
+        // the first check keeps the length calculation from overflowing
+        if (groups_len <= dst_str->cap / 4)
+        {
+            size_t dst_len = groups_len * 4 +
+                             (tail_len == 0 ? 0 : (padded ? 4 : tail_len + 1));
+            if (dst_len <= dst_str->cap)
+            {
+                const char *src_chars = src_str->chars;
+                char       *dst_chars = dst_str->chars;
+                size_t     src_idx    = 0;
+                size_t     dst_idx    = 0;
+
+                #ifdef __AVX2__
+                // 24 bytes per round, loaded as two overlapping 16 byte halves
+                for (; src_str->len - src_idx >= 28; src_idx += 24, dst_idx += 32)
+                {
+                    __m256i bytes = _mm256_inserti128_si256(
+                        _mm256_castsi128_si256(_mm_loadu_si128((const __m128i *) &(src_chars[src_idx]))),
+                        _mm_loadu_si128((const __m128i *) &(src_chars[src_idx + 12])), 1
+                    );
+                    _mm256_storeu_si256((__m256i *) &(dst_chars[dst_idx]),
+                                        sstr_b64_encode_avx2(bytes, alphabet));
+                }
+                #endif /* __AVX2__ */
+
+                #ifdef __SSSE3__
+                // 12 bytes per round
+                for (; src_str->len - src_idx >= 16; src_idx += 12, dst_idx += 16)
+                {
+                    __m128i bytes = _mm_loadu_si128((const __m128i *) &(src_chars[src_idx]));
+                    _mm_storeu_si128((__m128i *) &(dst_chars[dst_idx]),
+                                     sstr_b64_encode_ssse3(bytes, alphabet));
+                }
+                #endif /* __SSSE3__ */
+
+                for (; src_str->len - src_idx >= 3; src_idx += 3, dst_idx += 4)
+                {
+                    uint32_t group = ((uint32_t) (unsigned char) src_chars[src_idx] << 16) |
+                                     ((uint32_t) (unsigned char) src_chars[src_idx + 1] << 8) |
+                                     (uint32_t) (unsigned char) src_chars[src_idx + 2];
+                    dst_chars[dst_idx]     = alphabet[group >> 18];
+                    dst_chars[dst_idx + 1] = alphabet[(group >> 12) & 0x3F];
+                    dst_chars[dst_idx + 2] = alphabet[(group >> 6) & 0x3F];
+                    dst_chars[dst_idx + 3] = alphabet[group & 0x3F];
+                }
+
+                if (tail_len > 0)
+                {
+                    uint32_t group = (uint32_t) (unsigned char) src_chars[src_idx] << 16;
+                    if (tail_len == 2)
+                    {
+                        group |= (uint32_t) (unsigned char) src_chars[src_idx + 1] << 8;
+                    }
+                    dst_chars[dst_idx++] = alphabet[group >> 18];
+                    dst_chars[dst_idx++] = alphabet[(group >> 12) & 0x3F];
+                    if (tail_len == 2)
+                    {
+                        dst_chars[dst_idx++] = alphabet[(group >> 6) & 0x3F];
+                    }
+                    while (padded && dst_idx < dst_len)
+                    {
+                        dst_chars[dst_idx++] = '=';
+                    }
+                }
+
+                // update destination secureString length
+                dst_str->len = dst_len;
+                // terminate destination secureString with a null-character
+                dst_str->chars[dst_str->len] = '\0';
+
+                sstr_status = SSTR_PASS;
+            }
+        }
+    }
+
+    return sstr_status;
+}
+
+
+/**
+ * Decode a Base64 secureString with the specified alphabet
+ *
+ * If padded is zero, padding is optional
+ */
+static sstr_rc sstr_b64_decode_impl(
+    const sstring *src_str,
+    sstring       *dst_str,
+    const char    *alphabet,
+    int           padded
+)
+{
+    sstr_rc sstr_status = SSTR_FAIL;
+
+    if (src_str != NULL && dst_str != NULL && src_str != dst_str)
+    {
+        const char *src_chars = src_str->chars;
+        size_t     src_len    = src_str->len;
+
+        // up to two padding characters complete the last group
+        size_t pad_len = 0;
+        while (pad_len < 2 && pad_len < src_len && src_chars[src_len - pad_len - 1] == '=')
+        {
+            ++pad_len;
+        }
+        size_t data_len = src_len - pad_len;
+        size_t tail_len = data_len % 4;
+
+        int length_ok = tail_len != 1;
+        if (pad_len > 0 || padded)
+        {
+            length_ok = length_ok && src_len % 4 == 0;
+        }
+
+        size_t dst_len = data_len / 4 * 3 + (tail_len > 0 ? tail_len - 1 : 0);
+        if (length_ok && dst_len <= dst_str->cap)
+        {
+            char   *dst_chars = dst_str->chars;
+            int    valid      = 1;
+            size_t src_idx    = 0;
+            size_t dst_idx    = 0;
+
+            // the kernels store more bytes than they produce, which is safe
+            // while at least one more complete group follows
+            #ifdef __AVX2__
+            for (; valid && data_len - src_idx >= 48; src_idx += 32, dst_idx += 24)
+            {
+                __m256i values = sstr_b64_values_avx2(
+                    _mm256_loadu_si256((const __m256i *) &(src_chars[src_idx])), alphabet);
+                valid = _mm256_movemask_epi8(values) == 0;
+                _mm256_storeu_si256((__m256i *) &(dst_chars[dst_idx]),
+                                    sstr_b64_pack_avx2(values));
+            }
+            #endif /* __AVX2__ */
+
+            #ifdef __SSE2__
+            for (; valid && data_len - src_idx >= 24; src_idx += 16, dst_idx += 12)
+            {
+                __m128i values = sstr_b64_values_sse2(
+                    _mm_loadu_si128((const __m128i *) &(src_chars[src_idx])), alphabet);
+                valid = _mm_movemask_epi8(values) == 0;
+                sstr_b64_store_sse2(values, &(dst_chars[dst_idx]));
+            }
+            #endif /* __SSE2__ */
+
+            for (; valid && data_len - src_idx >= 4; src_idx += 4, dst_idx += 3)
+            {
+                int value0 = sstr_b64_value(src_chars[src_idx], alphabet);
+                int value1 = sstr_b64_value(src_chars[src_idx + 1], alphabet);
+                int value2 = sstr_b64_value(src_chars[src_idx + 2], alphabet);
+                int value3 = sstr_b64_value(src_chars[src_idx + 3], alphabet);
+                valid = (value0 | value1 | value2 | value3) >= 0;
+
+                uint32_t group = ((uint32_t) value0 << 18) | ((uint32_t) value1 << 12) |
+                                 ((uint32_t) value2 << 6) | (uint32_t) value3;
+                dst_chars[dst_idx]     = (char) (group >> 16);
+                dst_chars[dst_idx + 1] = (char) (group >> 8);
+                dst_chars[dst_idx + 2] = (char) group;
+            }
+
+            if (valid && tail_len > 0)
+            {
+                int value0 = sstr_b64_value(src_chars[src_idx], alphabet);
+                int value1 = sstr_b64_value(src_chars[src_idx + 1], alphabet);
+                int value2 = tail_len == 3 ? sstr_b64_value(src_chars[src_idx + 2], alphabet) : 0;
+                valid = (value0 | value1 | value2) >= 0;
+
+                uint32_t group = ((uint32_t) value0 << 18) | ((uint32_t) value1 << 12) |
+                                 ((uint32_t) value2 << 6);
+                dst_chars[dst_idx] = (char) (group >> 16);
+                if (tail_len == 3)
+                {
+                    dst_chars[dst_idx + 1] = (char) (group >> 8);
+                }
+                // unused bits of the last character must be zero
+                valid = valid && (group & (tail_len == 3 ? 0xFF : 0xFFFF)) == 0;
+            }
+
+            if (valid)
+            {
+                // update destination secureString length
+                dst_str->len = dst_len;
+                // terminate destination secureString with a null-character
+                dst_str->chars[dst_str->len] = '\0';
+
+                sstr_status = SSTR_PASS;
+            }
+            else
+            {
+                sstr_wipe(dst_str);
+            }
+        }
+    }
+
+    return sstr_status;
+}
+
+
+#ifdef __SSE2__
+/**
+ * Index of the lowest set bit in a non-zero mask
+ */
+static unsigned int sstr_conv_lowbit(
+    unsigned int mask
+)
+{
+    #ifdef __GNUC__
+    return (unsigned int) __builtin_ctz(mask);
+    #else
+    unsigned int bit_idx = 0;
+    while ((mask & 1U) == 0)
+    {
+        mask >>= 1;
+        ++bit_idx;
+    }
+    return bit_idx;
+    #endif /* __GNUC__ */
+}
+#endif /* __SSE2__ */
+
+
+/**
+ * Index of the next '"', '\\' or control character at or after src_idx,
+ * or src_len
+ *
+ * These are the characters that must be escaped in a JSON string and
+ * the characters that start an escape or are invalid when unescaping
+ */
+static size_t sstr_json_next_special(
+    const char *src_chars,
+    size_t     src_len,
+    size_t     src_idx
+)
+{
+    int found = 0;
+
+    #ifdef __AVX2__
+    while (!found && src_len - src_idx >= 32)
+    {
+        __m256i      block = _mm256_loadu_si256((const __m256i *) &(src_chars[src_idx]));
+        // bytes 00 - 1F become zero after the saturating subtraction
+        unsigned int mask  = (unsigned int) _mm256_movemask_epi8(_mm256_or_si256(
+            _mm256_or_si256(_mm256_cmpeq_epi8(block, _mm256_set1_epi8('"')),
+                            _mm256_cmpeq_epi8(block, _mm256_set1_epi8('\\'))),
+            _mm256_cmpeq_epi8(_mm256_subs_epu8(block, _mm256_set1_epi8(0x1F)),
+                              _mm256_setzero_si256())));
+        if (mask == 0)
+        {
+            src_idx += 32;
+        }
+        else
+        {
+            src_idx += sstr_conv_lowbit(mask);
+            found = 1;
+        }
+    }
+    #endif /* __AVX2__ */
+
+    #ifdef __SSE2__
+    while (!found && src_len - src_idx >= 16)
+    {
+        __m128i      block = _mm_loadu_si128((const __m128i *) &(src_chars[src_idx]));
+        unsigned int mask  = (unsigned int) _mm_movemask_epi8(_mm_or_si128(
+            _mm_or_si128(_mm_cmpeq_epi8(block, _mm_set1_epi8('"')),
+                         _mm_cmpeq_epi8(block, _mm_set1_epi8('\\'))),
+            _mm_cmpeq_epi8(_mm_subs_epu8(block, _mm_set1_epi8(0x1F)), _mm_setzero_si128())));
+        if (mask == 0)
+        {
+            src_idx += 16;
+        }
+        else
+        {
+            src_idx += sstr_conv_lowbit(mask);
+            found = 1;
+        }
+    }
+    #endif /* __SSE2__ */
+
+    while (!found && src_idx < src_len)
+    {
+        unsigned char src_char = (unsigned char) src_chars[src_idx];
+        if (src_char == '"' || src_char == '\\' || src_char < 0x20)
+        {
+            found = 1;
+        }
+        else
+        {
+            ++src_idx;
+        }
+    }
+
+    return src_idx;
+}
+
+
+/**
+ * Letter of the two character JSON escape of a character, or 0
+ */
+static char sstr_json_short_escape(
+    char src_char
+)
+{
+    char esc_char = 0;
+    switch (src_char)
+    {
+        case '"':
+            esc_char = '"';
+            break;
+        case '\\':
+            esc_char = '\\';
+            break;
+        case '\b':
+            esc_char = 'b';
+            break;
+        case '\f':
+            esc_char = 'f';
+            break;
+        case '\n':
+            esc_char = 'n';
+            break;
+        case '\r':
+            esc_char = 'r';
+            break;
+        case '\t':
+            esc_char = 't';
+            break;
+        default:
+            break;
+    }
+
+    return esc_char;
+}
+
+
+/**
+ * Number of characters that JSON escaping adds to a char array
+ */
+static size_t sstr_json_escape_extra(
+    const char *src_chars,
+    size_t     src_len
+)
+{
+    size_t extra_len = 0;
+    size_t src_idx   = sstr_json_next_special(src_chars, src_len, 0);
+    while (src_idx < src_len)
+    {
+        // "\x" or "\u00XX"
+        extra_len += sstr_json_short_escape(src_chars[src_idx]) != 0 ? 1 : 5;
+        src_idx = sstr_json_next_special(src_chars, src_len, src_idx + 1);
+    }
+
+    return extra_len;
+}
+
+
+/**
+ * JSON escape a char array
+ *
+ * Runs of characters that need no escaping are copied with memcpy()
+ */
+static void sstr_json_escape_chars(
+    const char *src_chars,
+    size_t     src_len,
+    char       *dst_chars
+)
+{
+    size_t src_idx = 0;
+    size_t dst_idx = 0;
+    while (src_idx < src_len)
+    {
+        size_t special_idx = sstr_json_next_special(src_chars, src_len, src_idx);
+        memcpy(&(dst_chars[dst_idx]), &(src_chars[src_idx]), special_idx - src_idx);
+        dst_idx += special_idx - src_idx;
+        if (special_idx < src_len)
+        {
+            unsigned char src_char = (unsigned char) src_chars[special_idx];
+            char          esc_char = sstr_json_short_escape((char) src_char);
+            dst_chars[dst_idx] = '\\';
+            if (esc_char != 0)
+            {
+                dst_chars[dst_idx + 1] = esc_char;
+                dst_idx += 2;
+            }
+            else
+            {
+                dst_chars[dst_idx + 1] = 'u';
+                dst_chars[dst_idx + 2] = '0';
+                dst_chars[dst_idx + 3] = '0';
+                dst_chars[dst_idx + 4] = sstr_hex_digits[src_char >> 4];
+                dst_chars[dst_idx + 5] = sstr_hex_digits[src_char & 0x0F];
+                dst_idx += 6;
+            }
+        }
+        src_idx = special_idx + 1;
+    }
+}
+
+
+/**
+ * Character that a two character JSON escape stands for, or 0
+ */
+static char sstr_json_short_unescape(
+    char esc_char
+)
+{
+    char dst_char = 0;
+    switch (esc_char)
+    {
+        case '"':
+            dst_char = '"';
+            break;
+        case '\\':
+            dst_char = '\\';
+            break;
+        case '/':
+            dst_char = '/';
+            break;
+        case 'b':
+            dst_char = '\b';
+            break;
+        case 'f':
+            dst_char = '\f';
+            break;
+        case 'n':
+            dst_char = '\n';
+            break;
+        case 'r':
+            dst_char = '\r';
+            break;
+        case 't':
+            dst_char = '\t';
+            break;
+        default:
+            break;
+    }
+
+    return dst_char;
+}
+
+
+/**
+ * Value of four hex digits, or -1
+ */
+static long sstr_json_hex4(
+    const char *src_chars
+)
+{
+    int digit0 = sstr_hex_value(src_chars[0]);
+    int digit1 = sstr_hex_value(src_chars[1]);
+    int digit2 = sstr_hex_value(src_chars[2]);
+    int digit3 = sstr_hex_value(src_chars[3]);
+
+    long value = -1;
+    if ((digit0 | digit1 | digit2 | digit3) >= 0)
+    {
+        value = ((long) digit0 << 12) | ((long) digit1 << 8) | ((long) digit2 << 4) | digit3;
+    }
+
+    return value;
+}
+
+
+/**
+ * Decode the \uXXXX escape, or the surrogate pair of two escapes,
+ * at src_idx
+ *
+ * Returns the length of the escape, or 0 if it is invalid
+ */
+static size_t sstr_json_code_point(
+    const char *src_chars,
+    size_t     src_len,
+    size_t     src_idx,
+    uint32_t   *dst_cp
+)
+{
+    size_t esc_len = 0;
+
+    if (src_len - src_idx >= 6)
+    {
+        long high = sstr_json_hex4(&(src_chars[src_idx + 2]));
+        if (high >= 0xD800 && high <= 0xDBFF)
+        {
+            // a high surrogate must be followed by a low surrogate
+            if (src_len - src_idx >= 12 &&
+                src_chars[src_idx + 6] == '\\' && src_chars[src_idx + 7] == 'u')
+            {
+                long low = sstr_json_hex4(&(src_chars[src_idx + 8]));
+                if (low >= 0xDC00 && low <= 0xDFFF)
+                {
+                    (*dst_cp) = 0x10000 + (((uint32_t) high - 0xD800) << 10) +
+                                ((uint32_t) low - 0xDC00);
+                    esc_len = 12;
+                }
+            }
+        }
+        else
+        if (high >= 0 && (high < 0xDC00 || high > 0xDFFF))
+        {
+            (*dst_cp) = (uint32_t) high;
+            esc_len = 6;
+        }
+    }
+
+    return esc_len;
+}
+
+
+/**
+ * Number of UTF-8 bytes of a code point
+ */
+static size_t sstr_json_utf8_len(
+    uint32_t code_point
+)
+{
+    size_t utf8_len = 4;
+    if (code_point < 0x80)
+    {
+        utf8_len = 1;
+    }
+    else
+    if (code_point < 0x800)
+    {
+        utf8_len = 2;
+    }
+    else
+    if (code_point < 0x10000)
+    {
+        utf8_len = 3;
+    }
+
+    return utf8_len;
+}
+
+
+/**
+ * Length of an unescaped JSON string, or SSTR_SIZE_FAIL if it is invalid
+ */
+static size_t sstr_json_unescaped_len(
+    const char *src_chars,
+    size_t     src_len
+)
+{
+    size_t dst_len = 0;
+    size_t src_idx = 0;
+    int    valid   = 1;
+
+    while (valid && src_idx < src_len)
+    {
+        size_t special_idx = sstr_json_next_special(src_chars, src_len, src_idx);
+        dst_len += special_idx - src_idx;
+        src_idx = special_idx;
+        if (src_idx < src_len)
+        {
+            // unescaped '"' and control characters are invalid
+            valid = src_chars[src_idx] == '\\' && src_len - src_idx >= 2;
+            if (valid && src_chars[src_idx + 1] == 'u')
+            {
+                uint32_t code_point = 0;
+                size_t   esc_len    = sstr_json_code_point(src_chars, src_len, src_idx,
+                                                           &code_point);
+                valid = esc_len != 0;
+                dst_len += sstr_json_utf8_len(code_point);
+                src_idx += esc_len;
+            }
+            else
+            if (valid)
+            {
+                valid = sstr_json_short_unescape(src_chars[src_idx + 1]) != 0;
+                dst_len += 1;
+                src_idx += 2;
+            }
+        }
+    }
+
+    return valid ? dst_len : SSTR_SIZE_FAIL;
+}
+
+
+/**
+ * Unescape a JSON string that sstr_json_unescaped_len() has validated
+ */
+static void sstr_json_unescape_chars(
+    const char *src_chars,
+    size_t     src_len,
+    char       *dst_chars
+)
+{
+    size_t src_idx = 0;
+    size_t dst_idx = 0;
+
+    while (src_idx < src_len)
+    {
+        size_t special_idx = sstr_json_next_special(src_chars, src_len, src_idx);
+        memcpy(&(dst_chars[dst_idx]), &(src_chars[src_idx]), special_idx - src_idx);
+        dst_idx += special_idx - src_idx;
+        src_idx = special_idx;
+        if (src_idx < src_len)
+        {
+            if (src_chars[src_idx + 1] == 'u')
+            {
+                uint32_t code_point = 0;
+                src_idx += sstr_json_code_point(src_chars, src_len, src_idx, &code_point);
+                size_t utf8_len = sstr_json_utf8_len(code_point);
+                if (utf8_len == 1)
+                {
+                    dst_chars[dst_idx] = (char) code_point;
+                }
+                else
+                {
+                    // lead byte: length marker and the highest bits
+                    dst_chars[dst_idx] = (char) (((0xF00 >> utf8_len) & 0xFF) |
+                                                 (code_point >> (6 * (utf8_len - 1))));
+                    for (size_t cont_idx = 1; cont_idx < utf8_len; ++cont_idx)
+                    {
+                        dst_chars[dst_idx + cont_idx] = (char) (
+                            0x80 | ((code_point >> (6 * (utf8_len - 1 - cont_idx))) & 0x3F));
+                    }
+                }
+                dst_idx += utf8_len;
+            }
+            else
+            {
+                dst_chars[dst_idx] = sstr_json_short_unescape(src_chars[src_idx + 1]);
+                ++dst_idx;
+                src_idx += 2;
+            }
+        }
+    }
+}
+
+
+/**
+ * Check whether a character is unreserved (RFC 3986, section 2.3)
+ */
+static int sstr_url_unreserved(
+    char src_char
+)
+{
+    return (src_char >= 'A' && src_char <= 'Z') || (src_char >= 'a' && src_char <= 'z') ||
+           (src_char >= '0' && src_char <= '9') ||
+           src_char == '-' || src_char == '.' || src_char == '_' || src_char == '~';
+}
+
+
+/**
+ * Index of the next character that must be percent-encoded at or after
+ * src_idx, or src_len
+ *
+ * The SIMD range checks add an offset that moves each range to the
+ * lowest signed byte values, so that one signed comparison suffices
+ */
+static size_t sstr_url_next_reserved(
+    const char *src_chars,
+    size_t     src_len,
+    size_t     src_idx
+)
+{
+    int found = 0;
+
+    #ifdef __AVX2__
+    while (!found && src_len - src_idx >= 32)
+    {
+        __m256i block   = _mm256_loadu_si256((const __m256i *) &(src_chars[src_idx]));
+        __m256i letters = _mm256_cmpgt_epi8(
+            _mm256_set1_epi8(-128 + 26),
+            _mm256_add_epi8(_mm256_or_si256(block, _mm256_set1_epi8(0x20)),
+                            _mm256_set1_epi8((char) (0x80 - 'a'))));
+        __m256i digits  = _mm256_cmpgt_epi8(
+            _mm256_set1_epi8(-128 + 10),
+            _mm256_add_epi8(block, _mm256_set1_epi8((char) (0x80 - '0'))));
+        // '-' and '.'
+        __m256i marks   = _mm256_cmpgt_epi8(
+            _mm256_set1_epi8(-128 + 2),
+            _mm256_add_epi8(block, _mm256_set1_epi8((char) (0x80 - '-'))));
+        __m256i others  = _mm256_or_si256(_mm256_cmpeq_epi8(block, _mm256_set1_epi8('_')),
+                                          _mm256_cmpeq_epi8(block, _mm256_set1_epi8('~')));
+        unsigned int mask = ~((unsigned int) _mm256_movemask_epi8(_mm256_or_si256(
+            _mm256_or_si256(letters, digits), _mm256_or_si256(marks, others))));
+        if (mask == 0)
+        {
+            src_idx += 32;
+        }
+        else
+        {
+            src_idx += sstr_conv_lowbit(mask);
+            found = 1;
+        }
+    }
+    #endif /* __AVX2__ */
+
+    #ifdef __SSE2__
+    while (!found && src_len - src_idx >= 16)
+    {
+        __m128i block   = _mm_loadu_si128((const __m128i *) &(src_chars[src_idx]));
+        __m128i letters = _mm_cmplt_epi8(
+            _mm_add_epi8(_mm_or_si128(block, _mm_set1_epi8(0x20)),
+                         _mm_set1_epi8((char) (0x80 - 'a'))),
+            _mm_set1_epi8(-128 + 26));
+        __m128i digits  = _mm_cmplt_epi8(
+            _mm_add_epi8(block, _mm_set1_epi8((char) (0x80 - '0'))), _mm_set1_epi8(-128 + 10));
+        __m128i marks   = _mm_cmplt_epi8(
+            _mm_add_epi8(block, _mm_set1_epi8((char) (0x80 - '-'))), _mm_set1_epi8(-128 + 2));
+        __m128i others  = _mm_or_si128(_mm_cmpeq_epi8(block, _mm_set1_epi8('_')),
+                                       _mm_cmpeq_epi8(block, _mm_set1_epi8('~')));
+        unsigned int mask = 0xFFFFU & ~((unsigned int) _mm_movemask_epi8(_mm_or_si128(
+            _mm_or_si128(letters, digits), _mm_or_si128(marks, others))));
+        if (mask == 0)
+        {
+            src_idx += 16;
+        }
+        else
+        {
+            src_idx += sstr_conv_lowbit(mask);
+            found = 1;
+        }
+    }
+    #endif /* __SSE2__ */
+
+    while (!found && src_idx < src_len)
+    {
+        if (sstr_url_unreserved(src_chars[src_idx]))
+        {
+            ++src_idx;
+        }
+        else
+        {
+            found = 1;
+        }
+    }
+
+    return src_idx;
+}
@@ -36,8 +36,14 @@
 #include <unistd.h>
 #include <sys/types.h>
 #include <stdlib.h>
+#include <stdint.h>
+#include <stdarg.h>
 #include <securestr.h>
 
+// return value of the conversion functions for numbers that are
+// out of range
+extern const sstr_rc SSTR_RANGE;
+
 /**
  * sizeof (text) is the length of a text including its
  * trailing null byte
@@ -70,14 +76,301 @@ sstr_rc sstr_appdcstr(
  * Compare a secureString with a C string
  */
 sstr_rc sstr_cmpcstr(
-    sstring    *src_str,
-    const char *pat_str,
-    size_t     cstr_len
+    const sstring *src_str,
+    const char    *pat_str,
+    size_t        cstr_len
+);
+
+
+/**
+ * Append the decimal representation of an unsigned integer to a secureString
+ */
+sstr_rc sstr_appd_u64(
+    uint64_t src_value,
+    sstring  *dst_str
+);
+
+
+/**
+ * Append the decimal representation of a signed integer to a secureString
+ */
+sstr_rc sstr_appd_i64(
+    int64_t src_value,
+    sstring *dst_str
+);
+
+
+/**
+ * Append the hexadecimal representation of an unsigned integer
+ * to a secureString
+ *
+ * Lowercase digits, no prefix, no leading zeros
+ */
+sstr_rc sstr_appd_hex(
+    uint64_t src_value,
+    sstring  *dst_str
+);
+
+
+/**
+ * Append the shortest decimal representation of a double that converts
+ * back to the same value to a secureString
+ *
+ * Values from 1e-6 up to 1e21 are written in fixed-point notation,
+ * all other values in exponential notation (e.g. 1.5e-7, 2e+21).
+ * Special values are written as "inf", "-inf" and "nan".
+ */
+sstr_rc sstr_appd_double(
+    double  src_value,
+    sstring *dst_str
+);
+
+
+/**
+ * Append formatted text to a secureString
+ *
+ * Supports a subset of printf():
+ *   %d %i         int, with the length modifiers hh h l ll z j
+ *   %u %x %X      unsigned int, with the same length modifiers
+ *   %c            char
+ *   %s            C string; the precision limits the number of chars
+ *   %S            const sstring *; the precision limits the number of chars
+ *   %g            double, written as by sstr_appd_double()
+ *   %%            the '%' character, without flags or a field width
+ * Directives accept the flags '-' (left-justify) and '0' (pad integers
+ * with zeros) and a field width; width and precision may be given as '*'.
+ * Only %s and %S accept a precision.
+ *
+ * If the destination secureString does not have enough capacity, or the
+ * format contains an unsupported directive, a precision that is not
+ * supported or a NULL string argument, the chars appended so far are
+ * wiped and dst_str remains unchanged.
+ */
+sstr_rc sstr_appdf(
+    sstring    *dst_str,
+    const char *format,
+    ...
+);
+
+
+/**
+ * Append formatted text to a secureString, see sstr_appdf()
+ */
+sstr_rc sstr_vappdf(
+    sstring    *dst_str,
+    const char *format,
+    va_list    args
+);
+
+
+/**
+ * Copy formatted text to a secureString (overwrite), see sstr_appdf()
+ *
+ * The arguments must not refer to dst_str.
+ * If formatting fails, dst_str is wiped.
+ */
+sstr_rc sstr_cpyf(
+    sstring    *dst_str,
+    const char *format,
+    ...
+);
+
+
+/**
+ * Convert a secureString to an unsigned integer
+ *
+ * The string must consist of decimal digits only. Leading zeros are
+ * accepted; signs and whitespace are not.
+ * Returns SSTR_RANGE if the value does not fit into an uint64_t.
+ * dst_value is only modified if the conversion succeeds.
+ */
+sstr_rc sstr_to_u64(
+    const sstring *src_str,
+    uint64_t      *dst_value
+);
+
+
+/**
+ * Convert a secureString to a signed integer
+ *
+ * The string must consist of an optional sign followed by decimal digits.
+ * Returns SSTR_RANGE if the value does not fit into an int64_t.
+ * dst_value is only modified if the conversion succeeds.
+ */
+sstr_rc sstr_to_i64(
+    const sstring *src_str,
+    int64_t       *dst_value
+);
+
+
+/**
+ * Convert a secureString to a double
+ *
+ * The string must consist of an optional sign, decimal digits with an
+ * optional decimal point and an optional exponent (e.g. -1.5e-7), or one
+ * of "inf", "infinity" and "nan" (case-insensitive). Whitespace, hexadecimal
+ * notation and locale-specific decimal points are not accepted.
+ * The result is correctly rounded. Returns SSTR_RANGE if a finite number
+ * is too large for a double; numbers that are too small are rounded to
+ * zero or a subnormal value.
+ * dst_value is only modified if the conversion succeeds.
+ */
+sstr_rc sstr_to_double(
+    const sstring *src_str,
+    double        *dst_value
+);
+
+
+/**
+ * Encode a secureString in hexadecimal (overwrite)
+ *
+ * Lowercase digits; dst_str needs a capacity of twice the length of src_str
+ */
+sstr_rc sstr_hex_encode(
+    const sstring *src_str,
+    sstring       *dst_str
+);
+
+
+/**
+ * Decode a hexadecimal secureString (overwrite)
+ *
+ * Upper- and lowercase digits are accepted; src_str must have an even
+ * length. If decoding fails on an invalid character, dst_str is wiped,
+ * so that no partially decoded data remains.
+ */
+sstr_rc sstr_hex_decode(
+    const sstring *src_str,
+    sstring       *dst_str
+);
+
+
+/**
+ * Encode a secureString in Base64 (overwrite)
+ *
+ * Standard alphabet (RFC 4648, section 4) with padding;
+ * dst_str needs a capacity of 4 * ceil(src_len / 3)
+ */
+sstr_rc sstr_b64_encode(
+    const sstring *src_str,
+    sstring       *dst_str
+);
+
+
+/**
+ * Decode a Base64 secureString (overwrite)
+ *
+ * Standard alphabet with padding. Whitespace and non-zero unused bits in
+ * the last character are rejected. If decoding fails on an invalid
+ * character, dst_str is wiped, so that no partially decoded data remains.
+ */
+sstr_rc sstr_b64_decode(
+    const sstring *src_str,
+    sstring       *dst_str
+);
+
+
+/**
+ * Encode a secureString in URL-safe Base64 (overwrite)
+ *
+ * URL and filename safe alphabet (RFC 4648, section 5) without padding;
+ * dst_str needs a capacity of ceil(4 * src_len / 3)
+ */
+sstr_rc sstr_b64url_encode(
+    const sstring *src_str,
+    sstring       *dst_str
+);
+
+
+/**
+ * Decode a URL-safe Base64 secureString (overwrite)
+ *
+ * URL and filename safe alphabet; padding is optional, but must be
+ * correct if present. If decoding fails on an invalid character, dst_str
+ * is wiped, so that no partially decoded data remains.
+ */
+sstr_rc sstr_b64url_decode(
+    const sstring *src_str,
+    sstring       *dst_str
+);
+
+
+/**
+ * Escape a secureString for use in a JSON string (overwrite)
+ *
+ * '"', '\\' and the control characters 00 - 1F are escaped; all other
+ * bytes, including UTF-8 sequences, are copied unchanged. The exact
+ * output length is determined before anything is written, so dst_str
+ * remains unchanged if its capacity is insufficient.
+ */
+sstr_rc sstr_json_escape(
+    const sstring *src_str,
+    sstring       *dst_str
+);
+
+
+/**
+ * Unescape the contents of a JSON string (overwrite)
+ *
+ * \uXXXX escapes, including surrogate pairs, are converted to UTF-8.
+ * Unescaped '"' and control characters, unknown escapes and lone
+ * surrogates are rejected. The input is validated completely before
+ * anything is written, so dst_str remains unchanged on failure.
+ */
+sstr_rc sstr_json_unescape(
+    const sstring *src_str,
+    sstring       *dst_str
+);
+
+
+/**
+ * Percent-encode a secureString (overwrite)
+ *
+ * All bytes except the unreserved characters of RFC 3986
+ * (A-Z a-z 0-9 - . _ ~) are encoded as %XX with uppercase hex digits.
+ * dst_str remains unchanged if its capacity is insufficient.
+ */
+sstr_rc sstr_url_encode(
+    const sstring *src_str,
+    sstring       *dst_str
+);
+
+
+/**
+ * Decode a percent-encoded secureString (overwrite)
+ *
+ * Every '%' must be followed by two hex digits; '+' is not converted.
+ * The input is validated completely before anything is written,
+ * so dst_str remains unchanged on failure.
+ */
+sstr_rc sstr_url_decode(
+    const sstring *src_str,
+    sstring       *dst_str
 );
 
 
-#define sstrCpyCstr     sstr_cpycstr
-#define sstrAppdCstr    sstr_appdcstr
-#define sstrCmpCstr     sstr_cmpcstr
+#define sstrCpyCstr         sstr_cpycstr
+#define sstrAppdCstr        sstr_appdcstr
+#define sstrCmpCstr         sstr_cmpcstr
+#define sstrAppdU64         sstr_appd_u64
+#define sstrAppdI64         sstr_appd_i64
+#define sstrAppdHex         sstr_appd_hex
+#define sstrAppdDouble      sstr_appd_double
+#define sstrAppdF           sstr_appdf
+#define sstrVAppdF          sstr_vappdf
+#define sstrCpyF            sstr_cpyf
+#define sstrToU64           sstr_to_u64
+#define sstrToI64           sstr_to_i64
+#define sstrToDouble        sstr_to_double
+#define sstrHexEncode       sstr_hex_encode
+#define sstrHexDecode       sstr_hex_decode
+#define sstrB64Encode       sstr_b64_encode
+#define sstrB64Decode       sstr_b64_decode
+#define sstrB64UrlEncode    sstr_b64url_encode
+#define sstrB64UrlDecode    sstr_b64url_decode
+#define sstrJsonEscape      sstr_json_escape
+#define sstrJsonUnescape    sstr_json_unescape
+#define sstrUrlEncode       sstr_url_encode
+#define sstrUrlDecode       sstr_url_decode
 
 #endif /* _SECURESTR_CONV_H */
@@ -0,0 +1,450 @@
+/**
+ * secureStrings library
+ * version 0.54-beta (2014-10-25_001)
+ *
+ * secureStrings deferred deallocation functions
+ *
+ * Copyright (C) 2010, 2014 Robert ALTNOEDER
+ *
+ * Redistribution and use in source and binary forms,
+ * with or without modification, are permitted provided that
+ * the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in
+ *     the documentation and/or other materials provided with the distribution.
+ *  3. The name of the author may not be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <unistd.h>
+#include <sys/types.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <pthread.h>
+#include <securestr.h>
+#include <securestr_defer.h>
+
+#ifdef __SSE2__
+    #include <emmintrin.h>
+#endif
+#ifdef __AVX2__
+    #include <immintrin.h>
+#endif
+
+// strings with a smaller char array are wiped by the calling thread;
+// the queue node is stored in the char array of a deferred string
+#define SSTR_DEFER_MIN  ((size_t) 4096)
+
+// maximum number of chars in the char arrays of queued strings
+#ifndef SSTR_DEFER_BACKLOG_MAX
+    #define SSTR_DEFER_BACKLOG_MAX ((size_t) 1 << 28)
+#endif
+
+#ifndef _SSTR_NO_DYNMEM
+
+// a queued string; stored at the beginning of the string's char array,
+// which is wiped anyway
+typedef struct sstr_defer_node_struct sstr_defer_node;
+struct sstr_defer_node_struct
+{
+    sstr_defer_node *next;
+    sstring         *str;
+};
+
+static pthread_once_t  sstr_defer_once = PTHREAD_ONCE_INIT;
+static pthread_mutex_t sstr_defer_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t  sstr_defer_work_cond = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t  sstr_defer_done_cond = PTHREAD_COND_INITIALIZER;
+static pthread_t       sstr_defer_thread;
+// set while the zeroizer thread accepts strings
+static int             sstr_defer_running = 0;
+// queued strings, pushed by any thread and taken all at once
+// by the zeroizer thread
+static sstr_defer_node *sstr_defer_head = NULL;
+// number of chars of the queued strings' char arrays
+static size_t          sstr_defer_backlog = 0;
+// the following fields are protected by sstr_defer_lock:
+// number of batches that the zeroizer thread has started and completed
+static unsigned long   sstr_defer_started_seq = 0;
+static unsigned long   sstr_defer_done_seq = 0;
+// batch that a thread in sstr_dealloc_flush() waits for
+static unsigned long   sstr_defer_flush_seq = 0;
+static int             sstr_defer_stopping = 0;
+// set while fork() waits for the zeroizer thread to become idle
+static int             sstr_defer_forking = 0;
+
+static void sstr_defer_start(void);
+static void sstr_defer_exit(void);
+static void sstr_defer_fork_prepare(void);
+static void sstr_defer_fork_parent(void);
+static void sstr_defer_fork_child(void);
+static void *sstr_defer_zeroizer(
+    void *unused
+);
+static void sstr_defer_discard_list(
+    sstr_defer_node *src_list
+);
+static void sstr_defer_discard(
+    sstring *dst_str
+);
+static void sstr_defer_wipe(
+    char   *dst_chars,
+    size_t dst_len
+);
+
+
+/**
+ * Wipe and deallocate a string in the background
+ *
+ * dst_str must have been allocated by sstr_alloc()
+ */
+void sstr_dealloc_deferred(
+    sstring *dst_str
+)
+{
+    if (dst_str != NULL)
+    {
+        pthread_once(&sstr_defer_once, sstr_defer_start);
+
+        // the real capacity of a secureString is cap + 1
+        size_t chars_len = dst_str->cap + 1;
+        int    deferred  = 0;
+        if (chars_len >= SSTR_DEFER_MIN &&
+            __atomic_load_n(&sstr_defer_running, __ATOMIC_ACQUIRE))
+        {
+            size_t backlog = __atomic_add_fetch(&sstr_defer_backlog, chars_len,
+                                                __ATOMIC_RELAXED);
+            if (backlog <= SSTR_DEFER_BACKLOG_MAX)
+            {
+                sstr_defer_node *node      = (sstr_defer_node *) dst_str->chars;
+                sstr_defer_node *prev_head = __atomic_load_n(&sstr_defer_head, __ATOMIC_RELAXED);
+                node->str = dst_str;
+                // the node is initialized before the zeroizer sees it;
+                // once it is queued, the node may be wiped at any time
+                do
+                {
+                    node->next = prev_head;
+                }
+                while (!__atomic_compare_exchange_n(&sstr_defer_head, &prev_head, node, 0,
+                                                    __ATOMIC_SEQ_CST, __ATOMIC_RELAXED));
+
+                if (!__atomic_load_n(&sstr_defer_running, __ATOMIC_SEQ_CST))
+                {
+                    // sstr_defer_exit() may have taken the queue for the last
+                    // time before the node was pushed
+                    sstr_defer_discard_list(__atomic_exchange_n(&sstr_defer_head, NULL,
+                                                                __ATOMIC_ACQUIRE));
+                }
+                else
+                if (prev_head == NULL)
+                {
+                    // the zeroizer thread may be waiting for an empty queue
+                    // to be filled
+                    pthread_mutex_lock(&sstr_defer_lock);
+                    pthread_cond_signal(&sstr_defer_work_cond);
+                    pthread_mutex_unlock(&sstr_defer_lock);
+                }
+                deferred = 1;
+            }
+            else
+            {
+                __atomic_sub_fetch(&sstr_defer_backlog, chars_len, __ATOMIC_RELAXED);
+            }
+        }
+
+        if (!deferred)
+        {
+            sstr_defer_discard(dst_str);
+        }
+    }
+}
+
+
+/**
+ * Wait until all strings that have been passed to sstr_dealloc_deferred()
+ * before this call are wiped and deallocated
+ */
+void sstr_dealloc_flush(void)
+{
+    pthread_mutex_lock(&sstr_defer_lock);
+    int running = __atomic_load_n(&sstr_defer_running, __ATOMIC_ACQUIRE);
+    if (running)
+    {
+        // the next batch takes all strings that are queued now
+        unsigned long flush_seq = sstr_defer_started_seq + 1;
+        if (sstr_defer_flush_seq < flush_seq)
+        {
+            sstr_defer_flush_seq = flush_seq;
+        }
+        pthread_cond_signal(&sstr_defer_work_cond);
+        while (sstr_defer_done_seq < flush_seq)
+        {
+            pthread_cond_wait(&sstr_defer_done_cond, &sstr_defer_lock);
+        }
+    }
+    pthread_mutex_unlock(&sstr_defer_lock);
+
+    if (!running)
+    {
+        // strings queued before the zeroizer thread was stopped,
+        // or inherited from the parent process
+        sstr_defer_discard_list(__atomic_exchange_n(&sstr_defer_head, NULL,
+                                                    __ATOMIC_ACQUIRE));
+    }
+}
+
+
+/**
+ * Start the zeroizer thread and register the exit handler that stops it
+ */
+static void sstr_defer_start(void)
+{
+    if (pthread_create(&sstr_defer_thread, NULL, sstr_defer_zeroizer, NULL) == 0)
+    {
+        if (pthread_atfork(sstr_defer_fork_prepare, sstr_defer_fork_parent,
+                           sstr_defer_fork_child) == 0 &&
+            atexit(sstr_defer_exit) == 0)
+        {
+            __atomic_store_n(&sstr_defer_running, 1, __ATOMIC_RELEASE);
+        }
+        else
+        {
+            // without the exit handler, queued strings might not be wiped;
+            // without the fork handlers, a child process would wait
+            // for a thread that does not exist
+            sstr_defer_exit();
+        }
+    }
+}
+
+
+/**
+ * Stop the zeroizer thread after it has wiped all queued strings
+ *
+ * Later deferred deallocations are performed by the calling thread
+ */
+static void sstr_defer_exit(void)
+{
+    // seq_cst: a thread that pushes a string after this store sees it
+    // and takes the queue back itself
+    __atomic_store_n(&sstr_defer_running, 0, __ATOMIC_SEQ_CST);
+
+    pthread_mutex_lock(&sstr_defer_lock);
+    // the zeroizer thread has already been stopped, or does not exist
+    // in a child process
+    int joinable = !sstr_defer_stopping;
+    sstr_defer_stopping = 1;
+    pthread_cond_signal(&sstr_defer_work_cond);
+    pthread_mutex_unlock(&sstr_defer_lock);
+
+    if (joinable)
+    {
+        pthread_join(sstr_defer_thread, NULL);
+    }
+
+    // strings queued by threads that had not yet seen the zeroizer stop
+    sstr_defer_discard_list(__atomic_exchange_n(&sstr_defer_head, NULL, __ATOMIC_ACQUIRE));
+}
+
+
+/**
+ * Prepare the queue for fork()
+ *
+ * Waits until the zeroizer thread has finished its current batch, so that
+ * all strings that the child process inherits without wiping them are
+ * still queued; the lock is held until fork() returns
+ */
+static void sstr_defer_fork_prepare(void)
+{
+    pthread_mutex_lock(&sstr_defer_lock);
+    sstr_defer_forking = 1;
+    while (sstr_defer_done_seq != sstr_defer_started_seq)
+    {
+        pthread_cond_wait(&sstr_defer_done_cond, &sstr_defer_lock);
+    }
+}
+
+
+/**
+ * Release the lock taken by sstr_defer_fork_prepare() in the parent process
+ */
+static void sstr_defer_fork_parent(void)
+{
+    sstr_defer_forking = 0;
+    pthread_cond_signal(&sstr_defer_work_cond);
+    pthread_mutex_unlock(&sstr_defer_lock);
+}
+
+
+/**
+ * Stop deferring deallocations in the child process
+ *
+ * Only the thread that called fork() exists in the child, so the lock and
+ * the condition variables are reinitialized and later deallocations are
+ * performed by the calling thread; the inherited queue is wiped by
+ * sstr_dealloc_flush() and the exit handler
+ */
+static void sstr_defer_fork_child(void)
+{
+    __atomic_store_n(&sstr_defer_running, 0, __ATOMIC_SEQ_CST);
+    sstr_defer_stopping    = 1;
+    sstr_defer_forking     = 0;
+    sstr_defer_started_seq = 0;
+    sstr_defer_done_seq    = 0;
+    sstr_defer_flush_seq   = 0;
+
+    pthread_mutex_init(&sstr_defer_lock, NULL);
+    pthread_cond_init(&sstr_defer_work_cond, NULL);
+    pthread_cond_init(&sstr_defer_done_cond, NULL);
+}
+
+
+/**
+ * Main function of the zeroizer thread
+ *
+ * Takes all queued strings at once and wipes and deallocates them,
+ * until it is stopped and the queue is empty
+ */
+static void *sstr_defer_zeroizer(
+    void *unused
+)
+{
+    int stopped = 0;
+
+    pthread_mutex_lock(&sstr_defer_lock);
+    while (!stopped)
+    {
+        // a batch is not started while fork() waits for the current one
+        while (sstr_defer_forking)
+        {
+            pthread_cond_wait(&sstr_defer_work_cond, &sstr_defer_lock);
+        }
+        unsigned long batch_seq = ++sstr_defer_started_seq;
+        pthread_mutex_unlock(&sstr_defer_lock);
+
+        sstr_defer_discard_list(__atomic_exchange_n(&sstr_defer_head, NULL,
+                                                    __ATOMIC_ACQUIRE));
+
+        pthread_mutex_lock(&sstr_defer_lock);
+        sstr_defer_done_seq = batch_seq;
+        pthread_cond_broadcast(&sstr_defer_done_cond);
+
+        // another batch is started immediately if strings have been queued
+        // or a flush waits for a batch that has not been started yet
+        if (__atomic_load_n(&sstr_defer_head, __ATOMIC_RELAXED) == NULL &&
+            sstr_defer_flush_seq <= batch_seq)
+        {
+            if (sstr_defer_stopping)
+            {
+                stopped = 1;
+            }
+            else
+            {
+                pthread_cond_wait(&sstr_defer_work_cond, &sstr_defer_lock);
+            }
+        }
+    }
+    pthread_mutex_unlock(&sstr_defer_lock);
+
+    return unused;
+}
+
+
+/**
+ * Wipe and deallocate a list of queued strings
+ */
+static void sstr_defer_discard_list(
+    sstr_defer_node *src_list
+)
+{
+    while (src_list != NULL)
+    {
+        // the node is overwritten when the string is wiped
+        sstr_defer_node *next_node = src_list->next;
+        sstring         *dst_str   = src_list->str;
+
+        __atomic_sub_fetch(&sstr_defer_backlog, dst_str->cap + 1, __ATOMIC_RELAXED);
+        sstr_defer_discard(dst_str);
+
+        src_list = next_node;
+    }
+}
+
+
+/**
+ * Wipe and deallocate a string
+ */
+static void sstr_defer_discard(
+    sstring *dst_str
+)
+{
+    sstr_defer_wipe(dst_str->chars, dst_str->cap + 1);
+    sstr_dealloc(dst_str);
+}
+
+
+/**
+ * Wipe a char array
+ *
+ * Large arrays are wiped with non-temporal stores, which do not evict
+ * other data from the caches; the stores are complete before the
+ * array is deallocated.
+ */
+static void sstr_defer_wipe(
+    char   *dst_chars,
+    size_t dst_len
+)
+{
+    // the stores must not be removed as dead stores before free()
+    volatile char *dst_vchars = dst_chars;
+    size_t        dst_idx     = 0;
+
+    #if defined(__AVX2__)
+    while (dst_idx < dst_len && ((uintptr_t) &(dst_chars[dst_idx]) & 31) != 0)
+    {
+        dst_vchars[dst_idx++] = '\0';
+    }
+    __m256i zero_chars = _mm256_setzero_si256();
+    while (dst_len - dst_idx >= 32)
+    {
+        _mm256_stream_si256((__m256i *) &(dst_chars[dst_idx]), zero_chars);
+        dst_idx += 32;
+    }
+    _mm_sfence();
+    #elif defined(__SSE2__)
+    while (dst_idx < dst_len && ((uintptr_t) &(dst_chars[dst_idx]) & 15) != 0)
+    {
+        dst_vchars[dst_idx++] = '\0';
+    }
+    __m128i zero_chars = _mm_setzero_si128();
+    while (dst_len - dst_idx >= 16)
+    {
+        _mm_stream_si128((__m128i *) &(dst_chars[dst_idx]), zero_chars);
+        dst_idx += 16;
+    }
+    _mm_sfence();
+    #endif /* __AVX2__, __SSE2__ */
+
+    while (dst_idx < dst_len)
+    {
+        dst_vchars[dst_idx++] = '\0';
+    }
+}
+
+#endif /* not _SSTR_NO_DYNMEM */
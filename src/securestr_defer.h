@@ -0,0 +1,79 @@
+/**
+ * secureStrings library
+ * version 0.54-beta (2014-10-25_001)
+ *
+ * secureStrings deferred deallocation functions
+ *
+ * Copyright (C) 2010, 2014 Robert ALTNOEDER
+ *
+ * Redistribution and use in source and binary forms,
+ * with or without modification, are permitted provided that
+ * the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in
+ *     the documentation and/or other materials provided with the distribution.
+ *  3. The name of the author may not be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _SECURESTR_DEFER_H
+#define _SECURESTR_DEFER_H
+
+#include <unistd.h>
+#include <sys/types.h>
+#include <stdlib.h>
+#include <securestr.h>
+
+// Deferred deallocation hands secureStrings to a background thread
+// that wipes and deallocates them
+//
+// The thread is started by the first deferred deallocation. Strings
+// are queued without taking a lock. If the thread cannot be started,
+// or the queued strings exceed the backlog limit, the calling thread
+// wipes and deallocates the string itself. Queued strings are wiped
+// before the process exits normally.
+//
+// fork() waits until the thread has finished the strings it is wiping.
+// The thread does not exist in the child process, so the child wipes and
+// deallocates strings itself; it wipes the strings inherited from the
+// queue in sstr_dealloc_flush() or when it exits normally.
+
+#ifndef _SSTR_NO_DYNMEM
+/**
+ * Wipe and deallocate a string in the background
+ *
+ * dst_str must have been allocated by sstr_alloc()
+ */
+void sstr_dealloc_deferred(
+    sstring *dst_str
+);
+#endif /* not _SSTR_NO_DYNMEM */
+
+
+#ifndef _SSTR_NO_DYNMEM
+/**
+ * Wait until all strings that have been passed to sstr_dealloc_deferred()
+ * before this call are wiped and deallocated
+ */
+void sstr_dealloc_flush(void);
+#endif /* not _SSTR_NO_DYNMEM */
+
+
+#define sstrDeallocDeferred sstr_dealloc_deferred
+#define sstrDeallocFlush    sstr_dealloc_flush
+
+#endif /* _SECURESTR_DEFER_H */
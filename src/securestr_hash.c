@@ -0,0 +1,409 @@
+/**
+ * secureStrings library
+ * version 0.54-beta (2014-10-25_001)
+ *
+ * secureStrings hash functions
+ *
+ * Copyright (C) 2010, 2014 Robert ALTNOEDER
+ *
+ * Redistribution and use in source and binary forms,
+ * with or without modification, are permitted provided that
+ * the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in
+ *     the documentation and/or other materials provided with the distribution.
+ *  3. The name of the author may not be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <unistd.h>
+#include <sys/types.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <fcntl.h>
+#include <errno.h>
+#include <time.h>
+#include <pthread.h>
+#include <securestr.h>
+#include <securestr_hash.h>
+
+#define SSTR_ROTL64(value, bits) \
+        (((value) << (bits)) | ((value) >> (64 - (bits))))
+
+// xxHash64 primes
+#define SSTR_XXH_P1 ((uint64_t) 0x9E3779B185EBCA87ULL)
+#define SSTR_XXH_P2 ((uint64_t) 0xC2B2AE3D27D4EB4FULL)
+#define SSTR_XXH_P3 ((uint64_t) 0x165667B19E3779F9ULL)
+#define SSTR_XXH_P4 ((uint64_t) 0x85EBCA77C2B2AE63ULL)
+#define SSTR_XXH_P5 ((uint64_t) 0x27D4EB2F165667C5ULL)
+
+// per-process SipHash key
+static uint64_t       sstr_hash_key[2];
+static pthread_once_t sstr_hash_key_once = PTHREAD_ONCE_INIT;
+
+static void sstr_hash_key_init(void);
+static uint64_t sstr_load64(const unsigned char *src_bytes);
+static uint32_t sstr_load32(const unsigned char *src_bytes);
+static uint64_t sstr_siphash13(
+    const unsigned char *src_bytes,
+    size_t              src_len
+);
+static uint64_t sstr_xxh64_round(
+    uint64_t acc,
+    uint64_t input
+);
+static uint64_t sstr_xxh64(
+    const unsigned char *src_bytes,
+    size_t              src_len
+);
+
+
+/**
+ * Calculate the keyed hash value of a string
+ *
+ * Uses SipHash-1-3 with a random key that is generated once per process,
+ * so hash values are not predictable for an attacker and must not be
+ * stored or sent to other processes
+ */
+sstr_rc sstr_hash(
+    const sstring *src_str,
+    sstr_hashval  *dst_hash
+)
+{
+    sstr_rc sstr_status = SSTR_FAIL;
+
+    if (src_str != NULL && dst_hash != NULL)
+    {
+        (*dst_hash) = sstr_siphash13((const unsigned char *) src_str->chars,
+                                     src_str->len);
+        sstr_status = SSTR_PASS;
+    }
+
+    return sstr_status;
+}
+
+
+/**
+ * Calculate the keyed hash value of a C string
+ */
+sstr_rc sstr_hashcstr(
+    const char   *src_cstr,
+    sstr_hashval *dst_hash,
+    size_t       cstr_len
+)
+{
+    sstr_rc sstr_status = SSTR_FAIL;
+
+    if (src_cstr != NULL && dst_hash != NULL)
+    {
+        (*dst_hash) = sstr_siphash13((const unsigned char *) src_cstr, cstr_len);
+        sstr_status = SSTR_PASS;
+    }
+
+    return sstr_status;
+}
+
+
+/**
+ * Calculate the non-keyed hash value of a string
+ *
+ * Much faster than sstr_hash() on long strings, but must only be used
+ * for trusted data, because collisions can be produced deliberately.
+ * Hash values are stable across processes.
+ */
+sstr_rc sstr_hash_fast(
+    const sstring *src_str,
+    sstr_hashval  *dst_hash
+)
+{
+    sstr_rc sstr_status = SSTR_FAIL;
+
+    if (src_str != NULL && dst_hash != NULL)
+    {
+        (*dst_hash) = sstr_xxh64((const unsigned char *) src_str->chars,
+                                 src_str->len);
+        sstr_status = SSTR_PASS;
+    }
+
+    return sstr_status;
+}
+
+
+/**
+ * Calculate the non-keyed hash value of a C string
+ */
+sstr_rc sstr_hash_fastcstr(
+    const char   *src_cstr,
+    sstr_hashval *dst_hash,
+    size_t       cstr_len
+)
+{
+    sstr_rc sstr_status = SSTR_FAIL;
+
+    if (src_cstr != NULL && dst_hash != NULL)
+    {
+        (*dst_hash) = sstr_xxh64((const unsigned char *) src_cstr, cstr_len);
+        sstr_status = SSTR_PASS;
+    }
+
+    return sstr_status;
+}
+
+
+/**
+ * Generate the per-process SipHash key
+ *
+ * The key is read from /dev/urandom. If that fails, the key is derived
+ * from the clock, the process id and the address of the key itself,
+ * which is weaker, but still not known in advance to a remote attacker.
+ */
+static void sstr_hash_key_init(void)
+{
+    unsigned char key_bytes[16];
+    size_t        key_idx = 0;
+
+    int key_fd = open("/dev/urandom", O_RDONLY);
+    if (key_fd != -1)
+    {
+        while (key_idx < sizeof (key_bytes))
+        {
+            ssize_t read_len = read(key_fd, &(key_bytes[key_idx]),
+                                   sizeof (key_bytes) - key_idx);
+            if (read_len > 0)
+            {
+                key_idx += (size_t) read_len;
+            }
+            else
+            if (read_len == 0 || errno != EINTR)
+            {
+                break;
+            }
+        }
+        close(key_fd);
+    }
+
+    if (key_idx == sizeof (key_bytes))
+    {
+        sstr_hash_key[0] = sstr_load64(&(key_bytes[0]));
+        sstr_hash_key[1] = sstr_load64(&(key_bytes[8]));
+    }
+    else
+    {
+        struct timespec key_time;
+        clock_gettime(CLOCK_MONOTONIC, &key_time);
+
+        sstr_hash_key[0] = sstr_xxh64_round((uint64_t) key_time.tv_nsec,
+                                            (uint64_t) getpid());
+        sstr_hash_key[1] = sstr_xxh64_round((uint64_t) key_time.tv_sec,
+                                            (uint64_t) (uintptr_t) &sstr_hash_key);
+    }
+
+    memset(key_bytes, 0, sizeof (key_bytes));
+}
+
+
+/**
+ * Load a 64 bit little-endian value
+ */
+static uint64_t sstr_load64(
+    const unsigned char *src_bytes
+)
+{
+    uint64_t value;
+
+    #if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    memcpy(&value, src_bytes, sizeof (value));
+    #else
+    value = 0;
+    for (size_t byte_idx = 0; byte_idx < 8; ++byte_idx)
+    {
+        value |= ((uint64_t) src_bytes[byte_idx]) << (byte_idx * 8);
+    }
+    #endif
+
+    return value;
+}
+
+
+/**
+ * Load a 32 bit little-endian value
+ */
+static uint32_t sstr_load32(
+    const unsigned char *src_bytes
+)
+{
+    uint32_t value;
+
+    #if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    memcpy(&value, src_bytes, sizeof (value));
+    #else
+    value = 0;
+    for (size_t byte_idx = 0; byte_idx < 4; ++byte_idx)
+    {
+        value |= ((uint32_t) src_bytes[byte_idx]) << (byte_idx * 8);
+    }
+    #endif
+
+    return value;
+}
+
+
+#define SSTR_SIPROUND \
+    do \
+    { \
+        v0 += v1; v1 = SSTR_ROTL64(v1, 13); v1 ^= v0; v0 = SSTR_ROTL64(v0, 32); \
+        v2 += v3; v3 = SSTR_ROTL64(v3, 16); v3 ^= v2; \
+        v0 += v3; v3 = SSTR_ROTL64(v3, 21); v3 ^= v0; \
+        v2 += v1; v1 = SSTR_ROTL64(v1, 17); v1 ^= v2; v2 = SSTR_ROTL64(v2, 32); \
+    } \
+    while (0)
+
+/**
+ * SipHash-1-3 (one compression round, three finalization rounds)
+ * with the per-process key
+ */
+static uint64_t sstr_siphash13(
+    const unsigned char *src_bytes,
+    size_t              src_len
+)
+{
+    pthread_once(&sstr_hash_key_once, sstr_hash_key_init);
+
+    uint64_t v0 = sstr_hash_key[0] ^ 0x736F6D6570736575ULL;
+    uint64_t v1 = sstr_hash_key[1] ^ 0x646F72616E646F6DULL;
+    uint64_t v2 = sstr_hash_key[0] ^ 0x6C7967656E657261ULL;
+    uint64_t v3 = sstr_hash_key[1] ^ 0x7465646279746573ULL;
+
+    size_t block_end = src_len - (src_len % 8);
+    for (size_t src_idx = 0; src_idx < block_end; src_idx += 8)
+    {
+        uint64_t msg = sstr_load64(&(src_bytes[src_idx]));
+        v3 ^= msg;
+        SSTR_SIPROUND;
+        v0 ^= msg;
+    }
+
+    // last block: remaining bytes plus the low byte of the length
+    uint64_t msg = ((uint64_t) src_len) << 56;
+    for (size_t src_idx = block_end; src_idx < src_len; ++src_idx)
+    {
+        msg |= ((uint64_t) src_bytes[src_idx]) << ((src_idx - block_end) * 8);
+    }
+    v3 ^= msg;
+    SSTR_SIPROUND;
+    v0 ^= msg;
+
+    v2 ^= 0xFF;
+    SSTR_SIPROUND;
+    SSTR_SIPROUND;
+    SSTR_SIPROUND;
+
+    return v0 ^ v1 ^ v2 ^ v3;
+}
+
+
+static uint64_t sstr_xxh64_round(
+    uint64_t acc,
+    uint64_t input
+)
+{
+    acc += input * SSTR_XXH_P2;
+    acc  = SSTR_ROTL64(acc, 31);
+    acc *= SSTR_XXH_P1;
+    return acc;
+}
+
+
+/**
+ * xxHash64 with a seed of zero
+ *
+ * Inputs of 32 bytes or more are processed in four independent lanes,
+ * which the CPU executes in parallel
+ */
+static uint64_t sstr_xxh64(
+    const unsigned char *src_bytes,
+    size_t              src_len
+)
+{
+    uint64_t hash;
+    size_t   src_idx = 0;
+
+    if (src_len >= 32)
+    {
+        uint64_t lane[4] =
+        {
+            SSTR_XXH_P1 + SSTR_XXH_P2,
+            SSTR_XXH_P2,
+            0,
+            0 - SSTR_XXH_P1
+        };
+
+        size_t stripe_end = src_len - (src_len % 32);
+        while (src_idx < stripe_end)
+        {
+            lane[0] = sstr_xxh64_round(lane[0], sstr_load64(&(src_bytes[src_idx])));
+            lane[1] = sstr_xxh64_round(lane[1], sstr_load64(&(src_bytes[src_idx + 8])));
+            lane[2] = sstr_xxh64_round(lane[2], sstr_load64(&(src_bytes[src_idx + 16])));
+            lane[3] = sstr_xxh64_round(lane[3], sstr_load64(&(src_bytes[src_idx + 24])));
+            src_idx += 32;
+        }
+
+        hash = SSTR_ROTL64(lane[0], 1) + SSTR_ROTL64(lane[1], 7) +
+               SSTR_ROTL64(lane[2], 12) + SSTR_ROTL64(lane[3], 18);
+        for (size_t lane_idx = 0; lane_idx < 4; ++lane_idx)
+        {
+            hash ^= sstr_xxh64_round(0, lane[lane_idx]);
+            hash  = hash * SSTR_XXH_P1 + SSTR_XXH_P4;
+        }
+    }
+    else
+    {
+        hash = SSTR_XXH_P5;
+    }
+
+    hash += (uint64_t) src_len;
+
+    while (src_len - src_idx >= 8)
+    {
+        hash ^= sstr_xxh64_round(0, sstr_load64(&(src_bytes[src_idx])));
+        hash  = SSTR_ROTL64(hash, 27) * SSTR_XXH_P1 + SSTR_XXH_P4;
+        src_idx += 8;
+    }
+    if (src_len - src_idx >= 4)
+    {
+        hash ^= (uint64_t) sstr_load32(&(src_bytes[src_idx])) * SSTR_XXH_P1;
+        hash  = SSTR_ROTL64(hash, 23) * SSTR_XXH_P2 + SSTR_XXH_P3;
+        src_idx += 4;
+    }
+    while (src_idx < src_len)
+    {
+        hash ^= (uint64_t) src_bytes[src_idx] * SSTR_XXH_P5;
+        hash  = SSTR_ROTL64(hash, 11) * SSTR_XXH_P1;
+        ++src_idx;
+    }
+
+    hash ^= hash >> 33;
+    hash *= SSTR_XXH_P2;
+    hash ^= hash >> 29;
+    hash *= SSTR_XXH_P3;
+    hash ^= hash >> 32;
+
+    return hash;
+}
@@ -0,0 +1,97 @@
+/**
+ * secureStrings library
+ * version 0.54-beta (2014-10-25_001)
+ *
+ * secureStrings hash functions
+ *
+ * Copyright (C) 2010, 2014 Robert ALTNOEDER
+ *
+ * Redistribution and use in source and binary forms,
+ * with or without modification, are permitted provided that
+ * the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in
+ *     the documentation and/or other materials provided with the distribution.
+ *  3. The name of the author may not be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _SECURESTR_HASH_H
+#define _SECURESTR_HASH_H
+
+#include <unistd.h>
+#include <sys/types.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <securestr.h>
+
+// datatype for hash values
+typedef uint64_t sstr_hashval;
+
+
+/**
+ * Calculate the keyed hash value of a string
+ *
+ * Uses SipHash-1-3 with a random key that is generated once per process,
+ * so hash values are not predictable for an attacker and must not be
+ * stored or sent to other processes
+ */
+sstr_rc sstr_hash(
+    const sstring *src_str,
+    sstr_hashval  *dst_hash
+);
+
+
+/**
+ * Calculate the keyed hash value of a C string
+ */
+sstr_rc sstr_hashcstr(
+    const char   *src_cstr,
+    sstr_hashval *dst_hash,
+    size_t       cstr_len
+);
+
+
+/**
+ * Calculate the non-keyed hash value of a string
+ *
+ * Much faster than sstr_hash() on long strings, but must only be used
+ * for trusted data, because collisions can be produced deliberately.
+ * Hash values are stable across processes.
+ */
+sstr_rc sstr_hash_fast(
+    const sstring *src_str,
+    sstr_hashval  *dst_hash
+);
+
+
+/**
+ * Calculate the non-keyed hash value of a C string
+ */
+sstr_rc sstr_hash_fastcstr(
+    const char   *src_cstr,
+    sstr_hashval *dst_hash,
+    size_t       cstr_len
+);
+
+
+#define sstrHash            sstr_hash
+#define sstrHashCstr        sstr_hashcstr
+#define sstrHashFast        sstr_hash_fast
+#define sstrHashFastCstr    sstr_hash_fastcstr
+
+#endif /* _SECURESTR_HASH_H */
@@ -0,0 +1,781 @@
+/**
+ * secureStrings library
+ * version 0.54-beta (2014-10-25_001)
+ *
+ * secureStrings file descriptor I/O functions
+ *
+ * Copyright (C) 2010, 2014 Robert ALTNOEDER
+ *
+ * Redistribution and use in source and binary forms,
+ * with or without modification, are permitted provided that
+ * the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in
+ *     the documentation and/or other materials provided with the distribution.
+ *  3. The name of the author may not be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+// MAP_ANONYMOUS and madvise()
+#define _DEFAULT_SOURCE
+
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/uio.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <limits.h>
+#include <stdint.h>
+#include <securestr.h>
+#include <securestr_io.h>
+
+#ifdef __SSE2__
+    #include <emmintrin.h>
+#endif
+#ifdef __AVX2__
+    #include <immintrin.h>
+#endif
+
+// maximum number of strings per writev() call
+#if defined(IOV_MAX) && IOV_MAX < 64
+    #define SSTR_IO_IOV_BATCH ((size_t) IOV_MAX)
+#else
+    #define SSTR_IO_IOV_BATCH ((size_t) 64)
+#endif
+
+#if !defined(MAP_ANONYMOUS) && defined(MAP_ANON)
+    #define MAP_ANONYMOUS MAP_ANON
+#endif
+
+struct sstr_linereader_struct
+{
+    int     fd;
+    // read buffer of cap + 1 chars; the extra char terminates
+    // a last line that has no newline character
+    char    *chars;
+    size_t  cap;
+    // buffered data is chars[start] to chars[end - 1]
+    size_t  start;
+    size_t  end;
+    // there is no newline character before chars[scan]
+    size_t  scan;
+    // end of the current line and start of the following line
+    size_t  line_end;
+    size_t  next;
+    int     eof;
+    // read-only view of the current line
+    sstring view;
+};
+
+struct sstr_mapping_struct
+{
+    // read-only view of the mapped file
+    sstring str;
+    // length of the mapped region, a multiple of the page size
+    size_t  map_len;
+};
+
+static int sstr_io_read_all(
+    int     src_fd,
+    sstring *dst_str
+);
+static sstr_rc sstr_linereader_find(
+    sstr_linereader *src_reader
+);
+static void sstr_linereader_advance(
+    sstr_linereader *src_reader
+);
+static size_t sstr_io_find_newline(
+    const char *src_chars,
+    size_t     src_idx,
+    size_t     src_end
+);
+#ifdef __SSE2__
+static unsigned int sstr_io_lowbit(
+    unsigned int mask
+);
+#endif /* __SSE2__ */
+
+
+/**
+ * Read from a file descriptor until end of file (overwrite)
+ *
+ * Fails if the data does not fit into dst_str or if a read error
+ * occurs; in both cases, dst_str is wiped
+ */
+sstr_rc sstr_read_fd(
+    int     src_fd,
+    sstring *dst_str
+)
+{
+    sstr_rc sstr_status = SSTR_FAIL;
+
+    if (dst_str != NULL)
+    {
+        dst_str->len = 0;
+        if (sstr_io_read_all(src_fd, dst_str))
+        {
+            sstr_status = SSTR_PASS;
+        }
+        else
+        {
+            sstr_wipe(dst_str);
+        }
+    }
+
+    return sstr_status;
+}
+
+
+/**
+ * Read from a file descriptor until end of file and append the data
+ *
+ * Fails if the data does not fit into dst_str or if a read error
+ * occurs; in both cases, the appended data is wiped and dst_str
+ * keeps its previous length
+ */
+sstr_rc sstr_appd_read_fd(
+    int     src_fd,
+    sstring *dst_str
+)
+{
+    sstr_rc sstr_status = SSTR_FAIL;
+
+    if (dst_str != NULL)
+    {
+        size_t prev_len = dst_str->len;
+        if (sstr_io_read_all(src_fd, dst_str))
+        {
+            sstr_status = SSTR_PASS;
+        }
+        else
+        {
+            // the terminator slot may hold data, too
+            memset(&(dst_str->chars[prev_len]), '\0', dst_str->cap - prev_len + 1);
+            dst_str->len = prev_len;
+        }
+    }
+
+    return sstr_status;
+}
+
+
+/**
+ * Write a string to a file descriptor
+ */
+sstr_rc sstr_write_fd(
+    const sstring *src_str,
+    int           dst_fd
+)
+{
+    sstr_rc sstr_status = SSTR_FAIL;
+
+    if (src_str != NULL)
+    {
+        size_t src_idx = 0;
+        int    failed  = 0;
+        while (!failed && src_idx < src_str->len)
+        {
+            ssize_t write_len = write(dst_fd, &(src_str->chars[src_idx]),
+                                      src_str->len - src_idx);
+            if (write_len >= 0)
+            {
+                src_idx += (size_t) write_len;
+            }
+            else
+            {
+                failed = errno != EINTR;
+            }
+        }
+
+        if (!failed)
+        {
+            sstr_status = SSTR_PASS;
+        }
+    }
+
+    return sstr_status;
+}
+
+
+/**
+ * Write an array of strings to a file descriptor
+ *
+ * The strings are written with writev(), in a single system call unless
+ * there are more strings than the batch size or the write is short
+ */
+sstr_rc sstr_writev_fd(
+    const sstring * const *src_strs,
+    size_t                src_count,
+    int                   dst_fd
+)
+{
+    sstr_rc sstr_status = SSTR_FAIL;
+
+    if (src_strs != NULL)
+    {
+        int valid = 1;
+        for (size_t str_idx = 0; valid && str_idx < src_count; ++str_idx)
+        {
+            valid = src_strs[str_idx] != NULL;
+        }
+
+        // index of the next string and offset into it
+        size_t str_idx = 0;
+        size_t str_off = 0;
+        int    failed  = !valid;
+        while (!failed && str_idx < src_count)
+        {
+            struct iovec iov[SSTR_IO_IOV_BATCH];
+            size_t       iov_count = 0;
+            for (size_t batch_idx = str_idx;
+                 batch_idx < src_count && iov_count < SSTR_IO_IOV_BATCH;
+                 ++batch_idx)
+            {
+                size_t chars_off = batch_idx == str_idx ? str_off : 0;
+                iov[iov_count].iov_base = &(src_strs[batch_idx]->chars[chars_off]);
+                iov[iov_count].iov_len  = src_strs[batch_idx]->len - chars_off;
+                ++iov_count;
+            }
+
+            ssize_t write_len = writev(dst_fd, iov, (int) iov_count);
+            if (write_len >= 0)
+            {
+                // advance past the strings that were written completely
+                size_t done_len = (size_t) write_len;
+                while (str_idx < src_count && done_len >= src_strs[str_idx]->len - str_off)
+                {
+                    done_len -= src_strs[str_idx]->len - str_off;
+                    str_off = 0;
+                    ++str_idx;
+                }
+                str_off += done_len;
+            }
+            else
+            {
+                failed = errno != EINTR;
+            }
+        }
+
+        if (!failed)
+        {
+            sstr_status = SSTR_PASS;
+        }
+    }
+
+    return sstr_status;
+}
+
+
+#ifndef _SSTR_NO_DYNMEM
+/**
+ * Create a line reader for a file descriptor
+ *
+ * buf_cap is the capacity of the read buffer and the maximum length
+ * of a line, including its newline character
+ */
+sstr_linereader *sstr_linereader_open(
+    int    src_fd,
+    size_t buf_cap
+)
+{
+    sstr_linereader *dst_reader = NULL;
+
+    if (buf_cap > 0 && buf_cap <= SSTR_CAP_MAX)
+    {
+        dst_reader = malloc(sizeof (sstr_linereader));
+        if (dst_reader != NULL)
+        {
+            dst_reader->chars = malloc(buf_cap + 1);
+            if (dst_reader->chars != NULL)
+            {
+                dst_reader->fd       = src_fd;
+                dst_reader->cap      = buf_cap;
+                dst_reader->start    = 0;
+                dst_reader->end      = 0;
+                dst_reader->scan     = 0;
+                dst_reader->line_end = 0;
+                dst_reader->next     = 0;
+                dst_reader->eof      = 0;
+                dst_reader->view.chars = dst_reader->chars;
+                dst_reader->view.cap   = 0;
+                dst_reader->view.len   = 0;
+                dst_reader->chars[0] = '\0';
+            }
+            else
+            {
+                free(dst_reader);
+                dst_reader = NULL;
+            }
+        }
+    }
+
+    return dst_reader;
+}
+
+
+/**
+ * Wipe the read buffer and deallocate a line reader
+ *
+ * The file descriptor is not closed
+ */
+void sstr_linereader_close(
+    sstr_linereader *dst_reader
+)
+{
+    if (dst_reader != NULL)
+    {
+        memset(dst_reader->chars, '\0', dst_reader->cap + 1);
+        free(dst_reader->chars);
+        free(dst_reader);
+    }
+}
+#endif /* not _SSTR_NO_DYNMEM */
+
+
+/**
+ * Read the next line as a read-only view into the read buffer
+ *
+ * The view remains valid until the next call for the same reader.
+ * Returns SSTR_TRUE if a line was read, SSTR_FALSE at the end of file
+ * and SSTR_FAIL on read errors and lines longer than the buffer.
+ */
+sstr_rc sstr_linereader_view(
+    sstr_linereader *src_reader,
+    const sstring   **dst_view
+)
+{
+    sstr_rc sstr_status = SSTR_FAIL;
+
+    if (src_reader != NULL && dst_view != NULL)
+    {
+        sstr_status = sstr_linereader_find(src_reader);
+        if (sstr_status == SSTR_TRUE)
+        {
+            // the newline character is replaced by the terminator
+            src_reader->chars[src_reader->line_end] = '\0';
+            src_reader->view.chars = &(src_reader->chars[src_reader->start]);
+            src_reader->view.len   = src_reader->line_end - src_reader->start;
+            src_reader->view.cap   = src_reader->view.len;
+            (*dst_view) = &(src_reader->view);
+
+            sstr_linereader_advance(src_reader);
+        }
+    }
+
+    return sstr_status;
+}
+
+
+/**
+ * Read the next line into a string (overwrite)
+ *
+ * Returns SSTR_TRUE if a line was read, SSTR_FALSE at the end of file
+ * and SSTR_FAIL on read errors and lines longer than the buffer.
+ * If the line does not fit into dst_str, SSTR_FAIL is returned and
+ * the line is not consumed.
+ */
+sstr_rc sstr_linereader_copy(
+    sstr_linereader *src_reader,
+    sstring         *dst_str
+)
+{
+    sstr_rc sstr_status = SSTR_FAIL;
+
+    if (src_reader != NULL && dst_str != NULL)
+    {
+        sstr_status = sstr_linereader_find(src_reader);
+        if (sstr_status == SSTR_TRUE)
+        {
+            size_t line_len = src_reader->line_end - src_reader->start;
+            if (line_len <= dst_str->cap)
+            {
+                memcpy(dst_str->chars, &(src_reader->chars[src_reader->start]), line_len);
+
+                // update destination secureString length
+                dst_str->len = line_len;
+                // terminate destination secureString with a null-character
+                dst_str->chars[dst_str->len] = '\0';
+
+                sstr_linereader_advance(src_reader);
+            }
+            else
+            {
+                sstr_status = SSTR_FAIL;
+            }
+        }
+    }
+
+    return sstr_status;
+}
+
+
+#ifndef _SSTR_NO_DYNMEM
+/**
+ * Map a regular file read-only into memory
+ *
+ * The kernel is advised that the file will be read sequentially and
+ * soon. Returns NULL if the file cannot be opened or mapped.
+ */
+sstr_mapping *sstr_map_file(
+    const char *file_path
+)
+{
+    sstr_mapping *dst_mapping = NULL;
+
+    if (file_path != NULL)
+    {
+        int         src_fd = open(file_path, O_RDONLY);
+        struct stat src_stat;
+        if (src_fd >= 0)
+        {
+            if (fstat(src_fd, &src_stat) == 0 && S_ISREG(src_stat.st_mode) &&
+                (uintmax_t) src_stat.st_size < (uintmax_t) SSTR_CAP_MAX)
+            {
+                dst_mapping = malloc(sizeof (sstr_mapping));
+            }
+            if (dst_mapping != NULL)
+            {
+                size_t file_len  = (size_t) src_stat.st_size;
+                size_t page_size = (size_t) sysconf(_SC_PAGESIZE);
+                // the terminator of the view needs one char after the file
+                // contents; if the file fills its last page, that char is on
+                // an anonymous zero page that is reserved together with the
+                // region for the file
+                dst_mapping->map_len = (file_len / page_size + 1) * page_size;
+
+                char *map_chars = mmap(NULL, dst_mapping->map_len, PROT_READ,
+                                       MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+                if (map_chars != MAP_FAILED && file_len > 0 &&
+                    mmap(map_chars, file_len, PROT_READ, MAP_PRIVATE | MAP_FIXED,
+                         src_fd, 0) == MAP_FAILED)
+                {
+                    munmap(map_chars, dst_mapping->map_len);
+                    map_chars = MAP_FAILED;
+                }
+
+                if (map_chars != MAP_FAILED)
+                {
+                    #ifdef MADV_DONTDUMP
+                    madvise(map_chars, dst_mapping->map_len, MADV_DONTDUMP);
+                    #endif
+                    posix_madvise(map_chars, dst_mapping->map_len, POSIX_MADV_SEQUENTIAL);
+                    posix_madvise(map_chars, dst_mapping->map_len, POSIX_MADV_WILLNEED);
+
+                    dst_mapping->str.chars = map_chars;
+                    dst_mapping->str.cap   = file_len;
+                    dst_mapping->str.len   = file_len;
+                }
+                else
+                {
+                    free(dst_mapping);
+                    dst_mapping = NULL;
+                }
+            }
+            // the mapping remains valid after the file is closed
+            close(src_fd);
+        }
+    }
+
+    return dst_mapping;
+}
+
+
+/**
+ * Unmap a file and deallocate its mapping
+ *
+ * Views of the mapping become invalid
+ */
+void sstr_unmap_file(
+    sstr_mapping *dst_mapping
+)
+{
+    if (dst_mapping != NULL)
+    {
+        munmap(dst_mapping->str.chars, dst_mapping->map_len);
+        free(dst_mapping);
+    }
+}
+#endif /* not _SSTR_NO_DYNMEM */
+
+
+/**
+ * Get a read-only view of a mapped file
+ *
+ * The view remains valid until the file is unmapped
+ */
+const sstring *sstr_mapping_str(
+    const sstr_mapping *src_mapping
+)
+{
+    const sstring *dst_view = NULL;
+
+    if (src_mapping != NULL)
+    {
+        dst_view = &(src_mapping->str);
+    }
+
+    return dst_view;
+}
+
+
+/**
+ * Read until end of file, appending to dst_str
+ *
+ * Each read() may also fill the terminator slot at chars[cap]; data in
+ * that slot shows that the input does not fit without an extra read
+ * after the capacity is exhausted. Returns 0 on overflow or read error.
+ */
+static int sstr_io_read_all(
+    int     src_fd,
+    sstring *dst_str
+)
+{
+    int valid = 1;
+    int eof   = 0;
+
+    while (valid && !eof)
+    {
+        ssize_t read_len = read(src_fd, &(dst_str->chars[dst_str->len]),
+                                dst_str->cap - dst_str->len + 1);
+        if (read_len > 0)
+        {
+            dst_str->len += (size_t) read_len;
+            valid = dst_str->len <= dst_str->cap;
+        }
+        else
+        if (read_len == 0)
+        {
+            eof = 1;
+        }
+        else
+        {
+            valid = errno == EINTR;
+        }
+    }
+
+    if (valid)
+    {
+        // terminate destination secureString with a null-character
+        dst_str->chars[dst_str->len] = '\0';
+    }
+
+    return valid;
+}
+
+
+/**
+ * Find the end of the next line, reading more data as required
+ *
+ * Sets line_end and next; the reader is not advanced
+ */
+static sstr_rc sstr_linereader_find(
+    sstr_linereader *src_reader
+)
+{
+    sstr_rc sstr_status = SSTR_FAIL;
+    int     searching   = 1;
+
+    while (searching)
+    {
+        size_t nl_idx = sstr_io_find_newline(src_reader->chars, src_reader->scan,
+                                             src_reader->end);
+        if (nl_idx < src_reader->end)
+        {
+            src_reader->line_end = nl_idx;
+            src_reader->next     = nl_idx + 1;
+            sstr_status = SSTR_TRUE;
+            searching   = 0;
+        }
+        else
+        {
+            src_reader->scan = src_reader->end;
+            if (src_reader->eof)
+            {
+                // a last line without a newline character
+                if (src_reader->start < src_reader->end)
+                {
+                    src_reader->line_end = src_reader->end;
+                    src_reader->next     = src_reader->end;
+                    sstr_status = SSTR_TRUE;
+                }
+                else
+                {
+                    sstr_status = SSTR_FALSE;
+                }
+                searching = 0;
+            }
+            else
+            {
+                if (src_reader->end == src_reader->cap)
+                {
+                    if (src_reader->start == 0)
+                    {
+                        // the line does not fit into the buffer
+                        searching = 0;
+                    }
+                    else
+                    {
+                        // move the partial line to the start of the buffer
+                        size_t part_len = src_reader->end - src_reader->start;
+                        memmove(src_reader->chars, &(src_reader->chars[src_reader->start]),
+                                part_len);
+                        src_reader->start = 0;
+                        src_reader->end   = part_len;
+                        src_reader->scan  = part_len;
+                    }
+                }
+
+                if (searching)
+                {
+                    ssize_t read_len = read(src_reader->fd,
+                                            &(src_reader->chars[src_reader->end]),
+                                            src_reader->cap - src_reader->end);
+                    if (read_len > 0)
+                    {
+                        src_reader->end += (size_t) read_len;
+                    }
+                    else
+                    if (read_len == 0)
+                    {
+                        src_reader->eof = 1;
+                    }
+                    else
+                    if (errno != EINTR)
+                    {
+                        searching = 0;
+                    }
+                }
+            }
+        }
+    }
+
+    return sstr_status;
+}
+
+
+/**
+ * Advance a line reader to the line following the current line
+ */
+static void sstr_linereader_advance(
+    sstr_linereader *src_reader
+)
+{
+    if (src_reader->next == src_reader->end)
+    {
+        // the buffer is empty; reuse it from the start
+        src_reader->start = 0;
+        src_reader->end   = 0;
+        src_reader->scan  = 0;
+    }
+    else
+    {
+        src_reader->start = src_reader->next;
+        src_reader->scan  = src_reader->next;
+    }
+}
+
+
+/**
+ * Index of the first newline character from src_idx to src_end - 1,
+ * or src_end
+ */
+static size_t sstr_io_find_newline(
+    const char *src_chars,
+    size_t     src_idx,
+    size_t     src_end
+)
+{
+    int found = 0;
+
+    #ifdef __AVX2__
+    while (!found && src_end - src_idx >= 32)
+    {
+        unsigned int mask = (unsigned int) _mm256_movemask_epi8(_mm256_cmpeq_epi8(
+            _mm256_loadu_si256((const __m256i *) &(src_chars[src_idx])),
+            _mm256_set1_epi8('\n')));
+        if (mask == 0)
+        {
+            src_idx += 32;
+        }
+        else
+        {
+            src_idx += sstr_io_lowbit(mask);
+            found = 1;
+        }
+    }
+    #endif /* __AVX2__ */
+
+    #ifdef __SSE2__
+    while (!found && src_end - src_idx >= 16)
+    {
+        unsigned int mask = (unsigned int) _mm_movemask_epi8(_mm_cmpeq_epi8(
+            _mm_loadu_si128((const __m128i *) &(src_chars[src_idx])), _mm_set1_epi8('\n')));
+        if (mask == 0)
+        {
+            src_idx += 16;
+        }
+        else
+        {
+            src_idx += sstr_io_lowbit(mask);
+            found = 1;
+        }
+    }
+    #endif /* __SSE2__ */
+
+    while (!found && src_idx < src_end)
+    {
+        if (src_chars[src_idx] == '\n')
+        {
+            found = 1;
+        }
+        else
+        {
+            ++src_idx;
+        }
+    }
+
+    return src_idx;
+}
+
+
+#ifdef __SSE2__
+/**
+ * Index of the lowest set bit in a non-zero mask
+ */
+static unsigned int sstr_io_lowbit(
+    unsigned int mask
+)
+{
+    #ifdef __GNUC__
+    return (unsigned int) __builtin_ctz(mask);
+    #else
+    unsigned int bit_idx = 0;
+    while ((mask & 1U) == 0)
+    {
+        mask >>= 1;
+        ++bit_idx;
+    }
+    return bit_idx;
+    #endif /* __GNUC__ */
+}
+#endif /* __SSE2__ */
@@ -0,0 +1,206 @@
+/**
+ * secureStrings library
+ * version 0.54-beta (2014-10-25_001)
+ *
+ * secureStrings file descriptor I/O functions
+ *
+ * Copyright (C) 2010, 2014 Robert ALTNOEDER
+ *
+ * Redistribution and use in source and binary forms,
+ * with or without modification, are permitted provided that
+ * the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in
+ *     the documentation and/or other materials provided with the distribution.
+ *  3. The name of the author may not be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _SECURESTR_IO_H
+#define _SECURESTR_IO_H
+
+#include <unistd.h>
+#include <sys/types.h>
+#include <stdlib.h>
+#include <securestr.h>
+
+// The I/O functions transfer data directly between a file descriptor
+// and the char array of a secureString, without intermediate buffers.
+// Interrupted system calls and short reads and writes are retried;
+// file descriptors are expected to be in blocking mode.
+
+// An sstr_linereader reads lines from a file descriptor into a read
+// buffer that it owns; the buffer is wiped when the reader is closed.
+// Lines are returned without the terminating newline character.
+typedef struct sstr_linereader_struct sstr_linereader;
+
+// An sstr_mapping is a file that is mapped read-only into memory
+//
+// sstr_mapping_str() provides a read-only view of the file contents,
+// which is accepted by all functions that take a const sstring source
+// argument. The mapping is excluded from core dumps and is unmapped
+// by sstr_unmap_file().
+typedef struct sstr_mapping_struct sstr_mapping;
+
+
+/**
+ * Read from a file descriptor until end of file (overwrite)
+ *
+ * Fails if the data does not fit into dst_str or if a read error
+ * occurs; in both cases, dst_str is wiped
+ */
+sstr_rc sstr_read_fd(
+    int     src_fd,
+    sstring *dst_str
+);
+
+
+/**
+ * Read from a file descriptor until end of file and append the data
+ *
+ * Fails if the data does not fit into dst_str or if a read error
+ * occurs; in both cases, the appended data is wiped and dst_str
+ * keeps its previous length
+ */
+sstr_rc sstr_appd_read_fd(
+    int     src_fd,
+    sstring *dst_str
+);
+
+
+/**
+ * Write a string to a file descriptor
+ */
+sstr_rc sstr_write_fd(
+    const sstring *src_str,
+    int           dst_fd
+);
+
+
+/**
+ * Write an array of strings to a file descriptor
+ *
+ * The strings are written with writev(), in a single system call unless
+ * there are more strings than the batch size or the write is short
+ */
+sstr_rc sstr_writev_fd(
+    const sstring * const *src_strs,
+    size_t                src_count,
+    int                   dst_fd
+);
+
+
+#ifndef _SSTR_NO_DYNMEM
+/**
+ * Create a line reader for a file descriptor
+ *
+ * buf_cap is the capacity of the read buffer and the maximum length
+ * of a line, including its newline character
+ */
+sstr_linereader *sstr_linereader_open(
+    int    src_fd,
+    size_t buf_cap
+);
+
+
+/**
+ * Wipe the read buffer and deallocate a line reader
+ *
+ * The file descriptor is not closed
+ */
+void sstr_linereader_close(
+    sstr_linereader *dst_reader
+);
+#endif /* not _SSTR_NO_DYNMEM */
+
+
+/**
+ * Read the next line as a read-only view into the read buffer
+ *
+ * The view remains valid until the next call for the same reader.
+ * Returns SSTR_TRUE if a line was read, SSTR_FALSE at the end of file
+ * and SSTR_FAIL on read errors and lines longer than the buffer.
+ */
+sstr_rc sstr_linereader_view(
+    sstr_linereader *src_reader,
+    const sstring   **dst_view
+);
+
+
+/**
+ * Read the next line into a string (overwrite)
+ *
+ * Returns SSTR_TRUE if a line was read, SSTR_FALSE at the end of file
+ * and SSTR_FAIL on read errors and lines longer than the buffer.
+ * If the line does not fit into dst_str, SSTR_FAIL is returned and
+ * the line is not consumed.
+ */
+sstr_rc sstr_linereader_copy(
+    sstr_linereader *src_reader,
+    sstring         *dst_str
+);
+
+
+#ifndef _SSTR_NO_DYNMEM
+/**
+ * Map a regular file read-only into memory
+ *
+ * The kernel is advised that the file will be read sequentially and
+ * soon. Returns NULL if the file cannot be opened or mapped.
+ */
+sstr_mapping *sstr_map_file(
+    const char *file_path
+);
+
+
+/**
+ * Unmap a file and deallocate its mapping
+ *
+ * Views of the mapping become invalid
+ */
+void sstr_unmap_file(
+    sstr_mapping *dst_mapping
+);
+#endif /* not _SSTR_NO_DYNMEM */
+
+
+/**
+ * Get a read-only view of a mapped file
+ *
+ * The view remains valid until the file is unmapped
+ */
+const sstring *sstr_mapping_str(
+    const sstr_mapping *src_mapping
+);
+
+
+#define sstrLineReader      sstr_linereader
+#define sstrMapping         sstr_mapping
+
+#define sstrReadFd          sstr_read_fd
+#define sstrAppdReadFd      sstr_appd_read_fd
+#define sstrWriteFd         sstr_write_fd
+#define sstrWritevFd        sstr_writev_fd
+#define sstrLineReaderOpen  sstr_linereader_open
+#define sstrLineReaderClose sstr_linereader_close
+#define sstrLineReaderView  sstr_linereader_view
+#define sstrLineReaderCopy  sstr_linereader_copy
+#define sstrMapFile         sstr_map_file
+#define sstrUnmapFile       sstr_unmap_file
+#define sstrMappingStr      sstr_mapping_str
+
+#endif /* _SECURESTR_IO_H */
@@ -0,0 +1,677 @@
+/**
+ * secureStrings library
+ * version 0.54-beta (2014-10-25_001)
+ *
+ * secureStrings map container
+ *
+ * Copyright (C) 2010, 2014 Robert ALTNOEDER
+ *
+ * Redistribution and use in source and binary forms,
+ * with or without modification, are permitted provided that
+ * the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in
+ *     the documentation and/or other materials provided with the distribution.
+ *  3. The name of the author may not be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <unistd.h>
+#include <sys/types.h>
+#include <stdlib.h>
+#include <string.h>
+#include <securestr.h>
+#include <securestr_hash.h>
+#include <securestr_map.h>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif /* __SSE2__ */
+
+// number of slots in a group of slots
+#define SSTR_MAP_GROUP    ((size_t) 16)
+
+// control byte values; a full slot's control byte holds the lower
+// 7 bits of the key's hash, so only free slots have the high bit set
+#define SSTR_MAP_EMPTY    ((unsigned char) 0x80)
+#define SSTR_MAP_DELETED  ((unsigned char) 0xFE)
+#define SSTR_MAP_TAG(hash) ((unsigned char) ((hash) & 0x7F))
+
+static unsigned int sstr_map_match(
+    const unsigned char *group,
+    unsigned char       tag
+);
+static unsigned int sstr_map_lowbit(
+    unsigned int mask
+);
+static sstr_pos sstr_map_find(
+    const sstr_map *src_map,
+    const char     *key_chars,
+    size_t         key_len,
+    sstr_hashval   key_hash
+);
+#ifndef _SSTR_NO_DYNMEM
+static unsigned int sstr_map_match_free(
+    const unsigned char *group
+);
+static sstr_pos sstr_map_find_free(
+    const sstr_map *src_map,
+    sstr_hashval   key_hash
+);
+static sstr_rc sstr_map_purge(
+    sstr_map *dst_map
+);
+static sstring *sstr_map_dup(
+    const sstring *src_str
+);
+static void sstr_map_discard(
+    sstring *dst_str
+);
+static sstr_rc sstr_map_erase_chars(
+    const char *key_chars,
+    size_t     key_len,
+    sstr_map   *dst_map
+);
+#endif /* not _SSTR_NO_DYNMEM */
+
+
+#ifndef _SSTR_NO_DYNMEM
+/**
+ * Allocate a map
+ *
+ * entry_cap is the number of entries that will be available
+ */
+sstr_map *sstr_map_alloc(
+    size_t entry_cap
+)
+{
+    sstr_map *dst_map = NULL;
+
+    // a maximum load of 7/8 of the slots keeps probe sequences short
+    size_t slot_cap = SSTR_MAP_GROUP;
+    while (slot_cap / 8 * 7 < entry_cap &&
+           slot_cap <= (SSTR_SIZE_T_MAX / 2) / sizeof (sstr_map_slot))
+    {
+        slot_cap *= 2;
+    }
+
+    if (slot_cap / 8 * 7 >= entry_cap)
+    {
+        dst_map = malloc(sizeof (sstr_map));
+        if (dst_map != NULL)
+        {
+            dst_map->ctrl  = malloc(slot_cap);
+            dst_map->slots = malloc(slot_cap * sizeof (sstr_map_slot));
+            if (dst_map->ctrl != NULL && dst_map->slots != NULL)
+            {
+                memset(dst_map->ctrl, SSTR_MAP_EMPTY, slot_cap);
+                dst_map->slot_cap = slot_cap;
+                dst_map->used_max = slot_cap / 8 * 7;
+                dst_map->used     = 0;
+                dst_map->count    = 0;
+            }
+            else
+            {
+                free(dst_map->ctrl);
+                free(dst_map->slots);
+                free(dst_map);
+                dst_map = NULL;
+            }
+        }
+    }
+
+    return dst_map;
+}
+#endif /* not _SSTR_NO_DYNMEM */
+
+
+#ifndef _SSTR_NO_DYNMEM
+/**
+ * Deallocate a map, wiping all keys and values
+ */
+void sstr_map_dealloc(
+    sstr_map *dst_map
+)
+{
+    if (dst_map != NULL)
+    {
+        for (sstr_pos slot_idx = 0; slot_idx < dst_map->slot_cap; ++slot_idx)
+        {
+            if ((dst_map->ctrl[slot_idx] & 0x80) == 0)
+            {
+                sstr_map_discard(dst_map->slots[slot_idx].key);
+                sstr_map_discard(dst_map->slots[slot_idx].value);
+            }
+        }
+        free(dst_map->ctrl);
+        free(dst_map->slots);
+        free(dst_map);
+    }
+}
+#endif /* not _SSTR_NO_DYNMEM */
+
+
+#ifndef _SSTR_NO_DYNMEM
+/**
+ * Insert an entry into a map, or overwrite the value of an existing entry
+ *
+ * value_str may be the value returned by sstr_map_get() for the same key.
+ */
+sstr_rc sstr_map_put(
+    const sstring *key_str,
+    const sstring *value_str,
+    sstr_map      *dst_map
+)
+{
+    sstr_rc sstr_status = SSTR_FAIL;
+
+    if (key_str != NULL && value_str != NULL && dst_map != NULL)
+    {
+        sstr_hashval key_hash;
+        sstr_hash(key_str, &key_hash);
+
+        sstr_pos slot_idx = sstr_map_find(dst_map, key_str->chars, key_str->len,
+                                          key_hash);
+        if (slot_idx != SSTR_NPOS)
+        {
+            // overwrite the value of the existing entry
+            sstring *dst_value = dst_map->slots[slot_idx].value;
+            if (dst_value->chars == value_str->chars)
+            {
+                // the value is the entry's own value, e.g. from sstr_map_get()
+                sstr_status = SSTR_PASS;
+            }
+            else
+            if (dst_value->cap >= value_str->len)
+            {
+                size_t prev_len = dst_value->len;
+
+                memmove(dst_value->chars, value_str->chars, value_str->len);
+                // zero the chars of the previous value after the new end
+                if (prev_len > value_str->len)
+                {
+                    memset(&(dst_value->chars[value_str->len + 1]), '\0',
+                           prev_len - value_str->len);
+                }
+                dst_value->len = value_str->len;
+                dst_value->chars[dst_value->len] = '\0';
+
+                sstr_status = SSTR_PASS;
+            }
+            else
+            {
+                sstring *new_value = sstr_map_dup(value_str);
+                if (new_value != NULL)
+                {
+                    sstr_map_discard(dst_value);
+                    dst_map->slots[slot_idx].value = new_value;
+
+                    sstr_status = SSTR_PASS;
+                }
+            }
+        }
+        else
+        {
+            slot_idx = sstr_map_find_free(dst_map, key_hash);
+            if (dst_map->ctrl[slot_idx] == SSTR_MAP_EMPTY &&
+                dst_map->used >= dst_map->used_max)
+            {
+                // all free slots that do not end a probe sequence are
+                // deleted slots; rebuild the map to reclaim them
+                slot_idx = SSTR_NPOS;
+                if (dst_map->count < dst_map->used_max &&
+                    sstr_map_purge(dst_map) == SSTR_PASS)
+                {
+                    slot_idx = sstr_map_find_free(dst_map, key_hash);
+                }
+            }
+
+            if (slot_idx != SSTR_NPOS)
+            {
+                sstring *new_key   = sstr_map_dup(key_str);
+                sstring *new_value = sstr_map_dup(value_str);
+                if (new_key != NULL && new_value != NULL)
+                {
+                    if (dst_map->ctrl[slot_idx] == SSTR_MAP_EMPTY)
+                    {
+                        ++(dst_map->used);
+                    }
+                    dst_map->ctrl[slot_idx]        = SSTR_MAP_TAG(key_hash);
+                    dst_map->slots[slot_idx].key   = new_key;
+                    dst_map->slots[slot_idx].value = new_value;
+                    ++(dst_map->count);
+
+                    sstr_status = SSTR_PASS;
+                }
+                else
+                {
+                    sstr_map_discard(new_key);
+                    sstr_map_discard(new_value);
+                }
+            }
+        }
+    }
+
+    return sstr_status;
+}
+#endif /* not _SSTR_NO_DYNMEM */
+
+
+/**
+ * Find the value of an entry in a map
+ *
+ * Returns NULL if the map does not contain the key
+ */
+const sstring *sstr_map_get(
+    const sstr_map *src_map,
+    const sstring  *key_str
+)
+{
+    const sstring *dst_value = NULL;
+
+    if (src_map != NULL && key_str != NULL)
+    {
+        dst_value = sstr_map_getcstr(src_map, key_str->chars, key_str->len);
+    }
+
+    return dst_value;
+}
+
+
+/**
+ * Find the value of an entry in a map, using a C string as the key
+ */
+const sstring *sstr_map_getcstr(
+    const sstr_map *src_map,
+    const char     *key_cstr,
+    size_t         cstr_len
+)
+{
+    const sstring *dst_value = NULL;
+
+    if (src_map != NULL && key_cstr != NULL)
+    {
+        sstr_hashval key_hash;
+        sstr_hashcstr(key_cstr, &key_hash, cstr_len);
+
+        sstr_pos slot_idx = sstr_map_find(src_map, key_cstr, cstr_len, key_hash);
+        if (slot_idx != SSTR_NPOS)
+        {
+            dst_value = src_map->slots[slot_idx].value;
+        }
+    }
+
+    return dst_value;
+}
+
+
+#ifndef _SSTR_NO_DYNMEM
+/**
+ * Remove an entry from a map, wiping its key and value
+ *
+ * Returns SSTR_FAIL if the map does not contain the key
+ */
+sstr_rc sstr_map_erase(
+    const sstring *key_str,
+    sstr_map      *dst_map
+)
+{
+    sstr_rc sstr_status = SSTR_FAIL;
+
+    if (key_str != NULL && dst_map != NULL)
+    {
+        sstr_status = sstr_map_erase_chars(key_str->chars, key_str->len, dst_map);
+    }
+
+    return sstr_status;
+}
+#endif /* not _SSTR_NO_DYNMEM */
+
+
+#ifndef _SSTR_NO_DYNMEM
+/**
+ * Remove an entry from a map, using a C string as the key
+ */
+sstr_rc sstr_map_erasecstr(
+    const char *key_cstr,
+    sstr_map   *dst_map,
+    size_t     cstr_len
+)
+{
+    sstr_rc sstr_status = SSTR_FAIL;
+
+    if (key_cstr != NULL && dst_map != NULL)
+    {
+        sstr_status = sstr_map_erase_chars(key_cstr, cstr_len, dst_map);
+    }
+
+    return sstr_status;
+}
+#endif /* not _SSTR_NO_DYNMEM */
+
+
+/**
+ * Query the number of entries in a map
+ */
+size_t sstr_map_count(
+    const sstr_map *src_map
+)
+{
+    size_t sstr_result = SSTR_SIZE_FAIL;
+
+    if (src_map != NULL)
+    {
+        sstr_result = src_map->count;
+    }
+
+    return sstr_result;
+}
+
+
+/**
+ * Bit mask of the slots in a group whose control byte equals tag
+ */
+static unsigned int sstr_map_match(
+    const unsigned char *group,
+    unsigned char       tag
+)
+{
+    unsigned int mask = 0;
+
+    #ifdef __SSE2__
+    __m128i ctrl_vec = _mm_loadu_si128((const __m128i *) group);
+    mask = (unsigned int) _mm_movemask_epi8(
+        _mm_cmpeq_epi8(ctrl_vec, _mm_set1_epi8((char) tag)));
+    #else
+    for (size_t ctrl_idx = 0; ctrl_idx < SSTR_MAP_GROUP; ++ctrl_idx)
+    {
+        if (group[ctrl_idx] == tag)
+        {
+            mask |= 1U << ctrl_idx;
+        }
+    }
+    #endif /* __SSE2__ */
+
+    return mask;
+}
+
+
+#ifndef _SSTR_NO_DYNMEM
+/**
+ * Bit mask of the empty or deleted slots in a group
+ */
+static unsigned int sstr_map_match_free(
+    const unsigned char *group
+)
+{
+    unsigned int mask = 0;
+
+    #ifdef __SSE2__
+    mask = (unsigned int) _mm_movemask_epi8(
+        _mm_loadu_si128((const __m128i *) group));
+    #else
+    for (size_t ctrl_idx = 0; ctrl_idx < SSTR_MAP_GROUP; ++ctrl_idx)
+    {
+        if ((group[ctrl_idx] & 0x80) != 0)
+        {
+            mask |= 1U << ctrl_idx;
+        }
+    }
+    #endif /* __SSE2__ */
+
+    return mask;
+}
+#endif /* not _SSTR_NO_DYNMEM */
+
+
+/**
+ * Index of the lowest set bit of a non-zero mask
+ */
+static unsigned int sstr_map_lowbit(
+    unsigned int mask
+)
+{
+    #ifdef __GNUC__
+    return (unsigned int) __builtin_ctz(mask);
+    #else
+    unsigned int bit_idx = 0;
+    while ((mask & 1U) == 0)
+    {
+        mask >>= 1;
+        ++bit_idx;
+    }
+    return bit_idx;
+    #endif /* __GNUC__ */
+}
+
+
+/**
+ * Find the slot that holds a key
+ *
+ * Groups are probed in triangular order, which visits every group
+ * of a power-of-two sized table; probing ends at the first group that
+ * contains an empty slot
+ */
+static sstr_pos sstr_map_find(
+    const sstr_map *src_map,
+    const char     *key_chars,
+    size_t         key_len,
+    sstr_hashval   key_hash
+)
+{
+    sstr_pos      slot_found = SSTR_NPOS;
+    size_t        group_mask = src_map->slot_cap / SSTR_MAP_GROUP - 1;
+    size_t        group_idx  = (size_t) (key_hash >> 7) & group_mask;
+    unsigned char tag        = SSTR_MAP_TAG(key_hash);
+
+    for (size_t probe_nr = 0;
+         probe_nr <= group_mask && slot_found == SSTR_NPOS;
+         ++probe_nr)
+    {
+        const unsigned char *group = &(src_map->ctrl[group_idx * SSTR_MAP_GROUP]);
+
+        unsigned int mask = sstr_map_match(group, tag);
+        while (mask != 0 && slot_found == SSTR_NPOS)
+        {
+            sstr_pos slot_idx = group_idx * SSTR_MAP_GROUP + sstr_map_lowbit(mask);
+            const sstring *slot_key = src_map->slots[slot_idx].key;
+            if (slot_key->len == key_len &&
+                memcmp(slot_key->chars, key_chars, key_len) == 0)
+            {
+                slot_found = slot_idx;
+            }
+            mask &= mask - 1;
+        }
+
+        if (sstr_map_match(group, SSTR_MAP_EMPTY) != 0)
+        {
+            break;
+        }
+        group_idx = (group_idx + probe_nr + 1) & group_mask;
+    }
+
+    return slot_found;
+}
+
+
+#ifndef _SSTR_NO_DYNMEM
+/**
+ * Find the first empty or deleted slot in the probe sequence of a hash
+ *
+ * There always is one, because the load of a map is limited
+ */
+static sstr_pos sstr_map_find_free(
+    const sstr_map *src_map,
+    sstr_hashval   key_hash
+)
+{
+    sstr_pos slot_found = SSTR_NPOS;
+    size_t   group_mask = src_map->slot_cap / SSTR_MAP_GROUP - 1;
+    size_t   group_idx  = (size_t) (key_hash >> 7) & group_mask;
+
+    for (size_t probe_nr = 0;
+         probe_nr <= group_mask && slot_found == SSTR_NPOS;
+         ++probe_nr)
+    {
+        unsigned int mask = sstr_map_match_free(
+            &(src_map->ctrl[group_idx * SSTR_MAP_GROUP]));
+        if (mask != 0)
+        {
+            slot_found = group_idx * SSTR_MAP_GROUP + sstr_map_lowbit(mask);
+        }
+        group_idx = (group_idx + probe_nr + 1) & group_mask;
+    }
+
+    return slot_found;
+}
+#endif /* not _SSTR_NO_DYNMEM */
+
+
+#ifndef _SSTR_NO_DYNMEM
+/**
+ * Rebuild the control bytes and slots of a map without deleted slots
+ *
+ * Only the pointers to keys and values are moved, never their contents
+ */
+static sstr_rc sstr_map_purge(
+    sstr_map *dst_map
+)
+{
+    sstr_rc sstr_status = SSTR_FAIL;
+
+    unsigned char *old_ctrl  = dst_map->ctrl;
+    sstr_map_slot *old_slots = dst_map->slots;
+
+    unsigned char *new_ctrl  = malloc(dst_map->slot_cap);
+    sstr_map_slot *new_slots = malloc(dst_map->slot_cap * sizeof (sstr_map_slot));
+    if (new_ctrl != NULL && new_slots != NULL)
+    {
+        memset(new_ctrl, SSTR_MAP_EMPTY, dst_map->slot_cap);
+        dst_map->ctrl  = new_ctrl;
+        dst_map->slots = new_slots;
+
+        for (sstr_pos old_idx = 0; old_idx < dst_map->slot_cap; ++old_idx)
+        {
+            if ((old_ctrl[old_idx] & 0x80) == 0)
+            {
+                sstr_hashval key_hash;
+                sstr_hash(old_slots[old_idx].key, &key_hash);
+
+                sstr_pos new_idx = sstr_map_find_free(dst_map, key_hash);
+                new_ctrl[new_idx]  = SSTR_MAP_TAG(key_hash);
+                new_slots[new_idx] = old_slots[old_idx];
+            }
+        }
+        dst_map->used = dst_map->count;
+
+        free(old_ctrl);
+        free(old_slots);
+
+        sstr_status = SSTR_PASS;
+    }
+    else
+    {
+        free(new_ctrl);
+        free(new_slots);
+    }
+
+    return sstr_status;
+}
+#endif /* not _SSTR_NO_DYNMEM */
+
+
+#ifndef _SSTR_NO_DYNMEM
+/**
+ * Allocate a copy of a string with a capacity of its length
+ */
+static sstring *sstr_map_dup(
+    const sstring *src_str
+)
+{
+    sstring *dst_str = sstr_alloc(src_str->len);
+    if (dst_str != NULL)
+    {
+        memcpy(dst_str->chars, src_str->chars, src_str->len);
+        dst_str->len = src_str->len;
+        dst_str->chars[dst_str->len] = '\0';
+    }
+
+    return dst_str;
+}
+#endif /* not _SSTR_NO_DYNMEM */
+
+
+#ifndef _SSTR_NO_DYNMEM
+/**
+ * Wipe and deallocate a string owned by a map
+ */
+static void sstr_map_discard(
+    sstring *dst_str
+)
+{
+    if (dst_str != NULL)
+    {
+        sstr_wipe(dst_str);
+        sstr_dealloc(dst_str);
+    }
+}
+#endif /* not _SSTR_NO_DYNMEM */
+
+
+#ifndef _SSTR_NO_DYNMEM
+/**
+ * Remove the entry for a key given as a char array and a length
+ */
+static sstr_rc sstr_map_erase_chars(
+    const char *key_chars,
+    size_t     key_len,
+    sstr_map   *dst_map
+)
+{
+    sstr_rc sstr_status = SSTR_FAIL;
+
+    sstr_hashval key_hash;
+    sstr_hashcstr(key_chars, &key_hash, key_len);
+
+    sstr_pos slot_idx = sstr_map_find(dst_map, key_chars, key_len, key_hash);
+    if (slot_idx != SSTR_NPOS)
+    {
+        sstr_map_discard(dst_map->slots[slot_idx].key);
+        sstr_map_discard(dst_map->slots[slot_idx].value);
+
+        // if the group still has an empty slot, no probe sequence
+        // continues past this group, and the slot can be made empty
+        // instead of marking it as deleted
+        const unsigned char *group =
+            &(dst_map->ctrl[slot_idx - (slot_idx % SSTR_MAP_GROUP)]);
+        if (sstr_map_match(group, SSTR_MAP_EMPTY) != 0)
+        {
+            dst_map->ctrl[slot_idx] = SSTR_MAP_EMPTY;
+            --(dst_map->used);
+        }
+        else
+        {
+            dst_map->ctrl[slot_idx] = SSTR_MAP_DELETED;
+        }
+        --(dst_map->count);
+
+        sstr_status = SSTR_PASS;
+    }
+
+    return sstr_status;
+}
+#endif /* not _SSTR_NO_DYNMEM */
@@ -0,0 +1,173 @@
+/**
+ * secureStrings library
+ * version 0.54-beta (2014-10-25_001)
+ *
+ * secureStrings map container
+ *
+ * Copyright (C) 2010, 2014 Robert ALTNOEDER
+ *
+ * Redistribution and use in source and binary forms,
+ * with or without modification, are permitted provided that
+ * the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in
+ *     the documentation and/or other materials provided with the distribution.
+ *  3. The name of the author may not be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _SECURESTR_MAP_H
+#define _SECURESTR_MAP_H
+
+#include <unistd.h>
+#include <sys/types.h>
+#include <stdlib.h>
+#include <securestr.h>
+
+// An sstr_map maps secureString keys to secureString values
+//
+// The map owns copies of all keys and values. Keys and values are
+// wiped when an entry is erased, when a value is overwritten and
+// when the map is deallocated.
+//
+// The map uses open addressing: slots are organized in groups of 16,
+// and a separate control byte per slot holds 7 bits of the key's
+// hash, so that a whole group can be probed with one SIMD compare
+// before any key is touched.
+//
+// Like a secureString, an sstr_map has a fixed capacity.
+typedef struct sstr_map_slot_struct
+{
+    sstring *key;
+    sstring *value;
+}
+sstr_map_slot;
+
+typedef struct sstr_map_struct
+{
+    unsigned char *ctrl;
+    sstr_map_slot *slots;
+    size_t        slot_cap;
+    size_t        used_max;
+    size_t        used;
+    size_t        count;
+}
+sstr_map;
+
+
+#ifndef _SSTR_NO_DYNMEM
+/**
+ * Allocate a map
+ *
+ * entry_cap is the number of entries that will be available
+ */
+sstr_map *sstr_map_alloc(
+    size_t entry_cap
+);
+#endif /* not _SSTR_NO_DYNMEM */
+
+
+#ifndef _SSTR_NO_DYNMEM
+/**
+ * Deallocate a map, wiping all keys and values
+ */
+void sstr_map_dealloc(
+    sstr_map *dst_map
+);
+#endif /* not _SSTR_NO_DYNMEM */
+
+
+#ifndef _SSTR_NO_DYNMEM
+/**
+ * Insert an entry into a map, or overwrite the value of an existing entry
+ *
+ * value_str may be the value returned by sstr_map_get() for the same key.
+ */
+sstr_rc sstr_map_put(
+    const sstring *key_str,
+    const sstring *value_str,
+    sstr_map      *dst_map
+);
+#endif /* not _SSTR_NO_DYNMEM */
+
+
+/**
+ * Find the value of an entry in a map
+ *
+ * Returns NULL if the map does not contain the key
+ */
+const sstring *sstr_map_get(
+    const sstr_map *src_map,
+    const sstring  *key_str
+);
+
+
+/**
+ * Find the value of an entry in a map, using a C string as the key
+ */
+const sstring *sstr_map_getcstr(
+    const sstr_map *src_map,
+    const char     *key_cstr,
+    size_t         cstr_len
+);
+
+
+#ifndef _SSTR_NO_DYNMEM
+/**
+ * Remove an entry from a map, wiping its key and value
+ *
+ * Returns SSTR_FAIL if the map does not contain the key
+ */
+sstr_rc sstr_map_erase(
+    const sstring *key_str,
+    sstr_map      *dst_map
+);
+#endif /* not _SSTR_NO_DYNMEM */
+
+
+#ifndef _SSTR_NO_DYNMEM
+/**
+ * Remove an entry from a map, using a C string as the key
+ */
+sstr_rc sstr_map_erasecstr(
+    const char *key_cstr,
+    sstr_map   *dst_map,
+    size_t     cstr_len
+);
+#endif /* not _SSTR_NO_DYNMEM */
+
+
+/**
+ * Query the number of entries in a map
+ */
+size_t sstr_map_count(
+    const sstr_map *src_map
+);
+
+
+#define sstrMap             sstr_map
+
+#define sstrMapAlloc        sstr_map_alloc
+#define sstrMapDealloc      sstr_map_dealloc
+#define sstrMapPut          sstr_map_put
+#define sstrMapGet          sstr_map_get
+#define sstrMapGetCstr      sstr_map_getcstr
+#define sstrMapErase        sstr_map_erase
+#define sstrMapEraseCstr    sstr_map_erasecstr
+#define sstrMapCount        sstr_map_count
+
+#endif /* _SECURESTR_MAP_H */
@@ -0,0 +1,986 @@
+/**
+ * secureStrings library
+ * version 0.54-beta (2014-10-25_001)
+ *
+ * secureStrings thread pool functions
+ *
+ * Copyright (C) 2010, 2014 Robert ALTNOEDER
+ *
+ * Redistribution and use in source and binary forms,
+ * with or without modification, are permitted provided that
+ * the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in
+ *     the documentation and/or other materials provided with the distribution.
+ *  3. The name of the author may not be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <unistd.h>
+#include <sys/types.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <pthread.h>
+#include <securestr.h>
+#include <securestr_pool.h>
+
+// operations are split into chunks of at least this size, so that the
+// cost of claiming a chunk is small compared to processing it
+#define SSTR_POOL_CHUNK_MIN          ((size_t) 1 << 16)
+// chunk lengths are rounded up to a multiple of this size
+#define SSTR_POOL_CHUNK_ALIGN        ((size_t) 4096)
+// a few chunks per thread balance the load if threads are delayed
+#define SSTR_POOL_CHUNKS_PER_THREAD  ((size_t) 4)
+// a chunk of a batch search covers about this many chars of haystacks,
+// so that a chunk's haystacks stay in the L2 cache while all patterns
+// are searched
+#define SSTR_POOL_BATCH_BYTES        ((size_t) 1 << 16)
+// number of haystacks that are sampled to estimate their average length
+#define SSTR_POOL_BATCH_SAMPLES      ((size_t) 64)
+// number of patterns that are compiled and searched in one pass
+#define SSTR_POOL_BATCH_PATTERNS     ((size_t) 8)
+// patterns of at least this length are searched with shift tables
+#define SSTR_POOL_SHIFT_MIN          ((size_t) 4)
+#define SSTR_POOL_LINE_SIZE          64
+
+typedef struct sstr_pool_job_struct sstr_pool_job;
+
+// a pattern compiled for a batch search, shared by all threads
+typedef struct sstr_pool_pattern_struct
+{
+    const sstring *pat_str;
+    // Horspool shift for each value of the char that is aligned with
+    // the pattern's last char, limited to 255
+    unsigned char shifts[256];
+}
+sstr_pool_pattern;
+
+// an operation that is split into chunks
+struct sstr_pool_job_struct
+{
+    // processes one chunk of the operation
+    void                    (*run_chunk)(sstr_pool_job *job, size_t chunk_idx);
+    size_t                  chunk_count;
+    size_t                  chunk_len;
+    // number of chars to wipe or copy, number of search positions,
+    // or number of haystacks of a batch search
+    size_t                  length;
+    const char              *src_chars;
+    char                    *dst_chars;
+    const sstring           *pat_str;
+    // position of the leftmost match found so far
+    sstr_pos                match_idx;
+    // batch search
+    const sstring * const   *src_strs;
+    const sstr_pool_pattern *patterns;
+    size_t                  pattern_count;
+    size_t                  pattern_offset;
+    size_t                  pattern_stride;
+    sstr_pos                *dst_idxs;
+};
+
+// the chunks of the current job that are queued for one thread
+//
+// The thread takes chunks from the beginning of its range. A thread
+// whose range is empty steals the second half of another thread's range.
+typedef struct sstr_pool_slot_struct
+{
+    // range of chunk indexes [begin, end), packed as end << 32 | begin
+    uint64_t  range;
+    sstr_pool *pool;
+    pthread_t thread;
+    char      padding[SSTR_POOL_LINE_SIZE - sizeof (uint64_t) - sizeof (sstr_pool *) -
+                      sizeof (pthread_t)];
+}
+sstr_pool_slot;
+
+struct sstr_pool_struct
+{
+    // serializes operations
+    pthread_mutex_t run_lock;
+    // protects the following fields up to worker_count
+    pthread_mutex_t state_lock;
+    pthread_cond_t  work_cond;
+    pthread_cond_t  done_cond;
+    sstr_pool_job   *job;
+    unsigned long   job_seq;
+    size_t          busy_count;
+    int             stopping;
+    size_t          threshold;
+    size_t          worker_count;
+    // one slot for the calling thread followed by one for each worker
+    sstr_pool_slot  *slots;
+};
+
+#ifndef _SSTR_NO_DYNMEM
+static void *sstr_pool_worker(
+    void *slot_ptr
+);
+static void sstr_pool_stop(
+    sstr_pool *dst_pool,
+    size_t    worker_count
+);
+#endif /* not _SSTR_NO_DYNMEM */
+static void sstr_pool_run(
+    sstr_pool     *src_pool,
+    sstr_pool_job *job
+);
+static void sstr_pool_work(
+    sstr_pool_slot *slots,
+    size_t         slot_count,
+    size_t         slot_idx,
+    sstr_pool_job  *job
+);
+static int sstr_pool_take(
+    sstr_pool_slot *slot,
+    size_t         *chunk_idx
+);
+static int sstr_pool_steal(
+    sstr_pool_slot *victim_slot,
+    sstr_pool_slot *dst_slot
+);
+static size_t sstr_pool_chunk_len(
+    const sstr_pool *src_pool,
+    size_t          length
+);
+static void sstr_pool_init_job(
+    sstr_pool_job *job,
+    size_t        length,
+    size_t        chunk_len
+);
+static void sstr_pool_wipe_chunk(
+    sstr_pool_job *job,
+    size_t        chunk_idx
+);
+static void sstr_pool_cpy_chunk(
+    sstr_pool_job *job,
+    size_t        chunk_idx
+);
+static void sstr_pool_indexof_chunk(
+    sstr_pool_job *job,
+    size_t        chunk_idx
+);
+static void sstr_pool_batch_chunk(
+    sstr_pool_job *job,
+    size_t        chunk_idx
+);
+static sstr_pos sstr_pool_find(
+    const char    *src_chars,
+    size_t        begin_idx,
+    size_t        end_idx,
+    const sstring *pat_str
+);
+static void sstr_pool_compile(
+    const sstring     *pat_str,
+    sstr_pool_pattern *dst_pattern
+);
+static sstr_pos sstr_pool_find_compiled(
+    const sstring           *src_str,
+    const sstr_pool_pattern *pattern
+);
+
+
+#ifndef _SSTR_NO_DYNMEM
+/**
+ * Allocate a thread pool
+ *
+ * thread_count is the number of threads that take part in an operation,
+ * including the calling thread. Operations on secureStrings that are
+ * shorter than threshold are not split.
+ */
+sstr_pool *sstr_pool_alloc(
+    size_t thread_count,
+    size_t threshold
+)
+{
+    sstr_pool *dst_pool = NULL;
+
+    if (thread_count > 0 && thread_count <= SSTR_SIZE_T_MAX / sizeof (sstr_pool_slot))
+    {
+        dst_pool = malloc(sizeof (sstr_pool));
+    }
+    // align the slots to cache lines, so that threads that take chunks
+    // from their own slots do not write to the same cache line
+    if (dst_pool != NULL &&
+        posix_memalign((void **) &(dst_pool->slots), SSTR_POOL_LINE_SIZE,
+                       thread_count * sizeof (sstr_pool_slot)) != 0)
+    {
+        free(dst_pool);
+        dst_pool = NULL;
+    }
+    if (dst_pool != NULL)
+    {
+        for (size_t slot_idx = 0; slot_idx < thread_count; ++slot_idx)
+        {
+            dst_pool->slots[slot_idx].range = 0;
+            dst_pool->slots[slot_idx].pool  = dst_pool;
+        }
+
+        dst_pool->job          = NULL;
+        dst_pool->job_seq      = 0;
+        dst_pool->busy_count   = 0;
+        dst_pool->stopping     = 0;
+        dst_pool->threshold    = threshold;
+        dst_pool->worker_count = 0;
+
+        int init_count = 0;
+        init_count += pthread_mutex_init(&(dst_pool->run_lock), NULL) == 0;
+        init_count += pthread_mutex_init(&(dst_pool->state_lock), NULL) == 0;
+        init_count += pthread_cond_init(&(dst_pool->work_cond), NULL) == 0;
+        init_count += pthread_cond_init(&(dst_pool->done_cond), NULL) == 0;
+        if (init_count == 4)
+        {
+            int create_ok = 1;
+            while (create_ok && dst_pool->worker_count < thread_count - 1)
+            {
+                sstr_pool_slot *worker_slot = &(dst_pool->slots[dst_pool->worker_count + 1]);
+                create_ok = pthread_create(&(worker_slot->thread), NULL,
+                                           sstr_pool_worker, worker_slot) == 0;
+                if (create_ok)
+                {
+                    ++dst_pool->worker_count;
+                }
+            }
+        }
+
+        if (init_count != 4 || dst_pool->worker_count < thread_count - 1)
+        {
+            // the synchronization objects are always initialized
+            // if any worker threads were started
+            if (init_count == 4)
+            {
+                sstr_pool_stop(dst_pool, dst_pool->worker_count);
+            }
+            free(dst_pool->slots);
+            free(dst_pool);
+            dst_pool = NULL;
+        }
+    }
+
+    return dst_pool;
+}
+#endif /* not _SSTR_NO_DYNMEM */
+
+
+#ifndef _SSTR_NO_DYNMEM
+/**
+ * Stop the worker threads of a thread pool and deallocate it
+ *
+ * There must not be any operations in progress on the pool
+ */
+void sstr_pool_dealloc(
+    sstr_pool *dst_pool
+)
+{
+    if (dst_pool != NULL)
+    {
+        sstr_pool_stop(dst_pool, dst_pool->worker_count);
+        free(dst_pool->slots);
+        free(dst_pool);
+    }
+}
+#endif /* not _SSTR_NO_DYNMEM */
+
+
+/**
+ * Wipe a string in parallel, see sstr_wipe()
+ */
+sstr_rc sstr_pool_wipe(
+    sstr_pool *src_pool,
+    sstring   *dst_str
+)
+{
+    sstr_rc sstr_status = SSTR_FAIL;
+
+    if (src_pool != NULL && dst_str != NULL)
+    {
+        // the real capacity of a secureString is cap + 1
+        if (dst_str->cap + 1 >= src_pool->threshold)
+        {
+            sstr_pool_job job;
+            sstr_pool_init_job(&job, dst_str->cap + 1,
+                               sstr_pool_chunk_len(src_pool, dst_str->cap + 1));
+            job.run_chunk = sstr_pool_wipe_chunk;
+            job.dst_chars = dst_str->chars;
+            sstr_pool_run(src_pool, &job);
+
+            dst_str->len = 0;
+
+            sstr_status = SSTR_PASS;
+        }
+        else
+        {
+            sstr_status = sstr_wipe(dst_str);
+        }
+    }
+
+    return sstr_status;
+}
+
+
+/**
+ * Copy a string in parallel, see sstr_cpy()
+ */
+sstr_rc sstr_pool_cpy(
+    sstr_pool     *src_pool,
+    const sstring *src_str,
+    sstring       *dst_str
+)
+{
+    sstr_rc sstr_status = SSTR_FAIL;
+
+    if (src_pool != NULL && src_str != NULL && dst_str != NULL)
+    {
+        if (src_str->len >= src_pool->threshold)
+        {
+            // check whether the destination secureString has enough
+            // capacity to store the contents of the source secureString
+            if (dst_str->cap >= src_str->len)
+            {
+                if (src_str != dst_str)
+                {
+                    sstr_pool_job job;
+                    sstr_pool_init_job(&job, src_str->len,
+                                       sstr_pool_chunk_len(src_pool, src_str->len));
+                    job.run_chunk = sstr_pool_cpy_chunk;
+                    job.src_chars = src_str->chars;
+                    job.dst_chars = dst_str->chars;
+                    sstr_pool_run(src_pool, &job);
+                }
+
+                // update destination secureString length
+                dst_str->len = src_str->len;
+                // terminate destination secureString with a null-character
+                dst_str->chars[dst_str->len] = '\0';
+
+                sstr_status = SSTR_PASS;
+            }
+        }
+        else
+        {
+            sstr_status = sstr_cpy(src_str, dst_str);
+        }
+    }
+
+    return sstr_status;
+}
+
+
+/**
+ * Find a substring in parallel, see sstr_indexof()
+ *
+ * Returns the position of the leftmost match
+ */
+sstr_pos sstr_pool_indexof(
+    sstr_pool     *src_pool,
+    const sstring *src_str,
+    const sstring *pat_str
+)
+{
+    sstr_pos sstr_index = SSTR_NPOS;
+
+    if (src_pool != NULL && src_str != NULL && pat_str != NULL)
+    {
+        if (src_str->len >= src_pool->threshold && pat_str->len > 0 &&
+            src_str->len >= pat_str->len)
+        {
+            // each chunk covers a range of match positions; the comparison
+            // of a match at the end of a chunk reads up to pat_str->len - 1
+            // chars of the following chunk
+            size_t        pos_count = src_str->len - pat_str->len + 1;
+            sstr_pool_job job;
+            sstr_pool_init_job(&job, pos_count, sstr_pool_chunk_len(src_pool, pos_count));
+            job.run_chunk = sstr_pool_indexof_chunk;
+            job.src_chars = src_str->chars;
+            job.pat_str   = pat_str;
+            sstr_pool_run(src_pool, &job);
+
+            sstr_index = job.match_idx;
+        }
+        else
+        {
+            sstr_index = sstr_indexof(src_str, pat_str);
+        }
+    }
+
+    return sstr_index;
+}
+
+
+/**
+ * Find one or more substrings in each of an array of strings in parallel
+ *
+ * The position of the leftmost match of pattern pat_idx in string src_idx
+ * is stored in dst_idxs[src_idx * pat_count + pat_idx], or SSTR_NPOS if
+ * there is no match or the string is NULL. Strings are processed in
+ * chunks of consecutive strings that are searched for all patterns.
+ */
+sstr_rc sstr_indexof_batch(
+    sstr_pool             *src_pool,
+    const sstring * const *src_strs,
+    size_t                src_count,
+    const sstring * const *pat_strs,
+    size_t                pat_count,
+    sstr_pos              *dst_idxs
+)
+{
+    sstr_rc sstr_status = SSTR_FAIL;
+
+    if (src_pool != NULL && (src_strs != NULL || src_count == 0) &&
+        (pat_strs != NULL || pat_count == 0) && dst_idxs != NULL &&
+        (pat_count == 0 || src_count <= SSTR_SIZE_T_MAX / pat_count))
+    {
+        size_t pat_idx = 0;
+        while (pat_idx < pat_count && pat_strs[pat_idx] != NULL)
+        {
+            ++pat_idx;
+        }
+
+        if (pat_idx == pat_count)
+        {
+            // estimate the average length of the strings from a sample
+            // to select the number of strings per chunk
+            size_t sample_count = src_count < SSTR_POOL_BATCH_SAMPLES ?
+                                  src_count : SSTR_POOL_BATCH_SAMPLES;
+            size_t sample_len   = 0;
+            for (size_t sample_idx = 0; sample_idx < sample_count; ++sample_idx)
+            {
+                const sstring *src_str = src_strs[sample_idx * (src_count / sample_count)];
+                if (src_str != NULL)
+                {
+                    sample_len += src_str->len < SSTR_POOL_BATCH_BYTES ?
+                                  src_str->len : SSTR_POOL_BATCH_BYTES;
+                }
+            }
+            size_t avg_len   = sample_count > 0 ? sample_len / sample_count + 1 : 1;
+            size_t chunk_len = SSTR_POOL_BATCH_BYTES / avg_len + 1;
+            // keep enough chunks for load balancing
+            size_t thread_count = src_pool->worker_count + 1;
+            size_t balance_len  = src_count / (thread_count * SSTR_POOL_CHUNKS_PER_THREAD) + 1;
+            if (chunk_len > balance_len)
+            {
+                chunk_len = balance_len;
+            }
+
+            // the patterns are compiled in groups that stay in the L1 cache
+            sstr_pool_pattern patterns[SSTR_POOL_BATCH_PATTERNS];
+            for (pat_idx = 0; pat_idx < pat_count; pat_idx += SSTR_POOL_BATCH_PATTERNS)
+            {
+                size_t group_count = pat_count - pat_idx < SSTR_POOL_BATCH_PATTERNS ?
+                                     pat_count - pat_idx : SSTR_POOL_BATCH_PATTERNS;
+                for (size_t group_idx = 0; group_idx < group_count; ++group_idx)
+                {
+                    sstr_pool_compile(pat_strs[pat_idx + group_idx], &(patterns[group_idx]));
+                }
+
+                sstr_pool_job job;
+                sstr_pool_init_job(&job, src_count, chunk_len);
+                job.run_chunk      = sstr_pool_batch_chunk;
+                job.src_strs       = src_strs;
+                job.patterns       = patterns;
+                job.pattern_count  = group_count;
+                job.pattern_offset = pat_idx;
+                job.pattern_stride = pat_count;
+                job.dst_idxs       = dst_idxs;
+                sstr_pool_run(src_pool, &job);
+            }
+
+            sstr_status = SSTR_PASS;
+        }
+    }
+
+    return sstr_status;
+}
+
+
+#ifndef _SSTR_NO_DYNMEM
+/**
+ * Main function of a worker thread
+ *
+ * Waits for jobs and takes part in each job until the pool is stopped
+ */
+static void *sstr_pool_worker(
+    void *slot_ptr
+)
+{
+    sstr_pool_slot *src_slot = slot_ptr;
+    sstr_pool      *src_pool = src_slot->pool;
+    unsigned long  job_seq   = 0;
+
+    pthread_mutex_lock(&(src_pool->state_lock));
+    while (!src_pool->stopping)
+    {
+        if (src_pool->job_seq != job_seq)
+        {
+            job_seq = src_pool->job_seq;
+            sstr_pool_job *job = src_pool->job;
+            pthread_mutex_unlock(&(src_pool->state_lock));
+
+            sstr_pool_work(src_pool->slots, src_pool->worker_count + 1,
+                           (size_t) (src_slot - src_pool->slots), job);
+
+            pthread_mutex_lock(&(src_pool->state_lock));
+            --src_pool->busy_count;
+            if (src_pool->busy_count == 0)
+            {
+                pthread_cond_signal(&(src_pool->done_cond));
+            }
+        }
+        else
+        {
+            pthread_cond_wait(&(src_pool->work_cond), &(src_pool->state_lock));
+        }
+    }
+    pthread_mutex_unlock(&(src_pool->state_lock));
+
+    return NULL;
+}
+
+
+/**
+ * Stop and join the first worker_count worker threads of a pool and
+ * destroy the pool's synchronization objects
+ */
+static void sstr_pool_stop(
+    sstr_pool *dst_pool,
+    size_t    worker_count
+)
+{
+    pthread_mutex_lock(&(dst_pool->state_lock));
+    dst_pool->stopping = 1;
+    pthread_cond_broadcast(&(dst_pool->work_cond));
+    pthread_mutex_unlock(&(dst_pool->state_lock));
+
+    for (size_t worker_idx = 0; worker_idx < worker_count; ++worker_idx)
+    {
+        pthread_join(dst_pool->slots[worker_idx + 1].thread, NULL);
+    }
+
+    pthread_cond_destroy(&(dst_pool->done_cond));
+    pthread_cond_destroy(&(dst_pool->work_cond));
+    pthread_mutex_destroy(&(dst_pool->state_lock));
+    pthread_mutex_destroy(&(dst_pool->run_lock));
+}
+#endif /* not _SSTR_NO_DYNMEM */
+
+
+/**
+ * Process all chunks of a job with the calling thread and the pool's
+ * worker threads, and wait until all chunks have been processed
+ */
+static void sstr_pool_run(
+    sstr_pool     *src_pool,
+    sstr_pool_job *job
+)
+{
+    if (src_pool->worker_count > 0 && job->chunk_count > 1)
+    {
+        pthread_mutex_lock(&(src_pool->run_lock));
+
+        // queue a contiguous range of chunks for each thread
+        size_t slot_count = src_pool->worker_count + 1;
+        for (size_t slot_idx = 0; slot_idx < slot_count; ++slot_idx)
+        {
+            uint64_t begin_idx = (uint64_t) job->chunk_count * slot_idx / slot_count;
+            uint64_t end_idx   = (uint64_t) job->chunk_count * (slot_idx + 1) / slot_count;
+            __atomic_store_n(&(src_pool->slots[slot_idx].range), end_idx << 32 | begin_idx,
+                             __ATOMIC_RELAXED);
+        }
+
+        pthread_mutex_lock(&(src_pool->state_lock));
+        src_pool->job        = job;
+        src_pool->busy_count = src_pool->worker_count;
+        ++src_pool->job_seq;
+        pthread_cond_broadcast(&(src_pool->work_cond));
+        pthread_mutex_unlock(&(src_pool->state_lock));
+
+        sstr_pool_work(src_pool->slots, slot_count, 0, job);
+
+        // the job is on the caller's stack; it must not be released
+        // before all workers have finished with it
+        pthread_mutex_lock(&(src_pool->state_lock));
+        while (src_pool->busy_count > 0)
+        {
+            pthread_cond_wait(&(src_pool->done_cond), &(src_pool->state_lock));
+        }
+        src_pool->job = NULL;
+        pthread_mutex_unlock(&(src_pool->state_lock));
+
+        pthread_mutex_unlock(&(src_pool->run_lock));
+    }
+    else
+    {
+        for (size_t chunk_idx = 0; chunk_idx < job->chunk_count; ++chunk_idx)
+        {
+            job->run_chunk(job, chunk_idx);
+        }
+    }
+}
+
+
+/**
+ * Process the chunks queued for a thread, then steal chunks from
+ * other threads until no thread has any chunks left
+ */
+static void sstr_pool_work(
+    sstr_pool_slot *slots,
+    size_t         slot_count,
+    size_t         slot_idx,
+    sstr_pool_job  *job
+)
+{
+    sstr_pool_slot *own_slot = &(slots[slot_idx]);
+
+    int has_work = 1;
+    while (has_work)
+    {
+        size_t chunk_idx;
+        while (sstr_pool_take(own_slot, &chunk_idx))
+        {
+            job->run_chunk(job, chunk_idx);
+        }
+
+        // a range that is being moved by another thread is not seen;
+        // that thread processes it
+        has_work = 0;
+        for (size_t victim_nr = 1; victim_nr < slot_count && !has_work; ++victim_nr)
+        {
+            has_work = sstr_pool_steal(&(slots[(slot_idx + victim_nr) % slot_count]),
+                                       own_slot);
+        }
+    }
+}
+
+
+/**
+ * Take the first chunk of a thread's range
+ *
+ * Returns 0 if the range is empty
+ */
+static int sstr_pool_take(
+    sstr_pool_slot *slot,
+    size_t         *chunk_idx
+)
+{
+    int taken = 0;
+
+    uint64_t range = __atomic_load_n(&(slot->range), __ATOMIC_RELAXED);
+    while (!taken && (range & 0xFFFFFFFF) < (range >> 32))
+    {
+        // on failure, range is updated to the current value
+        taken = __atomic_compare_exchange_n(&(slot->range), &range, range + 1, 0,
+                                            __ATOMIC_RELAXED, __ATOMIC_RELAXED);
+    }
+    if (taken)
+    {
+        *chunk_idx = (size_t) (range & 0xFFFFFFFF);
+    }
+
+    return taken;
+}
+
+
+/**
+ * Move the second half of another thread's range to the empty range
+ * of the calling thread
+ *
+ * Returns 0 if the other thread's range is empty
+ */
+static int sstr_pool_steal(
+    sstr_pool_slot *victim_slot,
+    sstr_pool_slot *dst_slot
+)
+{
+    int stolen = 0;
+
+    uint64_t range     = __atomic_load_n(&(victim_slot->range), __ATOMIC_RELAXED);
+    uint64_t begin_idx = range & 0xFFFFFFFF;
+    uint64_t end_idx   = range >> 32;
+    while (!stolen && begin_idx < end_idx)
+    {
+        uint64_t split_idx = begin_idx + (end_idx - begin_idx) / 2;
+        stolen = __atomic_compare_exchange_n(&(victim_slot->range), &range,
+                                             split_idx << 32 | begin_idx, 0,
+                                             __ATOMIC_RELAXED, __ATOMIC_RELAXED);
+        if (stolen)
+        {
+            __atomic_store_n(&(dst_slot->range), end_idx << 32 | split_idx,
+                             __ATOMIC_RELAXED);
+        }
+        else
+        {
+            begin_idx = range & 0xFFFFFFFF;
+            end_idx   = range >> 32;
+        }
+    }
+
+    return stolen;
+}
+
+
+/**
+ * Select the chunk length for an operation on a string
+ */
+static size_t sstr_pool_chunk_len(
+    const sstr_pool *src_pool,
+    size_t          length
+)
+{
+    size_t thread_count = src_pool->worker_count + 1;
+    size_t chunk_len    = length / (thread_count * SSTR_POOL_CHUNKS_PER_THREAD) + 1;
+    chunk_len = (chunk_len + SSTR_POOL_CHUNK_ALIGN - 1) & ~(SSTR_POOL_CHUNK_ALIGN - 1);
+    if (chunk_len < SSTR_POOL_CHUNK_MIN)
+    {
+        chunk_len = SSTR_POOL_CHUNK_MIN;
+    }
+
+    return chunk_len;
+}
+
+
+/**
+ * Split a job of the specified length into chunks
+ */
+static void sstr_pool_init_job(
+    sstr_pool_job *job,
+    size_t        length,
+    size_t        chunk_len
+)
+{
+    // chunk indexes are limited to 32 bits by the packed ranges
+    if (length / chunk_len >= (size_t) 0xFFFFFFFF)
+    {
+        chunk_len = length / ((size_t) 0xFFFFFFFF - 1) + 1;
+    }
+
+    job->run_chunk      = NULL;
+    job->chunk_count    = length / chunk_len + (length % chunk_len != 0 ? 1 : 0);
+    job->chunk_len      = chunk_len;
+    job->length         = length;
+    job->src_chars      = NULL;
+    job->dst_chars      = NULL;
+    job->pat_str        = NULL;
+    job->match_idx      = SSTR_NPOS;
+    job->src_strs       = NULL;
+    job->patterns       = NULL;
+    job->pattern_count  = 0;
+    job->pattern_offset = 0;
+    job->pattern_stride = 0;
+    job->dst_idxs       = NULL;
+}
+
+
+/**
+ * Wipe one chunk
+ */
+static void sstr_pool_wipe_chunk(
+    sstr_pool_job *job,
+    size_t        chunk_idx
+)
+{
+    size_t begin_idx = chunk_idx * job->chunk_len;
+    size_t chunk_len = job->length - begin_idx < job->chunk_len ?
+                       job->length - begin_idx : job->chunk_len;
+    memset(&(job->dst_chars[begin_idx]), 0, chunk_len);
+}
+
+
+/**
+ * Copy one chunk
+ */
+static void sstr_pool_cpy_chunk(
+    sstr_pool_job *job,
+    size_t        chunk_idx
+)
+{
+    size_t begin_idx = chunk_idx * job->chunk_len;
+    size_t chunk_len = job->length - begin_idx < job->chunk_len ?
+                       job->length - begin_idx : job->chunk_len;
+    memcpy(&(job->dst_chars[begin_idx]), &(job->src_chars[begin_idx]), chunk_len);
+}
+
+
+/**
+ * Search one chunk of match positions and record the leftmost match
+ */
+static void sstr_pool_indexof_chunk(
+    sstr_pool_job *job,
+    size_t        chunk_idx
+)
+{
+    size_t begin_idx = chunk_idx * job->chunk_len;
+    size_t end_idx   = job->length - begin_idx < job->chunk_len ?
+                       job->length : begin_idx + job->chunk_len;
+
+    // each thread takes chunks in ascending order, so once a match has
+    // been found, most chunks after it are skipped
+    sstr_pos match_idx = __atomic_load_n(&(job->match_idx), __ATOMIC_RELAXED);
+    if (begin_idx < match_idx)
+    {
+        sstr_pos chunk_match = sstr_pool_find(job->src_chars, begin_idx, end_idx,
+                                              job->pat_str);
+        // keep the smaller position if a chunk further left also matched
+        while (chunk_match < match_idx &&
+               !__atomic_compare_exchange_n(&(job->match_idx), &match_idx, chunk_match,
+                                            0, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+        {
+        }
+    }
+}
+
+
+/**
+ * Search the strings of one chunk of a batch search for a group of patterns
+ */
+static void sstr_pool_batch_chunk(
+    sstr_pool_job *job,
+    size_t        chunk_idx
+)
+{
+    size_t begin_idx = chunk_idx * job->chunk_len;
+    size_t end_idx   = job->length - begin_idx < job->chunk_len ?
+                       job->length : begin_idx + job->chunk_len;
+
+    for (size_t src_idx = begin_idx; src_idx < end_idx; ++src_idx)
+    {
+        const sstring *src_str  = job->src_strs[src_idx];
+        sstr_pos      *dst_idxs = &(job->dst_idxs[src_idx * job->pattern_stride +
+                                                  job->pattern_offset]);
+        for (size_t pat_idx = 0; pat_idx < job->pattern_count; ++pat_idx)
+        {
+            dst_idxs[pat_idx] = src_str != NULL ?
+                                sstr_pool_find_compiled(src_str, &(job->patterns[pat_idx])) :
+                                SSTR_NPOS;
+        }
+    }
+}
+
+
+/**
+ * Find the leftmost match of a pattern that starts
+ * between begin_idx and end_idx
+ *
+ * memchr() locates candidates for the pattern's first char
+ */
+static sstr_pos sstr_pool_find(
+    const char    *src_chars,
+    size_t        begin_idx,
+    size_t        end_idx,
+    const sstring *pat_str
+)
+{
+    sstr_pos match_idx = SSTR_NPOS;
+
+    size_t src_idx = begin_idx;
+    while (match_idx == SSTR_NPOS && src_idx < end_idx)
+    {
+        const char *first_char = memchr(&(src_chars[src_idx]), pat_str->chars[0],
+                                        end_idx - src_idx);
+        if (first_char != NULL)
+        {
+            src_idx = (size_t) (first_char - src_chars);
+            if (memcmp(&(first_char[1]), &(pat_str->chars[1]), pat_str->len - 1) == 0)
+            {
+                match_idx = src_idx;
+            }
+            ++src_idx;
+        }
+        else
+        {
+            src_idx = end_idx;
+        }
+    }
+
+    return match_idx;
+}
+
+
+/**
+ * Compile a pattern for a batch search
+ */
+static void sstr_pool_compile(
+    const sstring     *pat_str,
+    sstr_pool_pattern *dst_pattern
+)
+{
+    dst_pattern->pat_str = pat_str;
+
+    if (pat_str->len >= SSTR_POOL_SHIFT_MIN)
+    {
+        size_t max_shift = pat_str->len < 255 ? pat_str->len : 255;
+        memset(dst_pattern->shifts, (int) max_shift, sizeof (dst_pattern->shifts));
+        // the pattern's last char keeps the shift of its previous occurrence
+        for (size_t pat_idx = pat_str->len - max_shift; pat_idx < pat_str->len - 1; ++pat_idx)
+        {
+            dst_pattern->shifts[(unsigned char) pat_str->chars[pat_idx]] =
+                (unsigned char) (pat_str->len - 1 - pat_idx);
+        }
+    }
+}
+
+
+/**
+ * Find the leftmost match of a compiled pattern
+ *
+ * Long patterns are searched with the Boyer-Moore-Horspool algorithm,
+ * short patterns by locating candidates for their first char.
+ */
+static sstr_pos sstr_pool_find_compiled(
+    const sstring           *src_str,
+    const sstr_pool_pattern *pattern
+)
+{
+    sstr_pos      match_idx = SSTR_NPOS;
+    const sstring *pat_str  = pattern->pat_str;
+
+    if (pat_str->len == 0)
+    {
+        // the empty string always matches at position zero
+        match_idx = 0;
+    }
+    else
+    if (src_str->len >= pat_str->len)
+    {
+        size_t pos_count = src_str->len - pat_str->len + 1;
+        if (pat_str->len >= SSTR_POOL_SHIFT_MIN)
+        {
+            const char *src_chars = src_str->chars;
+            size_t     last_idx   = pat_str->len - 1;
+            char       last_char  = pat_str->chars[last_idx];
+            size_t     src_idx    = 0;
+            while (match_idx == SSTR_NPOS && src_idx < pos_count)
+            {
+                char src_char = src_chars[src_idx + last_idx];
+                if (src_char == last_char &&
+                    memcmp(&(src_chars[src_idx]), pat_str->chars, last_idx) == 0)
+                {
+                    match_idx = src_idx;
+                }
+                src_idx += pattern->shifts[(unsigned char) src_char];
+            }
+        }
+        else
+        {
+            match_idx = sstr_pool_find(src_str->chars, 0, pos_count, pat_str);
+        }
+    }
+
+    return match_idx;
+}
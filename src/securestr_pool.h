@@ -0,0 +1,141 @@
+/**
+ * secureStrings library
+ * version 0.54-beta (2014-10-25_001)
+ *
+ * secureStrings thread pool functions
+ *
+ * Copyright (C) 2010, 2014 Robert ALTNOEDER
+ *
+ * Redistribution and use in source and binary forms,
+ * with or without modification, are permitted provided that
+ * the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in
+ *     the documentation and/or other materials provided with the distribution.
+ *  3. The name of the author may not be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _SECURESTR_POOL_H
+#define _SECURESTR_POOL_H
+
+#include <unistd.h>
+#include <sys/types.h>
+#include <stdlib.h>
+#include <securestr.h>
+
+// An sstr_pool is a set of worker threads that split operations on
+// large secureStrings into chunks that are processed in parallel
+//
+// Operations on secureStrings that are shorter than the pool's threshold
+// are performed by the calling thread only. The calling thread always
+// takes part in an operation, so a pool with a thread count of n
+// starts n - 1 worker threads.
+//
+// The chunks of an operation are distributed evenly across the threads.
+// A thread that has processed its own chunks steals chunks from other
+// threads. A pool performs one operation at a time; operations that
+// are started concurrently by multiple threads are serialized.
+typedef struct sstr_pool_struct sstr_pool;
+
+
+#ifndef _SSTR_NO_DYNMEM
+/**
+ * Allocate a thread pool
+ *
+ * thread_count is the number of threads that take part in an operation,
+ * including the calling thread. Operations on secureStrings that are
+ * shorter than threshold are not split.
+ */
+sstr_pool *sstr_pool_alloc(
+    size_t thread_count,
+    size_t threshold
+);
+#endif /* not _SSTR_NO_DYNMEM */
+
+
+#ifndef _SSTR_NO_DYNMEM
+/**
+ * Stop the worker threads of a thread pool and deallocate it
+ *
+ * There must not be any operations in progress on the pool
+ */
+void sstr_pool_dealloc(
+    sstr_pool *dst_pool
+);
+#endif /* not _SSTR_NO_DYNMEM */
+
+
+/**
+ * Wipe a string in parallel, see sstr_wipe()
+ */
+sstr_rc sstr_pool_wipe(
+    sstr_pool *src_pool,
+    sstring   *dst_str
+);
+
+
+/**
+ * Copy a string in parallel, see sstr_cpy()
+ */
+sstr_rc sstr_pool_cpy(
+    sstr_pool     *src_pool,
+    const sstring *src_str,
+    sstring       *dst_str
+);
+
+
+/**
+ * Find a substring in parallel, see sstr_indexof()
+ *
+ * Returns the position of the leftmost match
+ */
+sstr_pos sstr_pool_indexof(
+    sstr_pool     *src_pool,
+    const sstring *src_str,
+    const sstring *pat_str
+);
+
+
+/**
+ * Find one or more substrings in each of an array of strings in parallel
+ *
+ * The position of the leftmost match of pattern pat_idx in string src_idx
+ * is stored in dst_idxs[src_idx * pat_count + pat_idx], or SSTR_NPOS if
+ * there is no match or the string is NULL. Strings are processed in
+ * chunks of consecutive strings that are searched for all patterns.
+ */
+sstr_rc sstr_indexof_batch(
+    sstr_pool             *src_pool,
+    const sstring * const *src_strs,
+    size_t                src_count,
+    const sstring * const *pat_strs,
+    size_t                pat_count,
+    sstr_pos              *dst_idxs
+);
+
+
+#define sstrPool            sstr_pool
+
+#define sstrPoolAlloc       sstr_pool_alloc
+#define sstrPoolDealloc     sstr_pool_dealloc
+#define sstrPoolWipe        sstr_pool_wipe
+#define sstrPoolCpy         sstr_pool_cpy
+#define sstrPoolIndexOf     sstr_pool_indexof
+#define sstrIndexOfBatch    sstr_indexof_batch
+
+#endif /* _SECURESTR_POOL_H */
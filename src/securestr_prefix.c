@@ -0,0 +1,452 @@
+/**
+ * secureStrings library
+ * version 0.54-beta (2014-10-25_001)
+ *
+ * secureStrings prefix index
+ *
+ * Copyright (C) 2010, 2014 Robert ALTNOEDER
+ *
+ * Redistribution and use in source and binary forms,
+ * with or without modification, are permitted provided that
+ * the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in
+ *     the documentation and/or other materials provided with the distribution.
+ *  3. The name of the author may not be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <unistd.h>
+#include <sys/types.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <securestr.h>
+#include <securestr_array.h>
+#include <securestr_prefix.h>
+
+// prefix_idx of a node that does not end a prefix
+#define SSTR_PREFIX_NONE ((uint32_t) 0xFFFFFFFFUL)
+// a trie of n prefixes has at most 2n nodes plus the root
+#define SSTR_PREFIX_COUNT_MAX ((size_t) 0x7FFFFFFEUL)
+
+// 32 bit fields keep nodes small, so that more of them share a cache line
+typedef struct sstr_prefix_node_struct
+{
+    // chars from the parent node to this node in the labels buffer
+    uint32_t label_offset;
+    uint32_t label_len;
+    // children are adjacent nodes
+    uint32_t first_child;
+    uint32_t child_count;
+    // array index of the prefix that ends at this node
+    uint32_t prefix_idx;
+}
+sstr_prefix_node;
+
+struct sstr_prefix_index_struct
+{
+    sstr_prefix_node *nodes;
+    // first label char of each node, searched to select a child
+    unsigned char    *first_chars;
+    char             *labels;
+    size_t           labels_len;
+    size_t           node_count;
+};
+
+#ifndef _SSTR_NO_DYNMEM
+static int sstr_prefix_order(
+    const sstr_array *src_arr,
+    uint32_t         arr_idx_a,
+    uint32_t         arr_idx_b
+);
+static void sstr_prefix_sort(
+    const sstr_array *src_arr,
+    uint32_t         *dst_order,
+    uint32_t         *tmp_order,
+    size_t           count
+);
+static void sstr_prefix_build(
+    const sstr_array  *src_arr,
+    const uint32_t    *src_order,
+    uint32_t          *tmp_ranges,
+    sstr_prefix_index *dst_index
+);
+#endif /* not _SSTR_NO_DYNMEM */
+static size_t sstr_prefix_match(
+    const sstr_prefix_index *src_index,
+    const sstring           *src_str,
+    sstr_pos                *dst_idxs,
+    size_t                  dst_cap,
+    sstr_pos                *dst_longest
+);
+
+
+#ifndef _SSTR_NO_DYNMEM
+/**
+ * Build a prefix index from all strings in an array
+ *
+ * If a prefix occurs more than once, its lowest index is reported.
+ * Returns NULL if the index cannot be allocated or the array holds
+ * more than 2^31 - 1 prefixes
+ */
+sstr_prefix_index *sstr_prefix_index_alloc(
+    const sstr_array *src_arr
+)
+{
+    sstr_prefix_index *dst_index = NULL;
+
+    if (src_arr != NULL && src_arr->count <= SSTR_PREFIX_COUNT_MAX &&
+        src_arr->count < SSTR_SIZE_T_MAX / (sizeof (sstr_prefix_node) * 2) &&
+        src_arr->len < (size_t) SSTR_PREFIX_NONE)
+    {
+        dst_index = malloc(sizeof (sstr_prefix_index));
+    }
+    if (dst_index != NULL)
+    {
+        size_t   count      = src_arr->count;
+        size_t   node_cap   = count * 2 + 1;
+        uint32_t *order     = malloc((count > 0 ? count : 1) * sizeof (uint32_t));
+        uint32_t *tmp       = malloc(node_cap * 2 * sizeof (uint32_t));
+        dst_index->nodes       = malloc(node_cap * sizeof (sstr_prefix_node));
+        dst_index->first_chars = malloc(node_cap);
+        dst_index->labels      = malloc(src_arr->len + 1);
+        if (order != NULL && tmp != NULL && dst_index->nodes != NULL &&
+            dst_index->first_chars != NULL && dst_index->labels != NULL)
+        {
+            for (size_t arr_idx = 0; arr_idx < count; ++arr_idx)
+            {
+                order[arr_idx] = (uint32_t) arr_idx;
+            }
+            sstr_prefix_sort(src_arr, order, tmp, count);
+            sstr_prefix_build(src_arr, order, tmp, dst_index);
+        }
+        else
+        {
+            free(dst_index->nodes);
+            free(dst_index->first_chars);
+            free(dst_index->labels);
+            free(dst_index);
+            dst_index = NULL;
+        }
+        free(order);
+        free(tmp);
+    }
+
+    return dst_index;
+}
+#endif /* not _SSTR_NO_DYNMEM */
+
+
+#ifndef _SSTR_NO_DYNMEM
+/**
+ * Wipe and deallocate a prefix index
+ */
+void sstr_prefix_index_dealloc(
+    sstr_prefix_index *dst_index
+)
+{
+    if (dst_index != NULL)
+    {
+        volatile char *labels = dst_index->labels;
+        for (size_t label_idx = 0; label_idx < dst_index->labels_len; ++label_idx)
+        {
+            labels[label_idx] = '\0';
+        }
+        free(dst_index->nodes);
+        free(dst_index->first_chars);
+        free(dst_index->labels);
+        free(dst_index);
+    }
+}
+#endif /* not _SSTR_NO_DYNMEM */
+
+
+/**
+ * Find the longest prefix of a string
+ *
+ * Returns the array index of the longest prefix that src_str starts with,
+ * or SSTR_NPOS if there is no such prefix
+ */
+sstr_pos sstr_prefix_index_longest(
+    const sstr_prefix_index *src_index,
+    const sstring           *src_str
+)
+{
+    sstr_pos longest_idx = SSTR_NPOS;
+
+    if (src_index != NULL && src_str != NULL)
+    {
+        sstr_prefix_match(src_index, src_str, NULL, 0, &longest_idx);
+    }
+
+    return longest_idx;
+}
+
+
+/**
+ * Find all prefixes of a string
+ *
+ * The array indexes of the prefixes that src_str starts with are stored
+ * in dst_idxs, shortest prefix first, up to dst_cap indexes.
+ * Returns the number of matching prefixes, which may exceed dst_cap.
+ * dst_idxs may be NULL if dst_cap is zero.
+ */
+size_t sstr_prefix_index_all(
+    const sstr_prefix_index *src_index,
+    const sstring           *src_str,
+    sstr_pos                *dst_idxs,
+    size_t                  dst_cap
+)
+{
+    size_t match_count = 0;
+
+    if (src_index != NULL && src_str != NULL && (dst_idxs != NULL || dst_cap == 0))
+    {
+        sstr_pos longest_idx = SSTR_NPOS;
+        match_count = sstr_prefix_match(src_index, src_str, dst_idxs, dst_cap,
+                                        &longest_idx);
+    }
+
+    return match_count;
+}
+
+
+#ifndef _SSTR_NO_DYNMEM
+/**
+ * Lexicographic order of two strings in an array, shorter strings first
+ */
+static int sstr_prefix_order(
+    const sstr_array *src_arr,
+    uint32_t         arr_idx_a,
+    uint32_t         arr_idx_b
+)
+{
+    size_t len_a   = src_arr->lengths[arr_idx_a];
+    size_t len_b   = src_arr->lengths[arr_idx_b];
+    int    order   = memcmp(&(src_arr->chars[src_arr->offsets[arr_idx_a]]),
+                            &(src_arr->chars[src_arr->offsets[arr_idx_b]]),
+                            len_a < len_b ? len_a : len_b);
+    if (order == 0)
+    {
+        order = len_a < len_b ? -1 : (len_a > len_b ? 1 : 0);
+    }
+
+    return order;
+}
+
+
+/**
+ * Sort array indexes by the order of their strings
+ *
+ * Bottom-up merge sort; it is stable, so equal strings remain ordered by
+ * their array index
+ */
+static void sstr_prefix_sort(
+    const sstr_array *src_arr,
+    uint32_t         *dst_order,
+    uint32_t         *tmp_order,
+    size_t           count
+)
+{
+    uint32_t *src_run = dst_order;
+    uint32_t *dst_run = tmp_order;
+    for (size_t run_len = 1; run_len < count; run_len *= 2)
+    {
+        for (size_t run_begin = 0; run_begin < count; run_begin += run_len * 2)
+        {
+            size_t mid_idx  = run_begin + run_len < count ? run_begin + run_len : count;
+            size_t end_idx  = mid_idx + run_len < count ? mid_idx + run_len : count;
+            size_t left_idx = run_begin;
+            size_t right_idx = mid_idx;
+            for (size_t out_idx = run_begin; out_idx < end_idx; ++out_idx)
+            {
+                if (right_idx >= end_idx ||
+                    (left_idx < mid_idx &&
+                     sstr_prefix_order(src_arr, src_run[left_idx], src_run[right_idx]) <= 0))
+                {
+                    dst_run[out_idx] = src_run[left_idx++];
+                }
+                else
+                {
+                    dst_run[out_idx] = src_run[right_idx++];
+                }
+            }
+        }
+        uint32_t *swap_run = src_run;
+        src_run = dst_run;
+        dst_run = swap_run;
+    }
+    if (src_run != dst_order)
+    {
+        memcpy(dst_order, src_run, count * sizeof (uint32_t));
+    }
+}
+
+
+/**
+ * Build the trie from the sorted array indexes
+ *
+ * Nodes are processed in the order they are created, which is
+ * breadth-first; the children of a node are created together, so they
+ * are adjacent. tmp_ranges holds the range of sorted strings below each
+ * node until the node is processed.
+ */
+static void sstr_prefix_build(
+    const sstr_array  *src_arr,
+    const uint32_t    *src_order,
+    uint32_t          *tmp_ranges,
+    sstr_prefix_index *dst_index
+)
+{
+    sstr_prefix_node *nodes      = dst_index->nodes;
+    size_t           node_count  = 1;
+    size_t           labels_len  = 0;
+
+    // the root node has an empty label and contains all strings
+    tmp_ranges[0] = 0;
+    tmp_ranges[1] = (uint32_t) src_arr->count;
+    dst_index->first_chars[0] = '\0';
+    for (size_t node_idx = 0; node_idx < node_count; ++node_idx)
+    {
+        size_t     range_begin = tmp_ranges[node_idx * 2];
+        size_t     range_end   = tmp_ranges[node_idx * 2 + 1];
+        // the label starts after the label of the parent node, where the
+        // strings in the range start to differ from the other strings
+        size_t     label_begin = node_idx == 0 ? 0 : nodes[node_idx].label_offset;
+        size_t     label_end   = label_begin;
+        if (node_idx > 0)
+        {
+            // the common prefix of a sorted range is the common prefix of
+            // its first and last string
+            const char *first_str = &(src_arr->chars[src_arr->offsets[src_order[range_begin]]]);
+            const char *last_str  = &(src_arr->chars[src_arr->offsets[src_order[range_end - 1]]]);
+            size_t     first_len  = src_arr->lengths[src_order[range_begin]];
+            size_t     last_len   = src_arr->lengths[src_order[range_end - 1]];
+            size_t     max_end    = first_len < last_len ? first_len : last_len;
+            while (label_end < max_end && first_str[label_end] == last_str[label_end])
+            {
+                ++label_end;
+            }
+            memcpy(&(dst_index->labels[labels_len]), &(first_str[label_begin]),
+                   label_end - label_begin);
+        }
+        nodes[node_idx].label_offset = (uint32_t) labels_len;
+        nodes[node_idx].label_len    = (uint32_t) (label_end - label_begin);
+        labels_len += label_end - label_begin;
+
+        // strings that end at this node sort first; the stable sort puts
+        // the lowest array index of duplicate strings first
+        nodes[node_idx].prefix_idx = SSTR_PREFIX_NONE;
+        if (range_begin < range_end && src_arr->lengths[src_order[range_begin]] == label_end)
+        {
+            nodes[node_idx].prefix_idx = src_order[range_begin];
+        }
+        while (range_begin < range_end && src_arr->lengths[src_order[range_begin]] == label_end)
+        {
+            ++range_begin;
+        }
+
+        // one child for each char that follows the label
+        nodes[node_idx].first_child = (uint32_t) node_count;
+        while (range_begin < range_end)
+        {
+            unsigned char child_char = (unsigned char)
+                src_arr->chars[src_arr->offsets[src_order[range_begin]] + label_end];
+            size_t        child_end  = range_begin + 1;
+            while (child_end < range_end &&
+                   (unsigned char) src_arr->chars[src_arr->offsets[src_order[child_end]] +
+                                                  label_end] == child_char)
+            {
+                ++child_end;
+            }
+            // the child's label begins at label_end; label_offset holds the
+            // begin of the label until the child is processed
+            nodes[node_count].label_offset = (uint32_t) label_end;
+            dst_index->first_chars[node_count] = child_char;
+            tmp_ranges[node_count * 2]     = (uint32_t) range_begin;
+            tmp_ranges[node_count * 2 + 1] = (uint32_t) child_end;
+            ++node_count;
+            range_begin = child_end;
+        }
+        nodes[node_idx].child_count = (uint32_t) (node_count - nodes[node_idx].first_child);
+    }
+
+    dst_index->labels_len = labels_len;
+    dst_index->node_count = node_count;
+}
+#endif /* not _SSTR_NO_DYNMEM */
+
+
+/**
+ * Walk the trie along a string
+ *
+ * Stores the array indexes of matching prefixes in dst_idxs, up to dst_cap,
+ * and the index of the longest matching prefix in dst_longest.
+ * Returns the number of matching prefixes
+ */
+static size_t sstr_prefix_match(
+    const sstr_prefix_index *src_index,
+    const sstring           *src_str,
+    sstr_pos                *dst_idxs,
+    size_t                  dst_cap,
+    sstr_pos                *dst_longest
+)
+{
+    size_t                 match_count = 0;
+    size_t                 str_idx     = 0;
+    const sstr_prefix_node *node       = src_index->nodes;
+    while (node != NULL)
+    {
+        if (node->prefix_idx != SSTR_PREFIX_NONE)
+        {
+            if (match_count < dst_cap)
+            {
+                dst_idxs[match_count] = node->prefix_idx;
+            }
+            ++match_count;
+            (*dst_longest) = node->prefix_idx;
+        }
+
+        const unsigned char *child_char = NULL;
+        if (str_idx < src_str->len && node->child_count > 0)
+        {
+            child_char = memchr(&(src_index->first_chars[node->first_child]),
+                                (unsigned char) src_str->chars[str_idx],
+                                node->child_count);
+        }
+
+        const sstr_prefix_node *child = NULL;
+        if (child_char != NULL)
+        {
+            child = &(src_index->nodes[child_char - src_index->first_chars]);
+            if (child->label_len <= src_str->len - str_idx &&
+                memcmp(&(src_index->labels[child->label_offset]),
+                       &(src_str->chars[str_idx]), child->label_len) == 0)
+            {
+                str_idx += child->label_len;
+            }
+            else
+            {
+                child = NULL;
+            }
+        }
+        node = child;
+    }
+
+    return match_count;
+}
@@ -0,0 +1,114 @@
+/**
+ * secureStrings library
+ * version 0.54-beta (2014-10-25_001)
+ *
+ * secureStrings prefix index
+ *
+ * Copyright (C) 2010, 2014 Robert ALTNOEDER
+ *
+ * Redistribution and use in source and binary forms,
+ * with or without modification, are permitted provided that
+ * the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in
+ *     the documentation and/or other materials provided with the distribution.
+ *  3. The name of the author may not be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _SECURESTR_PREFIX_H
+#define _SECURESTR_PREFIX_H
+
+#include <unistd.h>
+#include <sys/types.h>
+#include <stdlib.h>
+#include <securestr.h>
+#include <securestr_array.h>
+
+// A prefix index finds the prefixes in a set of strings that a string
+// starts with, in time proportional to the length of the string rather
+// than to the number of prefixes
+//
+// The index is a radix trie with path compression that is built once
+// from the prefixes in an sstr_array. Nodes are stored in breadth-first
+// order, so the children of a node are adjacent, and the first chars of
+// all children are kept in a separate table that is searched without
+// touching the nodes themselves. Matching prefixes are reported as
+// indexes into the sstr_array the index was built from. The index keeps
+// a copy of the prefixes, which is wiped when the index is deallocated.
+typedef struct sstr_prefix_index_struct sstr_prefix_index;
+
+
+#ifndef _SSTR_NO_DYNMEM
+/**
+ * Build a prefix index from all strings in an array
+ *
+ * If a prefix occurs more than once, its lowest index is reported.
+ * Returns NULL if the index cannot be allocated or the array holds
+ * more than 2^31 - 1 prefixes
+ */
+sstr_prefix_index *sstr_prefix_index_alloc(
+    const sstr_array *src_arr
+);
+#endif /* not _SSTR_NO_DYNMEM */
+
+
+#ifndef _SSTR_NO_DYNMEM
+/**
+ * Wipe and deallocate a prefix index
+ */
+void sstr_prefix_index_dealloc(
+    sstr_prefix_index *dst_index
+);
+#endif /* not _SSTR_NO_DYNMEM */
+
+
+/**
+ * Find the longest prefix of a string
+ *
+ * Returns the array index of the longest prefix that src_str starts with,
+ * or SSTR_NPOS if there is no such prefix
+ */
+sstr_pos sstr_prefix_index_longest(
+    const sstr_prefix_index *src_index,
+    const sstring           *src_str
+);
+
+
+/**
+ * Find all prefixes of a string
+ *
+ * The array indexes of the prefixes that src_str starts with are stored
+ * in dst_idxs, shortest prefix first, up to dst_cap indexes.
+ * Returns the number of matching prefixes, which may exceed dst_cap.
+ * dst_idxs may be NULL if dst_cap is zero.
+ */
+size_t sstr_prefix_index_all(
+    const sstr_prefix_index *src_index,
+    const sstring           *src_str,
+    sstr_pos                *dst_idxs,
+    size_t                  dst_cap
+);
+
+
+#define sstrPrefixIndex     sstr_prefix_index
+#define sstrPrefixIndexAlloc sstr_prefix_index_alloc
+#define sstrPrefixIndexDealloc sstr_prefix_index_dealloc
+#define sstrPrefixIndexLongest sstr_prefix_index_longest
+#define sstrPrefixIndexAll  sstr_prefix_index_all
+
+#endif /* _SECURESTR_PREFIX_H */
@@ -0,0 +1,144 @@
+/**
+ * secureStrings library
+ * version 0.54-beta (2014-10-25_001)
+ *
+ * secureStrings shared strings
+ *
+ * Copyright (C) 2010, 2014 Robert ALTNOEDER
+ *
+ * Redistribution and use in source and binary forms,
+ * with or without modification, are permitted provided that
+ * the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in
+ *     the documentation and/or other materials provided with the distribution.
+ *  3. The name of the author may not be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <unistd.h>
+#include <sys/types.h>
+#include <stdlib.h>
+#include <securestr.h>
+#include <securestr_shared.h>
+
+struct sstr_shared_struct
+{
+    // read-only view of the char array
+    sstring str;
+    // number of references
+    size_t  refs;
+};
+
+
+#ifndef _SSTR_NO_DYNMEM
+/**
+ * Freeze a secureString into a shared string with one reference
+ *
+ * src_str must have been allocated by sstr_alloc() and is deallocated
+ * by this function; its char array becomes part of the shared string.
+ * If the shared string cannot be allocated, NULL is returned and
+ * src_str remains valid.
+ */
+sstr_shared *sstr_freeze(
+    sstring *src_str
+)
+{
+    sstr_shared *dst_shared = NULL;
+
+    if (src_str != NULL)
+    {
+        dst_shared = malloc(sizeof (sstr_shared));
+        if (dst_shared != NULL)
+        {
+            dst_shared->str  = *src_str;
+            dst_shared->refs = 1;
+
+            // sstr_alloc() allocates the sstring separately from its
+            // char array, which is now owned by the shared string
+            free(src_str);
+        }
+    }
+
+    return dst_shared;
+}
+#endif /* not _SSTR_NO_DYNMEM */
+
+
+/**
+ * Add a reference to a shared string
+ *
+ * Returns the shared string
+ */
+sstr_shared *sstr_shared_ref(
+    sstr_shared *src_shared
+)
+{
+    if (src_shared != NULL)
+    {
+        // the caller already holds a reference, so the shared string
+        // cannot be deallocated concurrently and no ordering is required
+        __atomic_add_fetch(&(src_shared->refs), 1, __ATOMIC_RELAXED);
+    }
+
+    return src_shared;
+}
+
+
+#ifndef _SSTR_NO_DYNMEM
+/**
+ * Drop a reference to a shared string
+ *
+ * Dropping the last reference wipes and deallocates the shared string
+ */
+void sstr_shared_unref(
+    sstr_shared *dst_shared
+)
+{
+    if (dst_shared != NULL)
+    {
+        // release: reads through this reference happen before the wipe;
+        // acquire: the last owner sees all other owners' reads completed
+        if (__atomic_sub_fetch(&(dst_shared->refs), 1, __ATOMIC_ACQ_REL) == 0)
+        {
+            sstr_wipe(&(dst_shared->str));
+            free(dst_shared->str.chars);
+            free(dst_shared);
+        }
+    }
+}
+#endif /* not _SSTR_NO_DYNMEM */
+
+
+/**
+ * Get a read-only view of a shared string
+ *
+ * The view remains valid as long as the caller holds a reference
+ */
+const sstring *sstr_shared_str(
+    const sstr_shared *src_shared
+)
+{
+    const sstring *dst_view = NULL;
+
+    if (src_shared != NULL)
+    {
+        dst_view = &(src_shared->str);
+    }
+
+    return dst_view;
+}
@@ -0,0 +1,614 @@
+/**
+ * secureStrings library
+ * version 0.54-beta (2014-10-25_001)
+ *
+ * secureStrings UTF-8 functions
+ *
+ * Copyright (C) 2010, 2014 Robert ALTNOEDER
+ *
+ * Redistribution and use in source and binary forms,
+ * with or without modification, are permitted provided that
+ * the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in
+ *     the documentation and/or other materials provided with the distribution.
+ *  3. The name of the author may not be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <unistd.h>
+#include <sys/types.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <securestr.h>
+#include <securestr_utf8.h>
+
+#ifdef __SSE2__
+    #include <emmintrin.h>
+#endif
+#ifdef __SSSE3__
+    #include <tmmintrin.h>
+#endif
+#ifdef __AVX2__
+    #include <immintrin.h>
+#endif
+
+static int sstr_utf8_valid_from(
+    const unsigned char *src_chars,
+    size_t              src_len,
+    size_t              src_idx
+);
+#ifdef __SSE2__
+static unsigned int sstr_utf8_lowbit(
+    unsigned int mask
+);
+#endif /* __SSE2__ */
+#if defined(__SSSE3__) || defined(__AVX2__)
+static size_t sstr_utf8_restart_idx(
+    const unsigned char *src_chars,
+    size_t              src_idx
+);
+#endif /* __SSSE3__ || __AVX2__ */
+
+/*
+ * Lookup table validation
+ *
+ * John Keiser, Daniel Lemire, "Validating UTF-8 In Less Than One
+ * Instruction Per Byte", 2021: three 16 entry tables, indexed by the high
+ * and low nibble of each byte's predecessor and by the high nibble of the
+ * byte itself, yield flags for all errors that involve two consecutive
+ * bytes. The flags of each error are set in all three tables, so a flag
+ * survives combining the lookups with AND only if the error is present.
+ * Third and fourth bytes are checked by comparing the bytes two and
+ * three positions back with the 3 and 4 byte lead bytes.
+ */
+#if defined(__SSSE3__) || defined(__AVX2__)
+// lead byte or ASCII followed by ASCII or a lead byte
+#define SSTR_UTF8_TOO_SHORT     (1 << 0)
+// ASCII followed by a continuation byte
+#define SSTR_UTF8_TOO_LONG      (1 << 1)
+// E0 followed by 80 - 9F
+#define SSTR_UTF8_OVERLONG_3    (1 << 2)
+// F4 followed by 90 - BF, or F5 - FF followed by 90 - BF
+#define SSTR_UTF8_TOO_LARGE     (1 << 3)
+// ED followed by A0 - BF
+#define SSTR_UTF8_SURROGATE     (1 << 4)
+// C0 or C1 followed by a continuation byte
+#define SSTR_UTF8_OVERLONG_2    (1 << 5)
+// F5 - FF followed by 80 - 8F, or F0 followed by 80 - 8F
+#define SSTR_UTF8_TOO_LARGE_80  (1 << 6)
+#define SSTR_UTF8_OVERLONG_4    (1 << 6)
+// continuation byte followed by a continuation byte
+#define SSTR_UTF8_TWO_CONTS     (1 << 7)
+// flags that do not depend on the low nibble of the first byte
+#define SSTR_UTF8_CARRY         (SSTR_UTF8_TOO_SHORT | SSTR_UTF8_TOO_LONG | SSTR_UTF8_TWO_CONTS)
+
+#define SSTR_UTF8_BYTE1_HIGH \
+    SSTR_UTF8_TOO_LONG, SSTR_UTF8_TOO_LONG, SSTR_UTF8_TOO_LONG, SSTR_UTF8_TOO_LONG, \
+    SSTR_UTF8_TOO_LONG, SSTR_UTF8_TOO_LONG, SSTR_UTF8_TOO_LONG, SSTR_UTF8_TOO_LONG, \
+    (char) SSTR_UTF8_TWO_CONTS, (char) SSTR_UTF8_TWO_CONTS, \
+    (char) SSTR_UTF8_TWO_CONTS, (char) SSTR_UTF8_TWO_CONTS, \
+    SSTR_UTF8_TOO_SHORT | SSTR_UTF8_OVERLONG_2, \
+    SSTR_UTF8_TOO_SHORT, \
+    SSTR_UTF8_TOO_SHORT | SSTR_UTF8_OVERLONG_3 | SSTR_UTF8_SURROGATE, \
+    SSTR_UTF8_TOO_SHORT | SSTR_UTF8_TOO_LARGE | SSTR_UTF8_TOO_LARGE_80 | SSTR_UTF8_OVERLONG_4
+
+#define SSTR_UTF8_BYTE1_LOW \
+    (char) (SSTR_UTF8_CARRY | SSTR_UTF8_OVERLONG_3 | SSTR_UTF8_OVERLONG_2 | SSTR_UTF8_OVERLONG_4), \
+    (char) (SSTR_UTF8_CARRY | SSTR_UTF8_OVERLONG_2), \
+    (char) SSTR_UTF8_CARRY, \
+    (char) SSTR_UTF8_CARRY, \
+    (char) (SSTR_UTF8_CARRY | SSTR_UTF8_TOO_LARGE), \
+    (char) (SSTR_UTF8_CARRY | SSTR_UTF8_TOO_LARGE | SSTR_UTF8_TOO_LARGE_80), \
+    (char) (SSTR_UTF8_CARRY | SSTR_UTF8_TOO_LARGE | SSTR_UTF8_TOO_LARGE_80), \
+    (char) (SSTR_UTF8_CARRY | SSTR_UTF8_TOO_LARGE | SSTR_UTF8_TOO_LARGE_80), \
+    (char) (SSTR_UTF8_CARRY | SSTR_UTF8_TOO_LARGE | SSTR_UTF8_TOO_LARGE_80), \
+    (char) (SSTR_UTF8_CARRY | SSTR_UTF8_TOO_LARGE | SSTR_UTF8_TOO_LARGE_80), \
+    (char) (SSTR_UTF8_CARRY | SSTR_UTF8_TOO_LARGE | SSTR_UTF8_TOO_LARGE_80), \
+    (char) (SSTR_UTF8_CARRY | SSTR_UTF8_TOO_LARGE | SSTR_UTF8_TOO_LARGE_80), \
+    (char) (SSTR_UTF8_CARRY | SSTR_UTF8_TOO_LARGE | SSTR_UTF8_TOO_LARGE_80), \
+    (char) (SSTR_UTF8_CARRY | SSTR_UTF8_TOO_LARGE | SSTR_UTF8_TOO_LARGE_80 | SSTR_UTF8_SURROGATE), \
+    (char) (SSTR_UTF8_CARRY | SSTR_UTF8_TOO_LARGE | SSTR_UTF8_TOO_LARGE_80), \
+    (char) (SSTR_UTF8_CARRY | SSTR_UTF8_TOO_LARGE | SSTR_UTF8_TOO_LARGE_80)
+
+#define SSTR_UTF8_BYTE2_HIGH \
+    SSTR_UTF8_TOO_SHORT, SSTR_UTF8_TOO_SHORT, SSTR_UTF8_TOO_SHORT, SSTR_UTF8_TOO_SHORT, \
+    SSTR_UTF8_TOO_SHORT, SSTR_UTF8_TOO_SHORT, SSTR_UTF8_TOO_SHORT, SSTR_UTF8_TOO_SHORT, \
+    (char) (SSTR_UTF8_TOO_LONG | SSTR_UTF8_OVERLONG_2 | SSTR_UTF8_TWO_CONTS | \
+            SSTR_UTF8_OVERLONG_3 | SSTR_UTF8_TOO_LARGE_80 | SSTR_UTF8_OVERLONG_4), \
+    (char) (SSTR_UTF8_TOO_LONG | SSTR_UTF8_OVERLONG_2 | SSTR_UTF8_TWO_CONTS | \
+            SSTR_UTF8_OVERLONG_3 | SSTR_UTF8_TOO_LARGE), \
+    (char) (SSTR_UTF8_TOO_LONG | SSTR_UTF8_OVERLONG_2 | SSTR_UTF8_TWO_CONTS | \
+            SSTR_UTF8_SURROGATE | SSTR_UTF8_TOO_LARGE), \
+    (char) (SSTR_UTF8_TOO_LONG | SSTR_UTF8_OVERLONG_2 | SSTR_UTF8_TWO_CONTS | \
+            SSTR_UTF8_SURROGATE | SSTR_UTF8_TOO_LARGE), \
+    SSTR_UTF8_TOO_SHORT, SSTR_UTF8_TOO_SHORT, SSTR_UTF8_TOO_SHORT, SSTR_UTF8_TOO_SHORT
+
+// bytes that still need continuation bytes at the end of a block
+#define SSTR_UTF8_INCOMPLETE_MAX \
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, \
+    (char) (0xF0 - 1), (char) (0xE0 - 1), (char) (0xC0 - 1)
+#endif /* __SSSE3__ || __AVX2__ */
+
+
+#if defined(__SSSE3__) && !defined(__AVX2__)
+/**
+ * Error flags of a 16 byte block
+ */
+static __m128i sstr_utf8_check_ssse3(
+    __m128i input,
+    __m128i prev_input
+)
+{
+    __m128i nibble_mask = _mm_set1_epi8(0x0F);
+    __m128i prev1       = _mm_alignr_epi8(input, prev_input, 15);
+
+    __m128i byte1_high = _mm_shuffle_epi8(_mm_setr_epi8(SSTR_UTF8_BYTE1_HIGH),
+                                          _mm_and_si128(_mm_srli_epi16(prev1, 4), nibble_mask));
+    __m128i byte1_low  = _mm_shuffle_epi8(_mm_setr_epi8(SSTR_UTF8_BYTE1_LOW),
+                                          _mm_and_si128(prev1, nibble_mask));
+    __m128i byte2_high = _mm_shuffle_epi8(_mm_setr_epi8(SSTR_UTF8_BYTE2_HIGH),
+                                          _mm_and_si128(_mm_srli_epi16(input, 4), nibble_mask));
+    __m128i special    = _mm_and_si128(_mm_and_si128(byte1_high, byte1_low), byte2_high);
+
+    // only 3 and 4 byte lead bytes are 0x80 or more after the subtraction;
+    // the bytes after them must be continuation bytes, which TWO_CONTS
+    // flags as an error, so the flag is toggled off again
+    __m128i prev2  = _mm_alignr_epi8(input, prev_input, 14);
+    __m128i prev3  = _mm_alignr_epi8(input, prev_input, 13);
+    __m128i must23 = _mm_or_si128(_mm_subs_epu8(prev2, _mm_set1_epi8((char) (0xE0 - 0x80))),
+                                  _mm_subs_epu8(prev3, _mm_set1_epi8((char) (0xF0 - 0x80))));
+    return _mm_xor_si128(_mm_and_si128(must23, _mm_set1_epi8((char) 0x80)), special);
+}
+
+
+/**
+ * Validate complete 16 byte blocks
+ *
+ * Sets (*dst_idx) to the index from which validation must continue
+ */
+static int sstr_utf8_blocks_simd(
+    const unsigned char *src_chars,
+    size_t              src_len,
+    size_t              *dst_idx
+)
+{
+    __m128i error           = _mm_setzero_si128();
+    __m128i prev_input      = _mm_setzero_si128();
+    __m128i prev_incomplete = _mm_setzero_si128();
+    size_t  src_idx         = 0;
+
+    for (; src_len - src_idx >= 16; src_idx += 16)
+    {
+        __m128i input = _mm_loadu_si128((const __m128i *) &(src_chars[src_idx]));
+        if (_mm_movemask_epi8(input) == 0)
+        {
+            // ASCII is valid unless the previous block ended
+            // within a sequence
+            error = _mm_or_si128(error, prev_incomplete);
+        }
+        else
+        {
+            error = _mm_or_si128(error, sstr_utf8_check_ssse3(input, prev_input));
+            prev_incomplete = _mm_subs_epu8(input, _mm_setr_epi8(SSTR_UTF8_INCOMPLETE_MAX));
+        }
+        prev_input = input;
+    }
+
+    (*dst_idx) = sstr_utf8_restart_idx(src_chars, src_idx);
+    return _mm_movemask_epi8(_mm_cmpeq_epi8(error, _mm_setzero_si128())) == 0xFFFF;
+}
+#endif /* __SSSE3__ && not __AVX2__ */
+
+
+#ifdef __AVX2__
+/**
+ * Bytes of input shifted by shift positions, with the last bytes of
+ * prev_input shifted in
+ */
+#define SSTR_UTF8_PREV_AVX2(input, prev_input, shift) \
+    _mm256_alignr_epi8((input), _mm256_permute2x128_si256((prev_input), (input), 0x21), \
+                       16 - (shift))
+
+/**
+ * Error flags of a 32 byte block
+ */
+static __m256i sstr_utf8_check_avx2(
+    __m256i input,
+    __m256i prev_input
+)
+{
+    __m256i nibble_mask = _mm256_set1_epi8(0x0F);
+    __m256i prev1       = SSTR_UTF8_PREV_AVX2(input, prev_input, 1);
+
+    __m256i byte1_high = _mm256_shuffle_epi8(
+        _mm256_setr_epi8(SSTR_UTF8_BYTE1_HIGH, SSTR_UTF8_BYTE1_HIGH),
+        _mm256_and_si256(_mm256_srli_epi16(prev1, 4), nibble_mask));
+    __m256i byte1_low  = _mm256_shuffle_epi8(
+        _mm256_setr_epi8(SSTR_UTF8_BYTE1_LOW, SSTR_UTF8_BYTE1_LOW),
+        _mm256_and_si256(prev1, nibble_mask));
+    __m256i byte2_high = _mm256_shuffle_epi8(
+        _mm256_setr_epi8(SSTR_UTF8_BYTE2_HIGH, SSTR_UTF8_BYTE2_HIGH),
+        _mm256_and_si256(_mm256_srli_epi16(input, 4), nibble_mask));
+    __m256i special    = _mm256_and_si256(_mm256_and_si256(byte1_high, byte1_low), byte2_high);
+
+    __m256i prev2  = SSTR_UTF8_PREV_AVX2(input, prev_input, 2);
+    __m256i prev3  = SSTR_UTF8_PREV_AVX2(input, prev_input, 3);
+    __m256i must23 = _mm256_or_si256(
+        _mm256_subs_epu8(prev2, _mm256_set1_epi8((char) (0xE0 - 0x80))),
+        _mm256_subs_epu8(prev3, _mm256_set1_epi8((char) (0xF0 - 0x80))));
+    return _mm256_xor_si256(_mm256_and_si256(must23, _mm256_set1_epi8((char) 0x80)), special);
+}
+
+
+/**
+ * Validate complete 32 byte blocks
+ *
+ * Sets (*dst_idx) to the index from which validation must continue
+ */
+static int sstr_utf8_blocks_simd(
+    const unsigned char *src_chars,
+    size_t              src_len,
+    size_t              *dst_idx
+)
+{
+    __m256i error           = _mm256_setzero_si256();
+    __m256i prev_input      = _mm256_setzero_si256();
+    __m256i prev_incomplete = _mm256_setzero_si256();
+    size_t  src_idx         = 0;
+
+    for (; src_len - src_idx >= 32; src_idx += 32)
+    {
+        __m256i input = _mm256_loadu_si256((const __m256i *) &(src_chars[src_idx]));
+        if (_mm256_movemask_epi8(input) == 0)
+        {
+            error = _mm256_or_si256(error, prev_incomplete);
+        }
+        else
+        {
+            error = _mm256_or_si256(error, sstr_utf8_check_avx2(input, prev_input));
+            prev_incomplete = _mm256_subs_epu8(input, _mm256_setr_epi8(
+                -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                SSTR_UTF8_INCOMPLETE_MAX));
+        }
+        prev_input = input;
+    }
+
+    (*dst_idx) = sstr_utf8_restart_idx(src_chars, src_idx);
+    return _mm256_testz_si256(error, error);
+}
+#endif /* __AVX2__ */
+
+
+/**
+ * Check whether a string is valid UTF-8
+ *
+ * Rejects overlong encodings, surrogates, code points above U+10FFFF
+ * and incomplete sequences.
+ * Returns SSTR_TRUE if the string is valid, SSTR_FALSE otherwise
+ */
+sstr_rc sstr_utf8_validate(
+    const sstring *src_str
+)
+{
+    sstr_rc sstr_status = SSTR_FAIL;
+
+    if (src_str != NULL)
+    {
+        const unsigned char *src_chars = (const unsigned char *) src_str->chars;
+        size_t              src_idx    = 0;
+        int                 valid      = 1;
+
+        #if defined(__SSSE3__) || defined(__AVX2__)
+        valid = sstr_utf8_blocks_simd(src_chars, src_str->len, &src_idx);
+        #endif /* __SSSE3__ || __AVX2__ */
+
+        if (valid && sstr_utf8_valid_from(src_chars, src_str->len, src_idx))
+        {
+            sstr_status = SSTR_TRUE;
+        }
+        else
+        {
+            sstr_status = SSTR_FALSE;
+        }
+    }
+
+    return sstr_status;
+}
+
+
+/**
+ * Count the code points in a valid UTF-8 string
+ *
+ * For invalid UTF-8, the result is the number of bytes that are not
+ * continuation bytes
+ */
+size_t sstr_utf8_count(
+    const sstring *src_str
+)
+{
+    size_t cp_count = SSTR_SIZE_FAIL;
+
+    if (src_str != NULL)
+    {
+        const char *src_chars  = src_str->chars;
+        size_t     src_len     = src_str->len;
+        size_t     src_idx     = 0;
+        size_t     cont_count  = 0;
+
+        #ifdef __AVX2__
+        while (src_len - src_idx >= 32)
+        {
+            // byte counters are summed up before they can overflow
+            __m256i counters = _mm256_setzero_si256();
+            for (size_t round = 0; round < 255 && src_len - src_idx >= 32; ++round)
+            {
+                __m256i bytes = _mm256_loadu_si256((const __m256i *) &(src_chars[src_idx]));
+                counters = _mm256_sub_epi8(counters,
+                                           _mm256_cmpgt_epi8(_mm256_set1_epi8(-64), bytes));
+                src_idx += 32;
+            }
+            __m256i sums = _mm256_sad_epu8(counters, _mm256_setzero_si256());
+            __m128i half = _mm_add_epi64(_mm256_castsi256_si128(sums),
+                                         _mm256_extracti128_si256(sums, 1));
+            cont_count += (size_t) _mm_cvtsi128_si32(half) +
+                          (size_t) _mm_cvtsi128_si32(_mm_srli_si128(half, 8));
+        }
+        #endif /* __AVX2__ */
+
+        #ifdef __SSE2__
+        while (src_len - src_idx >= 16)
+        {
+            __m128i counters = _mm_setzero_si128();
+            for (size_t round = 0; round < 255 && src_len - src_idx >= 16; ++round)
+            {
+                // continuation bytes 80 - BF are -128 to -65 as signed bytes
+                __m128i bytes = _mm_loadu_si128((const __m128i *) &(src_chars[src_idx]));
+                counters = _mm_sub_epi8(counters, _mm_cmpgt_epi8(_mm_set1_epi8(-64), bytes));
+                src_idx += 16;
+            }
+            __m128i sums = _mm_sad_epu8(counters, _mm_setzero_si128());
+            cont_count += (size_t) _mm_cvtsi128_si32(sums) +
+                          (size_t) _mm_cvtsi128_si32(_mm_srli_si128(sums, 8));
+        }
+        #endif /* __SSE2__ */
+
+        for (; src_idx < src_len; ++src_idx)
+        {
+            if ((src_chars[src_idx] & 0xC0) == 0x80)
+            {
+                ++cont_count;
+            }
+        }
+
+        cp_count = src_len - cont_count;
+    }
+
+    return cp_count;
+}
+
+
+/**
+ * Truncate a UTF-8 string to at most the specified length in bytes
+ *
+ * Unlike sstr_trunc(), a code point that would be cut is removed
+ * completely, so the result ends on a code point boundary
+ */
+sstr_rc sstr_utf8_trunc(
+    sstring *dst_str,
+    size_t  sstr_len
+)
+{
+    sstr_rc sstr_status = SSTR_FAIL;
+
+    if (dst_str != NULL)
+    {
+        if (sstr_len <= dst_str->len)
+        {
+            // if the first removed byte is a continuation byte, move the
+            // end back to the lead byte of its sequence, which is at most
+            // three bytes before it
+            size_t new_len = sstr_len;
+            while (new_len < dst_str->len && new_len > 0 && sstr_len - new_len < 3 &&
+                   (dst_str->chars[new_len] & 0xC0) == 0x80)
+            {
+                --new_len;
+            }
+            if (new_len < sstr_len && (dst_str->chars[new_len] & 0xC0) != 0xC0)
+            {
+                // no lead byte found; the string is not valid UTF-8
+                new_len = sstr_len;
+            }
+
+            dst_str->len = new_len;
+            dst_str->chars[new_len] = '\0';
+
+            sstr_status = SSTR_PASS;
+        }
+    }
+
+    return sstr_status;
+}
+
+
+#if defined(__SSSE3__) || defined(__AVX2__)
+/**
+ * Index of the first byte of the code point that contains the byte
+ * before src_idx, if that code point may continue at src_idx
+ *
+ * Used to continue validation after the SIMD blocks
+ */
+static size_t sstr_utf8_restart_idx(
+    const unsigned char *src_chars,
+    size_t              src_idx
+)
+{
+    size_t back_len = 0;
+    while (back_len < 3 && back_len < src_idx &&
+           (src_chars[src_idx - back_len - 1] & 0xC0) == 0x80)
+    {
+        ++back_len;
+    }
+    if (back_len < src_idx && src_chars[src_idx - back_len - 1] >= 0xC0)
+    {
+        ++back_len;
+    }
+    else
+    {
+        // the continuation bytes complete a sequence that the
+        // SIMD blocks have validated, or there are none
+        back_len = 0;
+    }
+
+    return src_idx - back_len;
+}
+#endif /* __SSSE3__ || __AVX2__ */
+
+
+/**
+ * Validate UTF-8 from a code point boundary to the end of a string
+ *
+ * ASCII bytes are skipped 16 (SSE2) or 8 bytes at a time.
+ * Well-formed sequences are those of the Unicode Standard, table 3-7.
+ */
+static int sstr_utf8_valid_from(
+    const unsigned char *src_chars,
+    size_t              src_len,
+    size_t              src_idx
+)
+{
+    int valid = 1;
+
+    while (valid && src_idx < src_len)
+    {
+        #ifdef __SSE2__
+        // skip to the next non-ASCII byte
+        unsigned int ascii_mask = 0;
+        while (src_len - src_idx >= 16 &&
+               (ascii_mask = (unsigned int) _mm_movemask_epi8(
+                   _mm_loadu_si128((const __m128i *) &(src_chars[src_idx])))) == 0)
+        {
+            src_idx += 16;
+        }
+        if (src_len - src_idx >= 16)
+        {
+            src_idx += sstr_utf8_lowbit(ascii_mask);
+        }
+        #else
+        uint64_t word;
+        while (src_len - src_idx >= 8 &&
+               (memcpy(&word, &(src_chars[src_idx]), sizeof (word)),
+                (word & 0x8080808080808080ULL) == 0))
+        {
+            src_idx += 8;
+        }
+        #endif /* __SSE2__ */
+
+        if (src_idx < src_len)
+        {
+            unsigned char lead    = src_chars[src_idx];
+            size_t        seq_len = 1;
+            // range of the second byte
+            unsigned char low     = 0x80;
+            unsigned char high    = 0xBF;
+
+            if (lead < 0x80)
+            {
+                seq_len = 1;
+            }
+            else
+            if (lead >= 0xC2 && lead <= 0xDF)
+            {
+                seq_len = 2;
+            }
+            else
+            if (lead >= 0xE0 && lead <= 0xEF)
+            {
+                seq_len = 3;
+                if (lead == 0xE0)
+                {
+                    // overlong
+                    low = 0xA0;
+                }
+                else
+                if (lead == 0xED)
+                {
+                    // surrogates
+                    high = 0x9F;
+                }
+            }
+            else
+            if (lead >= 0xF0 && lead <= 0xF4)
+            {
+                seq_len = 4;
+                if (lead == 0xF0)
+                {
+                    // overlong
+                    low = 0x90;
+                }
+                else
+                if (lead == 0xF4)
+                {
+                    // above U+10FFFF
+                    high = 0x8F;
+                }
+            }
+            else
+            {
+                // continuation byte, C0, C1 or F5 - FF
+                valid = 0;
+            }
+
+            if (valid && seq_len > 1)
+            {
+                valid = src_len - src_idx >= seq_len &&
+                        src_chars[src_idx + 1] >= low && src_chars[src_idx + 1] <= high;
+                for (size_t cont_idx = 2; valid && cont_idx < seq_len; ++cont_idx)
+                {
+                    valid = (src_chars[src_idx + cont_idx] & 0xC0) == 0x80;
+                }
+            }
+            src_idx += seq_len;
+        }
+    }
+
+    return valid;
+}
+
+
+#ifdef __SSE2__
+/**
+ * Index of the lowest set bit in a non-zero mask
+ */
+static unsigned int sstr_utf8_lowbit(
+    unsigned int mask
+)
+{
+    #ifdef __GNUC__
+    return (unsigned int) __builtin_ctz(mask);
+    #else
+    unsigned int bit_idx = 0;
+    while ((mask & 1U) == 0)
+    {
+        mask >>= 1;
+        ++bit_idx;
+    }
+    return bit_idx;
+    #endif /* __GNUC__ */
+}
+#endif /* __SSE2__ */
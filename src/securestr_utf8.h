@@ -0,0 +1,81 @@
+/**
+ * secureStrings library
+ * version 0.54-beta (2014-10-25_001)
+ *
+ * secureStrings UTF-8 functions
+ *
+ * Copyright (C) 2010, 2014 Robert ALTNOEDER
+ *
+ * Redistribution and use in source and binary forms,
+ * with or without modification, are permitted provided that
+ * the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in
+ *     the documentation and/or other materials provided with the distribution.
+ *  3. The name of the author may not be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _SECURESTR_UTF8_H
+#define _SECURESTR_UTF8_H
+
+#include <unistd.h>
+#include <sys/types.h>
+#include <stdlib.h>
+#include <securestr.h>
+
+
+/**
+ * Check whether a string is valid UTF-8
+ *
+ * Rejects overlong encodings, surrogates, code points above U+10FFFF
+ * and incomplete sequences.
+ * Returns SSTR_TRUE if the string is valid, SSTR_FALSE otherwise
+ */
+sstr_rc sstr_utf8_validate(
+    const sstring *src_str
+);
+
+
+/**
+ * Count the code points in a valid UTF-8 string
+ *
+ * For invalid UTF-8, the result is the number of bytes that are not
+ * continuation bytes
+ */
+size_t sstr_utf8_count(
+    const sstring *src_str
+);
+
+
+/**
+ * Truncate a UTF-8 string to at most the specified length in bytes
+ *
+ * Unlike sstr_trunc(), a code point that would be cut is removed
+ * completely, so the result ends on a code point boundary
+ */
+sstr_rc sstr_utf8_trunc(
+    sstring *dst_str,
+    size_t  sstr_len
+);
+
+
+#define sstrUtf8Validate    sstr_utf8_validate
+#define sstrUtf8Count       sstr_utf8_count
+#define sstrUtf8Trunc       sstr_utf8_trunc
+
+#endif /* _SECURESTR_UTF8_H */
@@ -0,0 +1,614 @@
+/**
+ * secureStrings library
+ * version 0.54-beta (2014-10-25_001)
+ *
+ * secureStrings concurrent vault
+ *
+ * Copyright (C) 2010, 2014 Robert ALTNOEDER
+ *
+ * Redistribution and use in source and binary forms,
+ * with or without modification, are permitted provided that
+ * the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in
+ *     the documentation and/or other materials provided with the distribution.
+ *  3. The name of the author may not be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <unistd.h>
+#include <sys/types.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <sched.h>
+#include <pthread.h>
+#include <securestr.h>
+#include <securestr_hash.h>
+#include <securestr_vault.h>
+
+// number of reader counter stripes; readers on different stripes
+// do not write to the same cache line
+#define SSTR_VAULT_STRIPES    ((size_t) 64)
+#define SSTR_VAULT_LINE_SIZE  64
+
+typedef struct sstr_vault_entry_struct
+{
+    sstr_hashval hash;
+    sstring      *key;
+    sstring      *value;
+}
+sstr_vault_entry;
+
+// one version of a vault's table; never modified after publication
+typedef struct sstr_vault_table_struct
+{
+    size_t           slot_cap;
+    size_t           count;
+    sstr_vault_entry slots[];
+}
+sstr_vault_table;
+
+// reader counters for both epochs
+typedef struct sstr_vault_stripe_struct
+{
+    size_t readers[2];
+    char   padding[SSTR_VAULT_LINE_SIZE - 2 * sizeof (size_t)];
+}
+sstr_vault_stripe;
+
+struct sstr_vault_struct
+{
+    sstr_vault_stripe stripes[SSTR_VAULT_STRIPES];
+    sstr_vault_table  *table;
+    unsigned int      epoch;
+    pthread_mutex_t   update_lock;
+};
+
+static sstr_pos sstr_vault_table_find(
+    const sstr_vault_table *src_table,
+    const sstring          *key_str,
+    sstr_hashval           key_hash
+);
+#ifndef _SSTR_NO_DYNMEM
+static sstr_vault_table *sstr_vault_table_alloc(
+    size_t entry_cap
+);
+static void sstr_vault_table_insert(
+    sstr_vault_table       *dst_table,
+    const sstr_vault_entry *src_entry
+);
+static sstr_vault_table *sstr_vault_table_copy(
+    const sstr_vault_table *src_table,
+    size_t                 entry_cap,
+    sstr_pos               skip_slot
+);
+static void sstr_vault_publish(
+    sstr_vault       *dst_vault,
+    sstr_vault_table *new_table
+);
+static sstring *sstr_vault_dup(
+    const sstring *src_str
+);
+static void sstr_vault_discard(
+    sstring *dst_str
+);
+#endif /* not _SSTR_NO_DYNMEM */
+
+
+#ifndef _SSTR_NO_DYNMEM
+/**
+ * Allocate a vault
+ */
+sstr_vault *sstr_vault_alloc(void)
+{
+    // align the vault to a cache line, so that each stripe of
+    // reader counters occupies exactly one cache line
+    sstr_vault *dst_vault = NULL;
+    if (posix_memalign((void **) &dst_vault, SSTR_VAULT_LINE_SIZE,
+                       sizeof (sstr_vault)) == 0)
+    {
+        dst_vault->table = sstr_vault_table_alloc(0);
+        if (dst_vault->table != NULL &&
+            pthread_mutex_init(&(dst_vault->update_lock), NULL) == 0)
+        {
+            memset(dst_vault->stripes, 0, sizeof (dst_vault->stripes));
+            dst_vault->epoch = 0;
+        }
+        else
+        {
+            free(dst_vault->table);
+            free(dst_vault);
+            dst_vault = NULL;
+        }
+    }
+
+    return dst_vault;
+}
+#endif /* not _SSTR_NO_DYNMEM */
+
+
+#ifndef _SSTR_NO_DYNMEM
+/**
+ * Deallocate a vault, wiping all keys and values
+ *
+ * There must not be any readers inside the vault
+ */
+void sstr_vault_dealloc(
+    sstr_vault *dst_vault
+)
+{
+    if (dst_vault != NULL)
+    {
+        sstr_vault_table *table = dst_vault->table;
+        for (sstr_pos slot_idx = 0; slot_idx < table->slot_cap; ++slot_idx)
+        {
+            if (table->slots[slot_idx].key != NULL)
+            {
+                sstr_vault_discard(table->slots[slot_idx].key);
+                sstr_vault_discard(table->slots[slot_idx].value);
+            }
+        }
+        free(table);
+        pthread_mutex_destroy(&(dst_vault->update_lock));
+        free(dst_vault);
+    }
+}
+#endif /* not _SSTR_NO_DYNMEM */
+
+
+#ifndef _SSTR_NO_DYNMEM
+/**
+ * Insert an entry into a vault, or replace the value of an existing entry
+ *
+ * Waits until no reader can see a replaced value any more,
+ * then wipes the replaced value
+ */
+sstr_rc sstr_vault_put(
+    const sstring *key_str,
+    const sstring *value_str,
+    sstr_vault    *dst_vault
+)
+{
+    sstr_rc sstr_status = SSTR_FAIL;
+
+    if (key_str != NULL && value_str != NULL && dst_vault != NULL)
+    {
+        pthread_mutex_lock(&(dst_vault->update_lock));
+
+        sstr_vault_table *old_table = dst_vault->table;
+
+        sstr_vault_entry new_entry;
+        sstr_hash(key_str, &(new_entry.hash));
+
+        sstr_pos old_slot = sstr_vault_table_find(old_table, key_str, new_entry.hash);
+        size_t   new_count = old_table->count + (old_slot == SSTR_NPOS ? 1 : 0);
+
+        sstring *old_value = NULL;
+        if (old_slot != SSTR_NPOS)
+        {
+            // the key is shared with the previous version of the table
+            new_entry.key = old_table->slots[old_slot].key;
+            old_value     = old_table->slots[old_slot].value;
+        }
+        else
+        {
+            new_entry.key = sstr_vault_dup(key_str);
+        }
+        new_entry.value = sstr_vault_dup(value_str);
+
+        sstr_vault_table *new_table = NULL;
+        if (new_entry.key != NULL && new_entry.value != NULL)
+        {
+            new_table = sstr_vault_table_copy(old_table, new_count, old_slot);
+        }
+
+        if (new_table != NULL)
+        {
+            sstr_vault_table_insert(new_table, &new_entry);
+            sstr_vault_publish(dst_vault, new_table);
+
+            // no reader can see the previous version of the table any more
+            sstr_vault_discard(old_value);
+            free(old_table);
+
+            sstr_status = SSTR_PASS;
+        }
+        else
+        {
+            if (old_slot == SSTR_NPOS)
+            {
+                sstr_vault_discard(new_entry.key);
+            }
+            sstr_vault_discard(new_entry.value);
+        }
+
+        pthread_mutex_unlock(&(dst_vault->update_lock));
+    }
+
+    return sstr_status;
+}
+#endif /* not _SSTR_NO_DYNMEM */
+
+
+#ifndef _SSTR_NO_DYNMEM
+/**
+ * Remove an entry from a vault
+ *
+ * Waits until no reader can see the entry any more,
+ * then wipes its key and value
+ *
+ * Returns SSTR_FAIL if the vault does not contain the key
+ */
+sstr_rc sstr_vault_erase(
+    const sstring *key_str,
+    sstr_vault    *dst_vault
+)
+{
+    sstr_rc sstr_status = SSTR_FAIL;
+
+    if (key_str != NULL && dst_vault != NULL)
+    {
+        pthread_mutex_lock(&(dst_vault->update_lock));
+
+        sstr_vault_table *old_table = dst_vault->table;
+
+        sstr_hashval key_hash;
+        sstr_hash(key_str, &key_hash);
+
+        sstr_pos old_slot = sstr_vault_table_find(old_table, key_str, key_hash);
+        if (old_slot != SSTR_NPOS)
+        {
+            sstr_vault_table *new_table = sstr_vault_table_copy(
+                old_table, old_table->count - 1, old_slot);
+            if (new_table != NULL)
+            {
+                sstr_vault_publish(dst_vault, new_table);
+
+                sstr_vault_discard(old_table->slots[old_slot].key);
+                sstr_vault_discard(old_table->slots[old_slot].value);
+                free(old_table);
+
+                sstr_status = SSTR_PASS;
+            }
+        }
+
+        pthread_mutex_unlock(&(dst_vault->update_lock));
+    }
+
+    return sstr_status;
+}
+#endif /* not _SSTR_NO_DYNMEM */
+
+
+/**
+ * Enter a vault for reading
+ *
+ * Every sstr_vault_enter() must be followed by sstr_vault_leave()
+ * with the same ticket; updates wait for readers inside the vault,
+ * so the time between the two calls should be short
+ */
+sstr_rc sstr_vault_enter(
+    sstr_vault        *src_vault,
+    sstr_vault_ticket *dst_ticket
+)
+{
+    sstr_rc sstr_status = SSTR_FAIL;
+
+    if (src_vault != NULL && dst_ticket != NULL)
+    {
+        // threads run on different stacks, so the address of a local
+        // variable spreads concurrent readers across the stripes
+        uintptr_t stack_addr = (uintptr_t) &stack_addr;
+        size_t stripe = (size_t) (((uint64_t) (stack_addr >> 12) *
+                                   0x9E3779B97F4A7C15ULL) >> 58) % SSTR_VAULT_STRIPES;
+        sstr_vault_stripe *reader_stripe = &(src_vault->stripes[stripe]);
+
+        // register as a reader of the current epoch; if the epoch
+        // changed in the meantime, an update may already have stopped
+        // waiting for readers of that epoch, so register again
+        unsigned int epoch;
+        do
+        {
+            epoch = __atomic_load_n(&(src_vault->epoch), __ATOMIC_SEQ_CST);
+            __atomic_add_fetch(&(reader_stripe->readers[epoch]), 1, __ATOMIC_SEQ_CST);
+            if (__atomic_load_n(&(src_vault->epoch), __ATOMIC_SEQ_CST) == epoch)
+            {
+                break;
+            }
+            __atomic_sub_fetch(&(reader_stripe->readers[epoch]), 1, __ATOMIC_SEQ_CST);
+        }
+        while (1);
+
+        dst_ticket->table  = __atomic_load_n(&(src_vault->table), __ATOMIC_SEQ_CST);
+        dst_ticket->stripe = stripe;
+        dst_ticket->epoch  = epoch;
+
+        sstr_status = SSTR_PASS;
+    }
+
+    return sstr_status;
+}
+
+
+/**
+ * Find the value of an entry in the version of a vault seen by a reader
+ *
+ * The value remains valid until the reader leaves the vault.
+ * Returns NULL if the vault does not contain the key.
+ */
+const sstring *sstr_vault_find(
+    const sstr_vault_ticket *src_ticket,
+    const sstring           *key_str
+)
+{
+    const sstring *dst_value = NULL;
+
+    if (src_ticket != NULL && src_ticket->table != NULL && key_str != NULL)
+    {
+        const sstr_vault_table *table = src_ticket->table;
+
+        sstr_hashval key_hash;
+        sstr_hash(key_str, &key_hash);
+
+        sstr_pos slot_idx = sstr_vault_table_find(table, key_str, key_hash);
+        if (slot_idx != SSTR_NPOS)
+        {
+            dst_value = table->slots[slot_idx].value;
+        }
+    }
+
+    return dst_value;
+}
+
+
+/**
+ * Leave a vault after reading
+ */
+sstr_rc sstr_vault_leave(
+    sstr_vault        *src_vault,
+    sstr_vault_ticket *src_ticket
+)
+{
+    sstr_rc sstr_status = SSTR_FAIL;
+
+    if (src_vault != NULL && src_ticket != NULL && src_ticket->table != NULL)
+    {
+        __atomic_sub_fetch(
+            &(src_vault->stripes[src_ticket->stripe].readers[src_ticket->epoch]),
+            1, __ATOMIC_SEQ_CST);
+        src_ticket->table = NULL;
+
+        sstr_status = SSTR_PASS;
+    }
+
+    return sstr_status;
+}
+
+
+/**
+ * Copy the value of an entry in a vault to a string
+ *
+ * Returns SSTR_FAIL if the vault does not contain the key
+ * or the destination string's capacity is too small
+ */
+sstr_rc sstr_vault_get(
+    sstr_vault    *src_vault,
+    const sstring *key_str,
+    sstring       *dst_str
+)
+{
+    sstr_rc sstr_status = SSTR_FAIL;
+
+    if (src_vault != NULL && key_str != NULL && dst_str != NULL)
+    {
+        sstr_vault_ticket ticket;
+        sstr_vault_enter(src_vault, &ticket);
+
+        const sstring *value = sstr_vault_find(&ticket, key_str);
+        if (value != NULL && dst_str->cap >= value->len)
+        {
+            memcpy(dst_str->chars, value->chars, value->len);
+            dst_str->len = value->len;
+            dst_str->chars[dst_str->len] = '\0';
+
+            sstr_status = SSTR_PASS;
+        }
+
+        sstr_vault_leave(src_vault, &ticket);
+    }
+
+    return sstr_status;
+}
+
+
+static sstr_pos sstr_vault_table_find(
+    const sstr_vault_table *src_table,
+    const sstring          *key_str,
+    sstr_hashval           key_hash
+)
+{
+    sstr_pos slot_found = SSTR_NPOS;
+    size_t   slot_mask  = src_table->slot_cap - 1;
+    sstr_pos slot_idx   = (sstr_pos) key_hash & slot_mask;
+
+    while (src_table->slots[slot_idx].key != NULL)
+    {
+        const sstr_vault_entry *entry = &(src_table->slots[slot_idx]);
+        if (entry->hash == key_hash && entry->key->len == key_str->len &&
+            memcmp(entry->key->chars, key_str->chars, key_str->len) == 0)
+        {
+            slot_found = slot_idx;
+            break;
+        }
+        slot_idx = (slot_idx + 1) & slot_mask;
+    }
+
+    return slot_found;
+}
+
+
+#ifndef _SSTR_NO_DYNMEM
+/**
+ * Allocate an empty table for the specified number of entries
+ *
+ * Linear probing with a load of at most 1/2
+ */
+static sstr_vault_table *sstr_vault_table_alloc(
+    size_t entry_cap
+)
+{
+    sstr_vault_table *dst_table = NULL;
+
+    size_t slot_cap = 8;
+    while (slot_cap / 2 < entry_cap &&
+           slot_cap <= (SSTR_SIZE_T_MAX / 4) / sizeof (sstr_vault_entry))
+    {
+        slot_cap *= 2;
+    }
+
+    if (slot_cap / 2 >= entry_cap)
+    {
+        dst_table = malloc(sizeof (sstr_vault_table) +
+                           slot_cap * sizeof (sstr_vault_entry));
+        if (dst_table != NULL)
+        {
+            memset(dst_table->slots, 0, slot_cap * sizeof (sstr_vault_entry));
+            dst_table->slot_cap = slot_cap;
+            dst_table->count    = 0;
+        }
+    }
+
+    return dst_table;
+}
+
+
+static void sstr_vault_table_insert(
+    sstr_vault_table       *dst_table,
+    const sstr_vault_entry *src_entry
+)
+{
+    size_t   slot_mask = dst_table->slot_cap - 1;
+    sstr_pos slot_idx  = (sstr_pos) src_entry->hash & slot_mask;
+
+    while (dst_table->slots[slot_idx].key != NULL)
+    {
+        slot_idx = (slot_idx + 1) & slot_mask;
+    }
+    dst_table->slots[slot_idx] = *src_entry;
+    ++(dst_table->count);
+}
+#endif /* not _SSTR_NO_DYNMEM */
+
+
+#ifndef _SSTR_NO_DYNMEM
+/**
+ * Copy the entries of a table, except for the entry in skip_slot,
+ * into a new table for the specified number of entries
+ */
+static sstr_vault_table *sstr_vault_table_copy(
+    const sstr_vault_table *src_table,
+    size_t                 entry_cap,
+    sstr_pos               skip_slot
+)
+{
+    sstr_vault_table *dst_table = sstr_vault_table_alloc(entry_cap);
+    if (dst_table != NULL)
+    {
+        for (sstr_pos slot_idx = 0; slot_idx < src_table->slot_cap; ++slot_idx)
+        {
+            if (src_table->slots[slot_idx].key != NULL && slot_idx != skip_slot)
+            {
+                sstr_vault_table_insert(dst_table, &(src_table->slots[slot_idx]));
+            }
+        }
+    }
+
+    return dst_table;
+}
+#endif /* not _SSTR_NO_DYNMEM */
+
+
+#ifndef _SSTR_NO_DYNMEM
+/**
+ * Publish a new version of a vault's table and wait until
+ * no reader can see the previous version any more
+ *
+ * Readers that entered before the epoch was switched are counted
+ * in the previous epoch's counters; readers that enter afterwards
+ * see the new table
+ */
+static void sstr_vault_publish(
+    sstr_vault       *dst_vault,
+    sstr_vault_table *new_table
+)
+{
+    __atomic_store_n(&(dst_vault->table), new_table, __ATOMIC_SEQ_CST);
+
+    unsigned int old_epoch = __atomic_load_n(&(dst_vault->epoch), __ATOMIC_SEQ_CST);
+    __atomic_store_n(&(dst_vault->epoch), old_epoch ^ 1U, __ATOMIC_SEQ_CST);
+
+    for (size_t stripe = 0; stripe < SSTR_VAULT_STRIPES; ++stripe)
+    {
+        while (__atomic_load_n(&(dst_vault->stripes[stripe].readers[old_epoch]),
+                               __ATOMIC_SEQ_CST) != 0)
+        {
+            sched_yield();
+        }
+    }
+}
+#endif /* not _SSTR_NO_DYNMEM */
+
+
+#ifndef _SSTR_NO_DYNMEM
+/**
+ * Allocate a copy of a string with a capacity of its length
+ */
+static sstring *sstr_vault_dup(
+    const sstring *src_str
+)
+{
+    sstring *dst_str = sstr_alloc(src_str->len);
+    if (dst_str != NULL)
+    {
+        memcpy(dst_str->chars, src_str->chars, src_str->len);
+        dst_str->len = src_str->len;
+        dst_str->chars[dst_str->len] = '\0';
+    }
+
+    return dst_str;
+}
+#endif /* not _SSTR_NO_DYNMEM */
+
+
+#ifndef _SSTR_NO_DYNMEM
+/**
+ * Wipe and deallocate a string owned by a vault
+ */
+static void sstr_vault_discard(
+    sstring *dst_str
+)
+{
+    if (dst_str != NULL)
+    {
+        sstr_wipe(dst_str);
+        sstr_dealloc(dst_str);
+    }
+}
+#endif /* not _SSTR_NO_DYNMEM */
@@ -0,0 +1,175 @@
+/**
+ * secureStrings library
+ * version 0.54-beta (2014-10-25_001)
+ *
+ * secureStrings concurrent vault
+ *
+ * Copyright (C) 2010, 2014 Robert ALTNOEDER
+ *
+ * Redistribution and use in source and binary forms,
+ * with or without modification, are permitted provided that
+ * the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in
+ *     the documentation and/or other materials provided with the distribution.
+ *  3. The name of the author may not be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _SECURESTR_VAULT_H
+#define _SECURESTR_VAULT_H
+
+#include <unistd.h>
+#include <sys/types.h>
+#include <stdlib.h>
+#include <securestr.h>
+
+// An sstr_vault maps secureString keys to secureString values and is
+// optimized for many concurrent readers and rare updates
+//
+// Readers never take a lock. A reader enters the vault, which pins the
+// current version of the vault's table, looks up any number of entries
+// and leaves the vault again.
+//
+// Writers are serialized by a mutex. An update publishes a new version
+// of the table and then waits until all readers that may still see the
+// previous version have left. Only then are replaced or removed keys
+// and values wiped and deallocated.
+typedef struct sstr_vault_struct sstr_vault;
+
+// A ticket is filled in by sstr_vault_enter() and identifies
+// the version of the table that a reader sees
+typedef struct sstr_vault_ticket_struct
+{
+    const void   *table;
+    size_t       stripe;
+    unsigned int epoch;
+}
+sstr_vault_ticket;
+
+
+#ifndef _SSTR_NO_DYNMEM
+/**
+ * Allocate a vault
+ */
+sstr_vault *sstr_vault_alloc(void);
+#endif /* not _SSTR_NO_DYNMEM */
+
+
+#ifndef _SSTR_NO_DYNMEM
+/**
+ * Deallocate a vault, wiping all keys and values
+ *
+ * There must not be any readers inside the vault
+ */
+void sstr_vault_dealloc(
+    sstr_vault *dst_vault
+);
+#endif /* not _SSTR_NO_DYNMEM */
+
+
+#ifndef _SSTR_NO_DYNMEM
+/**
+ * Insert an entry into a vault, or replace the value of an existing entry
+ *
+ * Waits until no reader can see a replaced value any more,
+ * then wipes the replaced value
+ */
+sstr_rc sstr_vault_put(
+    const sstring *key_str,
+    const sstring *value_str,
+    sstr_vault    *dst_vault
+);
+#endif /* not _SSTR_NO_DYNMEM */
+
+
+#ifndef _SSTR_NO_DYNMEM
+/**
+ * Remove an entry from a vault
+ *
+ * Waits until no reader can see the entry any more,
+ * then wipes its key and value
+ *
+ * Returns SSTR_FAIL if the vault does not contain the key
+ */
+sstr_rc sstr_vault_erase(
+    const sstring *key_str,
+    sstr_vault    *dst_vault
+);
+#endif /* not _SSTR_NO_DYNMEM */
+
+
+/**
+ * Enter a vault for reading
+ *
+ * Every sstr_vault_enter() must be followed by sstr_vault_leave()
+ * with the same ticket; updates wait for readers inside the vault,
+ * so the time between the two calls should be short
+ */
+sstr_rc sstr_vault_enter(
+    sstr_vault        *src_vault,
+    sstr_vault_ticket *dst_ticket
+);
+
+
+/**
+ * Find the value of an entry in the version of a vault seen by a reader
+ *
+ * The value remains valid until the reader leaves the vault.
+ * Returns NULL if the vault does not contain the key.
+ */
+const sstring *sstr_vault_find(
+    const sstr_vault_ticket *src_ticket,
+    const sstring           *key_str
+);
+
+
+/**
+ * Leave a vault after reading
+ */
+sstr_rc sstr_vault_leave(
+    sstr_vault        *src_vault,
+    sstr_vault_ticket *src_ticket
+);
+
+
+/**
+ * Copy the value of an entry in a vault to a string
+ *
+ * Returns SSTR_FAIL if the vault does not contain the key
+ * or the destination string's capacity is too small
+ */
+sstr_rc sstr_vault_get(
+    sstr_vault    *src_vault,
+    const sstring *key_str,
+    sstring       *dst_str
+);
+
+
+#define sstrVault           sstr_vault
+#define sstrVaultTicket     sstr_vault_ticket
+
+#define sstrVaultAlloc      sstr_vault_alloc
+#define sstrVaultDealloc    sstr_vault_dealloc
+#define sstrVaultPut        sstr_vault_put
+#define sstrVaultErase      sstr_vault_erase
+#define sstrVaultEnter      sstr_vault_enter
+#define sstrVaultFind       sstr_vault_find
+#define sstrVaultLeave      sstr_vault_leave
+#define sstrVaultGet        sstr_vault_get
+
+#endif /* _SECURESTR_VAULT_H */